@@ -16,6 +16,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/fep3_participant_export.h>
 
 #include <functional>
+#include <vector>
 
 namespace fep3 {
 namespace base {
@@ -109,6 +110,23 @@ public:
     ///@copydoc fep3::base::arya::detail::DataItemQueueBase::popFront()
     std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE>> popFront() override;
 
+    /**
+     * @brief pops the items at the front of the queue as long as the first sample of the queue is
+     * due, i.e. as long as @c time_comparator(nextTime(), time) returns @c true.
+     * Stream types in front of a due sample are popped as well.
+     *
+     * @param[in] time the time to pop the items until
+     * @param[in] time_comparator returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp
+     * @param[in] receiver the receiver of the popped items
+     * @return the number of popped items
+     * @remark the queue is locked once for all items, the receiver is called after unlocking
+     */
+    size_t popFrontUntil(
+        fep3::arya::Timestamp time,
+        const std::function<bool(fep3::arya::Timestamp, fep3::arya::Timestamp)>& time_comparator,
+        typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::IDataItemReceiver& receiver);
+
     ///@copydoc fep3::base::arya::detail::DataItemQueueBase::popBack
     bool popBack(
         typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::IDataItemReceiver& receiver) override;
@@ -147,6 +165,77 @@ public:
      */
     size_t setCapacity(size_t queue_size);
 
+    /**
+     * @brief reads the latest sample with a timestamp before @p upper_bound
+     *
+     * @param[in] upper_bound the exclusive upper bound of the sample timestamp
+     * @return the sample or nullptr if no sample with a timestamp before @p upper_bound is queued
+     * @remark the sample is found by binary search if the items were pushed in time order,
+     * otherwise the queue is searched backwards
+     */
+    data_read_ptr<SAMPLE_TYPE> readSampleBefore(fep3::arya::Timestamp upper_bound) const;
+
+    /**
+     * @brief reads the latest sample with a timestamp not after @p time,
+     * i.e. the sample valid at @p time
+     *
+     * @param[in] time the inclusive upper bound of the sample timestamp
+     * @return the sample or nullptr if no sample with a timestamp not after @p time is queued
+     * @remark the sample is found by binary search if the items were pushed in time order,
+     * otherwise the queue is searched backwards
+     */
+    data_read_ptr<SAMPLE_TYPE> readSampleAt(fep3::arya::Timestamp time) const;
+
+    /**
+     * @brief reads the earliest sample with a timestamp after @p lower_bound
+     *
+     * @param[in] lower_bound the exclusive lower bound of the sample timestamp
+     * @return the sample or nullptr if no sample with a timestamp after @p lower_bound is queued
+     * @remark the sample is found by binary search if the items were pushed in time order,
+     * otherwise the queue is searched forwards
+     */
+    data_read_ptr<SAMPLE_TYPE> readSampleAfter(fep3::arya::Timestamp lower_bound) const;
+
+    /**
+     * @brief reads all samples with a timestamp within [@p lower_bound, @p upper_bound)
+     *
+     * @param[in] lower_bound the inclusive lower bound of the sample timestamps
+     * @param[in] upper_bound the exclusive upper bound of the sample timestamps
+     * @return the samples ordered like the queue, the queue is locked once for all samples
+     * @remark the range is found by binary search if the items were pushed in time order,
+     * otherwise all items are checked
+     */
+    std::vector<data_read_ptr<SAMPLE_TYPE>> readSamplesBetween(
+        fep3::arya::Timestamp lower_bound, fep3::arya::Timestamp upper_bound) const;
+
+    /**
+     * @brief reads all samples with a timestamp within [@p lower_bound, @p upper_bound) into
+     * @p samples reusing its memory
+     *
+     * @param[out] samples the snapshot of the samples ordered like the queue
+     * @param[in] lower_bound the inclusive lower bound of the sample timestamps
+     * @param[in] upper_bound the exclusive upper bound of the sample timestamps
+     */
+    void readSamplesBetween(std::vector<data_read_ptr<SAMPLE_TYPE>>& samples,
+                            fep3::arya::Timestamp lower_bound,
+                            fep3::arya::Timestamp upper_bound) const;
+
+    /**
+     * @brief reads the latest @p count samples
+     *
+     * @param[in] count the maximum number of samples to read
+     * @return the samples ordered like the queue, the queue is locked once for all samples
+     */
+    std::vector<data_read_ptr<SAMPLE_TYPE>> readSamplesLatest(size_t count) const;
+
+    /**
+     * @brief reads the latest @p count samples into @p samples reusing its memory
+     *
+     * @param[out] samples the snapshot of the samples ordered like the queue
+     * @param[in] count the maximum number of samples to read
+     */
+    void readSamplesLatest(std::vector<data_read_ptr<SAMPLE_TYPE>>& samples, size_t count) const;
+
     /**
      * @brief reverse iteration over all items stored in the queue
      *
@@ -0,0 +1,55 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/data_registry/data_registry_intf.h>
+
+#include <functional>
+
+namespace fep3 {
+namespace arya {
+
+/**
+ * @brief Optional extension of @ref fep3::arya::IDataRegistry::IDataReader
+ * for data readers which are able to pop all due items at once.
+ * Use dynamic_cast on the data reader to check whether it supports batched popping.
+ */
+class IDataRegistryBatchReader {
+public:
+    /// DTOR
+    virtual ~IDataRegistryBatchReader() = default;
+
+    /**
+     * @brief Pops the front items from the reader queue and passes them to the callbacks of
+     * @p receiver as long as the front time is due.
+     * This is equivalent to calling @ref fep3::arya::IDataRegistry::IDataReader::pop while
+     * @c time_comparator(getFrontTime(), time) returns @c true, but the reader queue is locked
+     * once for all items only. This method is non-blocking.
+     * @remark The receiver is called after the due items have been popped and the reader queue has
+     * been unlocked again.
+     *
+     * @param[in] time The time to pop the items until
+     * @param[in] time_comparator Returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp, e.g. std::less<Timestamp>
+     * @param[in] receiver The receiver object to be called back for every popped item
+     * @return The number of popped items
+     */
+    virtual size_t popUntil(arya::Timestamp time,
+                            const std::function<bool(arya::Timestamp, arya::Timestamp)>&
+                                time_comparator,
+                            arya::IDataRegistry::IDataReceiver& receiver) = 0;
+};
+
+} // namespace arya
+using arya::IDataRegistryBatchReader;
+} // namespace fep3
@@ -47,6 +47,47 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #define FEP3_DATA_REGISTRY_MAPPING_DDL_FILE_PATHS                                                  \
     FEP3_DATA_REGISTRY_CONFIG "/" FEP3_MAPPING_DDL_FILE_PATHS_PROPERTY
 
+/**
+ * @brief The mapping compilation property name
+ */
+#define FEP3_MAPPING_COMPILATION_PROPERTY "mapping_compilation"
+
+/**
+ * @brief The mapping compilation property node
+ * Use this to map target signals, whose assignments only copy or convert elements of predefined
+ * data types and which are triggered by source signals, with a precompiled list of memory copies
+ * instead of the ddl mapping engine. All other target signals are mapped by the ddl mapping
+ * engine. The value is applied to target signals registered during initialization.
+ */
+#define FEP3_DATA_REGISTRY_MAPPING_COMPILATION                                                     \
+    FEP3_DATA_REGISTRY_CONFIG "/" FEP3_MAPPING_COMPILATION_PROPERTY
+
+/**
+ * @brief Default value of the "mapping_compilation" property
+ */
+#define FEP3_MAPPING_COMPILATION_DEFAULT_VALUE true
+
+/**
+ * @brief The mapping parallel evaluation threshold property name
+ */
+#define FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_PROPERTY "mapping_parallel_evaluation_threshold"
+
+/**
+ * @brief The mapping parallel evaluation threshold property node
+ * Use this to evaluate the compiled target signals of a source signal in parallel on a worker pool
+ * if the source signal is used by at least this count of compiled target signals. Every target
+ * signal is still delivered in the order of the received source samples. A value of 0 disables
+ * the parallel evaluation. The value is applied on the next start of the data registry.
+ */
+#define FEP3_DATA_REGISTRY_MAPPING_PARALLEL_EVALUATION_THRESHOLD                                   \
+    FEP3_DATA_REGISTRY_CONFIG "/" FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_PROPERTY
+
+/**
+ * @brief Default value of the "mapping_parallel_evaluation_threshold" property (parallel
+ * evaluation disabled)
+ */
+#define FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_DEFAULT_VALUE 0
+
 /**
  * @brief The input signal renaming configuration property name.
  * Use this to set the input signal renaming configuration with a single string from inside the data
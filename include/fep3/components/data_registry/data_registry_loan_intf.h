@@ -0,0 +1,60 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/data_registry/data_registry_intf.h>
+#include <fep3/components/simulation_bus/simulation_bus_loan_intf.h>
+
+#include <memory>
+
+namespace fep3 {
+namespace arya {
+
+/**
+ * @brief Optional extension of @ref fep3::arya::IDataRegistry::IDataWriter
+ * for data writers which are able to loan the memory of a sample from the simulation bus.
+ * The caller writes the sample in place, it is passed on without being copied on commit.
+ * Use dynamic_cast on the data writer to check whether it supports loaning.
+ */
+class IDataRegistryLoaningWriter {
+public:
+    /// DTOR
+    virtual ~IDataRegistryLoaningWriter() = default;
+
+    /**
+     * @brief Loans a writable sample of at least @p size bytes.
+     * The size of the loaned sample is initially set to @p size.
+     *
+     * @param[in] size The size of the memory to be loaned in bytes
+     * @return The loaned sample, nullptr if the simulation bus data writer does not loan memory
+     */
+    virtual std::shared_ptr<arya::ILoanedDataSample> loanSample(size_t size) = 0;
+
+    /**
+     * @brief Commits a sample previously loaned by @ref loanSample of this writer.
+     * The sample is written like a sample written by
+     * @ref fep3::arya::IDataRegistry::IDataWriter::write.
+     * @remark The caller must not modify the sample after it has been committed.
+     *
+     * @param[in] loaned_sample The loaned sample to commit
+     * @return fep3::Result
+     * @retval ERR_POINTER if @p loaned_sample is a nullptr
+     * @retval ERR_INVALID_ARG if @p loaned_sample has not been loaned from this writer
+     * @retval ERR_NOT_SUPPORTED if the simulation bus data writer does not loan memory
+     */
+    virtual fep3::Result commit(const std::shared_ptr<arya::ILoanedDataSample>& loaned_sample) = 0;
+};
+
+} // namespace arya
+using arya::IDataRegistryLoaningWriter;
+} // namespace fep3
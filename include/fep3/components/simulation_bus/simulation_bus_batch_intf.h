@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+
+#include <functional>
+
+namespace fep3 {
+namespace arya {
+
+/**
+ * @brief Optional extension of @ref fep3::arya::ISimulationBus::IDataReader
+ * for data readers which are able to pop all due items at once.
+ * Use dynamic_cast on the data reader to check whether it supports batched popping.
+ */
+class ISimulationBusBatchReader {
+public:
+    /// DTOR
+    virtual ~ISimulationBusBatchReader() = default;
+
+    /**
+     * @brief Pops the front items from the reader queue up to the last due sample and passes
+     * them to the callbacks of @p receiver in order.
+     * Samples are popped as long as @c time_comparator(sample time, time) returns @c true. Stream
+     * types in front of or between due samples are popped as well, so a stream type does not
+     * stop the popping of the due samples behind it. Stream types behind the last due sample are
+     * kept unless the reader queue cannot look behind them. The reader queue is locked once for
+     * all items only. This method is non-blocking.
+     * @remark The receiver is called after the due items have been popped and the reader queue has
+     * been unlocked again.
+     *
+     * @param[in] time The time to pop the items until
+     * @param[in] time_comparator Returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp, e.g. std::less<Timestamp>
+     * @param[in] receiver The receiver object to be called back for every popped item
+     * @return The number of popped items
+     */
+    virtual size_t popUntil(arya::Timestamp time,
+                            const std::function<bool(arya::Timestamp, arya::Timestamp)>&
+                                time_comparator,
+                            arya::ISimulationBus::IDataReceiver& receiver) = 0;
+};
+
+} // namespace arya
+using arya::ISimulationBusBatchReader;
+} // namespace fep3
@@ -0,0 +1,68 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+#include <fep3/fep3_duration.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace fep3 {
+namespace arya {
+
+/**
+ * @brief Filter of the samples a simulation bus data reader receives.
+ * The criteria are applied in the order predicate, decimation factor, min interval. A sample
+ * dropped by one criterion is not taken into account by the following ones.
+ * Stream types are never filtered.
+ */
+struct SampleFilter {
+    /// only every n-th sample passes, beginning with the first one (0 and 1 pass every sample)
+    uint32_t _decimation_factor{1};
+    /// min time between the timestamps of two passing samples (0 passes every sample)
+    arya::Duration _min_interval{0};
+    /// a sample only passes if the predicate returns @c true (empty to pass every sample)
+    std::function<bool(const arya::IDataSample&)> _predicate;
+};
+
+/**
+ * @brief Optional extension of @ref fep3::arya::ISimulationBus
+ * for simulation buses which are able to filter the samples of a reader on transmission.
+ * Samples dropped by the filter are never pushed to the queue of the reader, so they cost neither
+ * queue capacity nor any copy.
+ * Use dynamic_cast on the simulation bus to check whether it supports filtering.
+ */
+class IFilteringSimulationBus {
+public:
+    /// DTOR
+    virtual ~IFilteringSimulationBus() = default;
+
+    /**
+     * @brief Gets a reader receiving the samples of a signal which pass the given filter.
+     * @see fep3::arya::ISimulationBus::getReader(const std::string&, size_t)
+     *
+     * @param[in] name The name of the signal
+     * @param[in] queue_capacity The capacity of the reader queue
+     * @param[in] filter The filter of the samples
+     * @return The reader, nullptr if the reader could not be created
+     */
+    virtual std::unique_ptr<arya::ISimulationBus::IDataReader> getReader(
+        const std::string& name, size_t queue_capacity, const SampleFilter& filter) = 0;
+};
+
+} // namespace arya
+using arya::IFilteringSimulationBus;
+using arya::SampleFilter;
+} // namespace fep3
@@ -119,6 +119,241 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 #define FEP3_RTI_DDS_SIMBUS_ASYNC_WAITSET_THREADS_DEFAULT_VALUE 8
 
+/**
+ * @brief The native simulation bus main property tree entry node
+ */
+#define FEP3_NATIVE_SIMBUS_CONFIG "native_simulation_bus"
+
+/**
+ * @brief The polling reception of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_PROPERTY "use_polling_reception"
+
+/**
+ * @brief The polling reception of native simulation bus configuration node
+ * Use this to let the data triggered reception poll the reader queues every millisecond instead of
+ * waiting for incoming data.
+ * Default value of false enables the event driven reception
+ */
+#define FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION                                                   \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_PROPERTY
+
+/**
+ * @brief Default value of the "use_polling_reception" property
+ */
+#define FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_DEFAULT_VALUE false
+
+/**
+ * @brief The lock-free reader signal list of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_PROPERTY "lock_free_reader_signals"
+
+/**
+ * @brief The lock-free reader signal list of native simulation bus configuration node
+ * Use this to set the signals whose readers use a lock-free queue instead of a locked queue.
+ * The lock-free queue requires a single writer per signal and a single thread popping the reader.
+ * Use "*" to let all readers use a lock-free queue.
+ * The list must be empty if a replay file is set (see @ref FEP3_NATIVE_SIMBUS_REPLAY_FILE), since
+ * the replay transmits to the readers in addition to the writers.
+ * Readers of queue capacity 1 always use a wait-free queue which only keeps the newest sample and
+ * the newest stream type.
+ */
+#define FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS                                                \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_PROPERTY
+
+/**
+ * @brief Default value of the lock-free reader signal list property (empty list).
+ */
+#define FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_DEFAULT_VALUE
+
+/**
+ * @brief The dispatch thread count of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY "dispatch_threads"
+
+/**
+ * @brief The dispatch thread count of native simulation bus configuration node
+ * Use this to distribute the readers of the event driven data triggered reception over several
+ * threads, so a slow receiver only delays the signals dispatched by the same thread.
+ * Each reader is dispatched by exactly one thread, so the order of its items is kept.
+ * The value is applied to readers created after it has been set. It is ignored by the polling
+ * reception.
+ */
+#define FEP3_NATIVE_SIMBUS_DISPATCH_THREADS                                                        \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY
+
+/**
+ * @brief Default value of the "dispatch_threads" property (all readers are dispatched by the
+ * thread calling @ref fep3::arya::ISimulationBus::startBlockingReception)
+ */
+#define FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_DEFAULT_VALUE 1
+
+/**
+ * @brief The lossless writer signal list of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_PROPERTY "lossless_writer_signals"
+
+/**
+ * @brief The lossless writer signal list of native simulation bus configuration node
+ * Use this to set the signals whose writers never drop items if a reader queue is full.
+ * Instead the transmission waits for free space up to the lossless write timeout and fails if the
+ * reader queues are still full afterwards. Use "*" to let all writers be lossless.
+ * The list is applied to writers created after it has been set.
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS                                                 \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_PROPERTY
+
+/**
+ * @brief Default value of the lossless writer signal list property (empty list).
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_DEFAULT_VALUE
+
+/**
+ * @brief The lossless write timeout of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_PROPERTY "lossless_write_timeout"
+
+/**
+ * @brief The lossless write timeout of native simulation bus configuration node
+ * Use this to set how long a lossless writer waits for a full reader queue in nanoseconds.
+ * If the timeout expires the transmission fails with ERR_TIMEOUT. Default value of 0 lets the
+ * transmission fail with ERR_RESOURCE_IN_USE right away instead of waiting.
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT                                                  \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_PROPERTY
+
+/**
+ * @brief Default value of the lossless write timeout property in nanoseconds.
+ */
+#define FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_DEFAULT_VALUE 0
+
+/**
+ * @brief The recording file of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE_PROPERTY "recording_file"
+
+/**
+ * @brief The recording file of native simulation bus configuration node
+ * Use this to record the samples and stream types transmitted by the simulation bus to a memory
+ * mapped capture file. The file is created on initialization and completed on deinitialization.
+ * Recording never blocks a writer, items which cannot be recorded in time or do not fit into the
+ * file anymore are counted as overflow within the file.
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE                                                          \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_RECORDING_FILE_PROPERTY
+
+/**
+ * @brief Default value of the recording file property (empty, i.e. no recording).
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE_DEFAULT_VALUE ""
+
+/**
+ * @brief The recording file size of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_PROPERTY "recording_file_size"
+
+/**
+ * @brief The recording file size of native simulation bus configuration node
+ * Use this to set the size in bytes the capture file is preallocated with.
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE                                                     \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_PROPERTY
+
+/**
+ * @brief Default value of the recording file size property in bytes (256 MiB).
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_DEFAULT_VALUE 268435456
+
+/**
+ * @brief The recording signal list of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_PROPERTY "recording_signals"
+
+/**
+ * @brief The recording signal list of native simulation bus configuration node
+ * Use this to set the signals which are recorded if a recording file is set.
+ * Use "*" to record all signals.
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS                                                       \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_PROPERTY
+
+/**
+ * @brief Default value of the recording signal list property (all signals).
+ */
+#define FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_DEFAULT_VALUE "*"
+
+/**
+ * @brief The replay file of native simulation bus configuration property name
+ */
+#define FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY "replay_file"
+
+/**
+ * @brief The replay file of native simulation bus configuration node
+ * Use this to replay a capture file recorded by the native simulation bus. While running, the
+ * recorded samples and stream types are transmitted to the readers of the recorded signals when
+ * the discrete main clock reaches their time, so replay runs as fast as the clock steps. Time
+ * resets of the clock seek the replay to the new time.
+ * Replay is not supported in combination with lock-free reader signals (see
+ * @ref FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS), initialization fails in that case.
+ */
+#define FEP3_NATIVE_SIMBUS_REPLAY_FILE                                                             \
+    FEP3_NATIVE_SIMBUS_CONFIG "/" FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY
+
+/**
+ * @brief Default value of the replay file property (empty, i.e. no replay).
+ */
+#define FEP3_NATIVE_SIMBUS_REPLAY_FILE_DEFAULT_VALUE ""
+
+/**
+ * @brief The shared memory simulation bus main property tree entry node
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_CONFIG "shared_memory_simulation_bus"
+
+/**
+ * @brief The participant domain of shared memory simulation bus configuration node
+ * Only participants of the same domain on the same host exchange data.
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_PARTICIPANT_DOMAIN                                               \
+    FEP3_SHARED_MEMORY_SIMBUS_CONFIG "/" FEP3_SIMBUS_PARTICIPANT_DOMAIN_PROPERTY
+
+/**
+ * @brief The slot count of shared memory simulation bus configuration property name
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_PROPERTY "slot_count"
+
+/**
+ * @brief The slot count of shared memory simulation bus configuration node
+ * Use this to set the number of items the shared memory ring buffer of a signal holds.
+ * Readers which fall behind by more items lose the oldest items.
+ * The value is applied by the participant creating the ring buffer of a signal.
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT                                                       \
+    FEP3_SHARED_MEMORY_SIMBUS_CONFIG "/" FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_PROPERTY
+
+/**
+ * @brief Default value of the "slot_count" property
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_DEFAULT_VALUE 64
+
+/**
+ * @brief The slot size of shared memory simulation bus configuration property name
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_PROPERTY "slot_size"
+
+/**
+ * @brief The slot size of shared memory simulation bus configuration node
+ * Use this to set the max size in bytes of a sample of a signal. Signals whose stream type provides
+ * a larger max byte size get a larger slot. Larger samples are not transmitted.
+ * The value is applied by the participant creating the ring buffer of a signal.
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE                                                        \
+    FEP3_SHARED_MEMORY_SIMBUS_CONFIG "/" FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_PROPERTY
+
+/**
+ * @brief Default value of the "slot_size" property
+ */
+#define FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_DEFAULT_VALUE 65536
+
 namespace fep3 {
 namespace arya {
 
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/base/sample/data_sample_intf.h>
+#include <fep3/fep3_errors.h>
+
+#include <memory>
+
+namespace fep3 {
+namespace arya {
+
+/**
+ * @brief Data sample whose memory has been loaned from a simulation bus data writer.
+ * The memory is writable in place and is handed over to the readers without being copied once
+ * the sample has been committed (see @ref ILoaningDataWriter::commit).
+ */
+class ILoanedDataSample : public arya::IDataSample {
+protected:
+    /// DTOR
+    ~ILoanedDataSample() = default;
+
+public:
+    /**
+     * @brief Gets the writable memory of the loaned sample.
+     * The memory is valid for @ref getCapacity bytes as long as the sample exists.
+     * @remark The memory must not be modified after the sample has been committed.
+     *
+     * @return Pointer to the writable memory
+     */
+    virtual void* data() = 0;
+
+    /**
+     * @brief Gets the capacity of the loaned memory, which is at least the size requested on loan
+     *
+     * @return The capacity in bytes
+     */
+    virtual size_t getCapacity() const = 0;
+
+    /**
+     * @brief Sets the size of the valid data within the loaned memory.
+     * The size is limited to @ref getCapacity.
+     *
+     * @param[in] size The size of the valid data in bytes
+     * @return The size which has been set
+     */
+    virtual size_t setSize(size_t size) = 0;
+};
+
+/**
+ * @brief Optional extension of @ref fep3::arya::ISimulationBus::IDataWriter
+ * for writers which are able to loan memory for a sample to the caller.
+ * The caller serializes directly into the loaned memory, which is passed on to the readers
+ * without any further allocation or copy.
+ * Use dynamic_cast on the data writer to check whether it supports loaning.
+ */
+class ILoaningDataWriter {
+public:
+    /// DTOR
+    virtual ~ILoaningDataWriter() = default;
+
+    /**
+     * @brief Loans a writable sample of at least @p size bytes.
+     * The size of the loaned sample is initially set to @p size.
+     *
+     * @param[in] size The size of the memory to be loaned in bytes
+     * @return The loaned sample, nullptr if no memory could be loaned
+     */
+    virtual std::shared_ptr<arya::ILoanedDataSample> loanSample(size_t size) = 0;
+
+    /**
+     * @brief Commits a sample previously loaned by @ref loanSample of this writer.
+     * The sample is enqueued like a sample written by
+     * @ref fep3::arya::ISimulationBus::IDataWriter::write and will be transmitted
+     * on the next call to @ref fep3::arya::ISimulationBus::IDataWriter::transmit.
+     * @remark The caller must not modify the sample after it has been committed.
+     *
+     * @param[in] loaned_sample The loaned sample to commit
+     * @return fep3::Result
+     * @retval ERR_POINTER if @p loaned_sample is a nullptr
+     * @retval ERR_INVALID_ARG if @p loaned_sample has not been loaned from this writer
+     */
+    virtual fep3::Result commit(const std::shared_ptr<arya::ILoanedDataSample>& loaned_sample) = 0;
+};
+
+} // namespace arya
+using arya::ILoanedDataSample;
+using arya::ILoaningDataWriter;
+} // namespace fep3
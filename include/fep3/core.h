@@ -17,6 +17,10 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/core/custom_job_element.h>
 #include <fep3/core/data/data_reader.h>
 #include <fep3/core/data/data_writer.h>
+#include <fep3/core/data/interpolating_data_reader.h>
+#include <fep3/core/data/typed_data_reader.h>
+#include <fep3/core/data/typed_data_writer.h>
+#include <fep3/core/data/windowed_data_reader.h>
 #include <fep3/core/data_io_container.h>
 #include <fep3/core/data_io_container_intf.h>
 #include <fep3/core/default_job.h>
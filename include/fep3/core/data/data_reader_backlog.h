@@ -164,29 +164,100 @@ public:
      * @retval valid pointer the sample read
      * @retval invalid pointer the queue was empty or did not contain a sample with timestamp below
      * upper_bound
+     * @remark O(log n) if the samples were received in time order
      */
     data_read_ptr<const fep3::arya::IDataSample> readSampleBefore(
         fep3::arya::Timestamp upper_bound) const
     {
-        std::lock_guard<std::mutex> lock_guard(_mutex);
+        return _sample_queue.readSampleBefore(upper_bound);
+    }
 
-        if (0 == _sample_queue.size()) {
-            return {};
-        }
+    /**
+     * @brief reads the latest sample which is valid at a timestamp,
+     * i.e. the latest sample with a timestamp not after @p time
+     *
+     * @param time time looking for
+     * @return data_read_ptr<const IDataSample>
+     * @retval valid pointer the sample read
+     * @retval invalid pointer the queue was empty or did not contain a sample with timestamp not
+     * after time
+     * @remark O(log n) if the samples were received in time order
+     */
+    data_read_ptr<const fep3::arya::IDataSample> readSampleAt(fep3::arya::Timestamp time) const
+    {
+        return _sample_queue.readSampleAt(time);
+    }
 
-        data_read_ptr<const fep3::arya::IDataSample> result;
-        _sample_queue.reverseIteration(
-            [&result, upper_bound](const data_read_ptr<const fep3::arya::IDataSample>& sample,
-                                   const data_read_ptr<const fep3::arya::IStreamType>&,
-                                   fep3::arya::Timestamp timestamp) {
-                if (timestamp < upper_bound) {
-                    result = sample;
-                    return false;
-                }
-                return true;
-            });
+    /**
+     * @brief reads the earliest sample which is above a lower bound timestamp
+     *
+     * @param lower_bound time looking for
+     * @return data_read_ptr<const IDataSample>
+     * @retval valid pointer the sample read
+     * @retval invalid pointer the queue was empty or did not contain a sample with timestamp above
+     * lower_bound
+     * @remark O(log n) if the samples were received in time order
+     */
+    data_read_ptr<const fep3::arya::IDataSample> readSampleAfter(
+        fep3::arya::Timestamp lower_bound) const
+    {
+        return _sample_queue.readSampleAfter(lower_bound);
+    }
 
-        return result;
+    /**
+     * @brief reads all samples with a timestamp within [lower_bound, upper_bound)
+     *
+     * @param lower_bound inclusive lower bound of the sample timestamps
+     * @param upper_bound exclusive upper bound of the sample timestamps
+     * @return std::vector<data_read_ptr<const IDataSample>> the samples from oldest to latest
+     * @remark The range is located in O(log n) if the samples were received in time order.
+     * The samples are collected with the backlog locked once.
+     */
+    std::vector<data_read_ptr<const fep3::arya::IDataSample>> readSamplesBetween(
+        fep3::arya::Timestamp lower_bound, fep3::arya::Timestamp upper_bound) const
+    {
+        return _sample_queue.readSamplesBetween(lower_bound, upper_bound);
+    }
+
+    /**
+     * @brief reads all samples with a timestamp within [lower_bound, upper_bound) into
+     * @p samples reusing its memory
+     *
+     * @param[out] samples the snapshot of the samples from oldest to latest
+     * @param lower_bound inclusive lower bound of the sample timestamps
+     * @param upper_bound exclusive upper bound of the sample timestamps
+     * @remark Periodic reads do not allocate once @p samples has grown to the range size.
+     */
+    void readSamplesBetween(std::vector<data_read_ptr<const fep3::arya::IDataSample>>& samples,
+                            fep3::arya::Timestamp lower_bound,
+                            fep3::arya::Timestamp upper_bound) const
+    {
+        _sample_queue.readSamplesBetween(samples, lower_bound, upper_bound);
+    }
+
+    /**
+     * @brief reads the latest samples
+     *
+     * @param count the maximum number of samples to read
+     * @return std::vector<data_read_ptr<const IDataSample>> the samples from oldest to latest
+     * @remark The samples are collected with the backlog locked once.
+     */
+    std::vector<data_read_ptr<const fep3::arya::IDataSample>> readSamplesLatest(size_t count) const
+    {
+        return _sample_queue.readSamplesLatest(count);
+    }
+
+    /**
+     * @brief reads the latest samples into @p samples reusing its memory
+     *
+     * @param[out] samples the snapshot of the samples from oldest to latest
+     * @param count the maximum number of samples to read
+     * @remark Periodic reads do not allocate once @p samples has grown to @p count.
+     */
+    void readSamplesLatest(std::vector<data_read_ptr<const fep3::arya::IDataSample>>& samples,
+                           size_t count) const
+    {
+        _sample_queue.readSamplesLatest(samples, count);
     }
 
     /**
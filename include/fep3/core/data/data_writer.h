@@ -17,6 +17,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/components/base/components_intf.h>
 #include <fep3/components/clock/clock_service_intf.h>
 #include <fep3/components/data_registry/data_registry_intf.h>
+#include <fep3/components/data_registry/data_registry_loan_intf.h>
 
 namespace fep3 {
 namespace core {
@@ -27,6 +28,16 @@ constexpr size_t DATA_WRITER_QUEUE_SIZE_DYNAMIC = 0;
 /// Value for queue capacity definition if static queue size is chosen
 constexpr size_t DATA_WRITER_QUEUE_SIZE_DEFAULT = 1;
 
+/**
+ * @brief Writable memory of a sample which is written in place, see @ref DataWriter::beginWrite
+ */
+struct DataWriteSpan {
+    /// the writable memory, nullptr if no sample can be written
+    void* data = nullptr;
+    /// the size of the writable memory in bytes
+    size_t size = 0;
+};
+
 /**
  * @brief Data Writer helper class to write data to a fep3::IDataRegistry::IDataWriter
  * if registered to the fep3::IDataRegistry
@@ -179,6 +190,34 @@ public:
      */
     fep3::Result write(fep3::arya::Timestamp time, const void* data, size_t data_size);
 
+    /**
+     * @brief begins writing a sample of @p size bytes in place
+     * The memory is loaned from the simulation bus if the connected IDataWriter supports
+     * loaning (see @ref fep3::arya::IDataRegistryLoaningWriter), so the sample is passed on without
+     * being copied. Otherwise the memory is a buffer of this writer, which is copied on
+     * @ref endWrite like a sample written by @ref write.
+     * A sample begun before and not ended yet is discarded.
+     *
+     * @param[in] size size in bytes of the sample to write
+     * @return DataWriteSpan the memory to write the sample to, which is valid until
+     * @ref endWrite is called. Its data is nullptr if the writer is not connected.
+     */
+    DataWriteSpan beginWrite(size_t size);
+
+    /**
+     * @brief ends writing the sample begun by @ref beginWrite and writes it to the connected
+     * IDataWriter
+     * If a clock time getter was set before via @ref addClockTimeGetter and @p time is zero, the
+     * timestamp is set to the current time of the clock.
+     *
+     * @param[in] time the time of the sample (usually simulation time)
+     * @return fep3::Result
+     * @retval ERR_INVALID_STATE no sample has been begun by @ref beginWrite
+     * @retval ERR_NOT_CONNECTED the writer has been removed from the data registry
+     * @see IDataRegistry::IDataWriter::write
+     */
+    fep3::Result endWrite(fep3::arya::Timestamp time = fep3::arya::Timestamp(0));
+
     /**
      * @brief will flush the writers queue
      *        usually this is called while the executeDataOut call of the scheduler!
@@ -217,6 +256,13 @@ private:
     std::function<fep3::Timestamp()> _clock_service_time_getter;
 
     uint32_t _counter = 0;
+
+    /// whether a sample has been begun by beginWrite
+    bool _write_pending = false;
+    /// the sample loaned by beginWrite, nullptr if the connected writer does not loan samples
+    std::shared_ptr<fep3::arya::ILoanedDataSample> _loaned_sample;
+    /// the memory written in place if the connected writer does not loan samples
+    std::vector<uint8_t> _write_buffer;
 };
 
 /**
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/core/data/data_reader.h>
+
+#include <memory>
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+/**
+ * @brief Interpolation of a numeric ddl element between two consecutive samples
+ */
+enum class Interpolation
+{
+    /// the value of the latest sample not after the requested time is kept
+    zero_order_hold,
+    /// the value is interpolated linearly between the samples around the requested time
+    linear
+};
+
+/**
+ * @brief Data Reader helper class to read samples of a ddl struct type at arbitrary timestamps,
+ * e.g. if the reading job runs at a different rate than the writing one.
+ *
+ * The layout of the ddl struct is resolved from the ddl description of the stream type.
+ * Every numeric element, including static arrays of numeric elements, is either interpolated
+ * linearly or held from the latest sample. All other elements are held from the latest sample.
+ * Requested timestamps before the oldest or after the latest sample of the backlog are clamped
+ * to these samples.
+ */
+class InterpolatingDataReader : public DataReader {
+public:
+    /**
+     * @brief Construct a new Interpolating Data Reader
+     *
+     * @param[in] name name of incoming data
+     * @param[in] stream_type ddl type of incoming data
+     * @param[in] queue_size size of the data reader's sample backlog, has to be at least 2 to
+     * interpolate between samples
+     * @param[in] default_interpolation interpolation of all numeric elements not configured by
+     * @ref setInterpolation
+     * @param[in] time_comparator comparator for sample timestamp and simulation time to check
+     * sample validity
+     */
+    InterpolatingDataReader(
+        std::string name,
+        const fep3::base::arya::StreamType& stream_type,
+        size_t queue_size,
+        Interpolation default_interpolation = Interpolation::linear,
+        const std::function<bool(fep3::Timestamp, fep3::Timestamp)>& time_comparator =
+            std::less<fep3::Timestamp>{});
+
+    /**
+     * @brief DTOR
+     */
+    ~InterpolatingDataReader();
+
+    /**
+     * @brief sets the interpolation of a numeric element
+     *
+     * @param[in] element_name name of the element, elements of nested structs are separated by '.'
+     * @param[in] interpolation the interpolation of the element
+     * @return fep3::Result
+     * @retval ERR_NOT_FOUND the stream type contains no numeric element @p element_name
+     * @retval ERR_INVALID_ARG the element can not be interpolated linearly, e.g. a tBool
+     * @retval ERR_INVALID_TYPE the stream type is not a valid ddl struct type
+     */
+    fep3::Result setInterpolation(const std::string& element_name, Interpolation interpolation);
+
+    /**
+     * @brief reads a sample interpolated at the given time from the samples of the backlog
+     *
+     * @param[in] time the time to interpolate the sample at
+     * @return data_read_ptr<const IDataSample>
+     * @retval valid pointer the interpolated sample with timestamp @p time
+     * @retval invalid pointer the backlog is empty
+     * @remark If the stream type can not be interpolated, the sample valid at @p time is returned.
+     * @remark Not thread safe, the reader shall be read from one thread only.
+     */
+    data_read_ptr<const fep3::arya::IDataSample> readSampleInterpolated(
+        fep3::arya::Timestamp time);
+
+private:
+    /// @cond nodoc
+    class Implementation;
+    std::unique_ptr<Implementation> _impl;
+    /// @endcond
+};
+
+} // namespace arya
+using arya::Interpolation;
+using arya::InterpolatingDataReader;
+} // namespace core
+} // namespace fep3
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/core/data/data_reader.h>
+#include <fep3/core/data/typed_data_sample.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+/**
+ * @brief Data Reader helper class to read values of a trivially copyable type.
+ *
+ * The stream type is provided by @ref StreamTypeTraits at compile time. Received samples are
+ * copied once into pooled samples of sizeof(T) bytes, which hand out their value by reference.
+ * Received samples of another size are dropped.
+ *
+ * @tparam T the type of the values
+ */
+template <typename T>
+class TypedDataReader : public DataReader {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "TypedDataReader requires a trivially copyable type");
+
+public:
+    /// the type of the samples read
+    using SampleType = TypedDataSample<T>;
+
+    /**
+     * @brief Construct a new Typed Data Reader
+     *
+     * @param[in] name name of incoming data
+     * @param[in] queue_size size of the data reader's sample backlog
+     * @param[in] time_comparator comparator for sample timestamp and simulation time to check
+     * sample validity
+     */
+    TypedDataReader(std::string name,
+                    size_t queue_size,
+                    const std::function<bool(fep3::Timestamp, fep3::Timestamp)>& time_comparator =
+                        std::less<fep3::Timestamp>{})
+        : DataReader(std::move(name),
+                     StreamTypeTraits<T>::getStreamType(),
+                     queue_size,
+                     time_comparator)
+    {
+    }
+
+    using DataReader::operator();
+
+    /**
+     * @brief Receives a data sample item and copies it into a pooled typed sample
+     *
+     * @param[in] sample The received data sample
+     */
+    void operator()(const data_read_ptr<const fep3::arya::IDataSample>& sample) override
+    {
+        auto typed_sample = acquireSample();
+        if (sample->read(*typed_sample) != sizeof(T)) {
+            return;
+        }
+        typed_sample->setTime(sample->getTime());
+        typed_sample->setCounter(sample->getCounter());
+        onSampleReceived(*typed_sample);
+        DataReader::operator()(
+            data_read_ptr<const fep3::arya::IDataSample>(std::move(typed_sample)));
+    }
+
+    /**
+     * @brief reads the latest sample available
+     *
+     * @return data_read_ptr<const SampleType> the sample or nullptr if the backlog is empty
+     */
+    data_read_ptr<const SampleType> readLatest() const
+    {
+        return toTypedSample(readSampleLatest());
+    }
+
+    /**
+     * @brief reads the oldest sample available
+     *
+     * @return data_read_ptr<const SampleType> the sample or nullptr if the backlog is empty
+     */
+    data_read_ptr<const SampleType> readOldest()
+    {
+        return toTypedSample(readSampleOldest());
+    }
+
+    /**
+     * @brief pops the latest sample available
+     *
+     * @return data_read_ptr<const SampleType> the sample or nullptr if the backlog is empty
+     */
+    data_read_ptr<const SampleType> popLatest()
+    {
+        return toTypedSample(popSampleLatest());
+    }
+
+    /**
+     * @brief pops the oldest sample available
+     *
+     * @return data_read_ptr<const SampleType> the sample or nullptr if the backlog is empty
+     */
+    data_read_ptr<const SampleType> popOldest()
+    {
+        return toTypedSample(popSampleOldest());
+    }
+
+    /**
+     * @brief reads the latest sample with a timestamp below @p upper_bound
+     *
+     * @param[in] upper_bound time looking for
+     * @return data_read_ptr<const SampleType> the sample or nullptr if there is none
+     */
+    data_read_ptr<const SampleType> readBefore(fep3::arya::Timestamp upper_bound) const
+    {
+        return toTypedSample(readSampleBefore(upper_bound));
+    }
+
+    /**
+     * @brief reads the latest sample with a timestamp not after @p time
+     *
+     * @param[in] time time looking for
+     * @return data_read_ptr<const SampleType> the sample or nullptr if there is none
+     */
+    data_read_ptr<const SampleType> readAt(fep3::arya::Timestamp time) const
+    {
+        return toTypedSample(readSampleAt(time));
+    }
+
+protected:
+    /**
+     * @brief Called for every sample received with sizeof(T) bytes before it is added to the
+     * backlog
+     *
+     * @param[in] sample the received sample
+     */
+    virtual void onSampleReceived(const SampleType& /*sample*/)
+    {
+    }
+
+private:
+    /// free samples, shared with the deleters of the samples in use
+    struct SamplePool {
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<SampleType>> _free_samples;
+    };
+
+    std::shared_ptr<SampleType> acquireSample()
+    {
+        std::unique_ptr<SampleType> sample;
+        {
+            std::lock_guard<std::mutex> lock(_pool->_mutex);
+            if (!_pool->_free_samples.empty()) {
+                sample = std::move(_pool->_free_samples.back());
+                _pool->_free_samples.pop_back();
+            }
+        }
+        if (!sample) {
+            sample = std::make_unique<SampleType>();
+        }
+        // the samples return to the pool once released by the backlog and all readers
+        return std::shared_ptr<SampleType>(sample.release(),
+                                           [pool = _pool](SampleType* released_sample) {
+                                               std::unique_ptr<SampleType> free_sample(
+                                                   released_sample);
+                                               std::lock_guard<std::mutex> lock(pool->_mutex);
+                                               pool->_free_samples.push_back(
+                                                   std::move(free_sample));
+                                           });
+    }
+
+    static data_read_ptr<const SampleType> toTypedSample(
+        const data_read_ptr<const fep3::arya::IDataSample>& sample)
+    {
+        // the backlog contains typed samples only, see operator()
+        return std::static_pointer_cast<const SampleType>(sample);
+    }
+
+    std::shared_ptr<SamplePool> _pool{std::make_shared<SamplePool>()};
+};
+
+} // namespace arya
+using arya::TypedDataReader;
+} // namespace core
+} // namespace fep3
@@ -0,0 +1,194 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/default_stream_type.h>
+
+#include <cstring>
+#include <type_traits>
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+/// @cond nodoc
+namespace detail {
+template <typename T>
+struct AlwaysFalse : std::false_type {
+};
+
+template <typename T>
+using IsPlainType = std::disjunction<std::is_same<T, int8_t>,
+                                     std::is_same<T, int16_t>,
+                                     std::is_same<T, int32_t>,
+                                     std::is_same<T, int64_t>,
+                                     std::is_same<T, uint8_t>,
+                                     std::is_same<T, uint16_t>,
+                                     std::is_same<T, uint32_t>,
+                                     std::is_same<T, uint64_t>,
+                                     std::is_same<T, float>,
+                                     std::is_same<T, double>>;
+} // namespace detail
+/// @endcond
+
+/**
+ * @brief Traits providing the stream type of a type written and read by
+ * @ref TypedDataWriter and @ref TypedDataReader.
+ *
+ * The stream type is provided for
+ * @li plain c types as @ref fep3::base::arya::StreamTypePlain
+ * @li types providing the static members @c ddl_struct and @c ddl_description as
+ *     @ref fep3::base::arya::StreamTypeDDL
+ *
+ * Specialize the traits to provide the stream type of any other type.
+ *
+ * @tparam T the type
+ */
+template <typename T, typename Enable = void>
+struct StreamTypeTraits {
+    static_assert(detail::AlwaysFalse<T>::value,
+                  "No stream type available, provide the static members ddl_struct and "
+                  "ddl_description or specialize fep3::core::StreamTypeTraits");
+};
+
+/// @cond nodoc
+template <typename T>
+struct StreamTypeTraits<T, std::enable_if_t<detail::IsPlainType<T>::value>> {
+    static fep3::base::arya::StreamType getStreamType()
+    {
+        return fep3::base::arya::StreamTypePlain<T>();
+    }
+};
+
+template <typename T>
+struct StreamTypeTraits<T, std::void_t<decltype(T::ddl_struct), decltype(T::ddl_description)>> {
+    static fep3::base::arya::StreamType getStreamType()
+    {
+        return fep3::base::arya::StreamTypeDDL(T::ddl_struct, T::ddl_description);
+    }
+};
+/// @endcond
+
+/**
+ * @brief Data sample holding a value of a trivially copyable type.
+ * The value is accessible without copying and the sample is of fixed size, so no size has to be
+ * checked when the sample is read.
+ *
+ * @tparam T the type of the value
+ */
+template <typename T>
+class TypedDataSample final : public fep3::base::arya::DataSampleBase,
+                              public fep3::arya::IRawMemory {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "TypedDataSample requires a trivially copyable type");
+
+public:
+    /**
+     * @brief Construct a new Typed Data Sample with a value initialized value
+     */
+    TypedDataSample() = default;
+
+    /**
+     * @brief Construct a new Typed Data Sample
+     *
+     * @param[in] value the value of the sample
+     * @param[in] time the timestamp of the sample
+     * @param[in] counter the counter of the sample
+     */
+    explicit TypedDataSample(const T& value,
+                             fep3::arya::Timestamp time = fep3::arya::Timestamp(0),
+                             uint32_t counter = 0)
+        : DataSampleBase(time, counter), _value(value)
+    {
+    }
+
+    /**
+     * @brief gets the value of the sample
+     *
+     * @return const T& the value
+     */
+    const T& getValue() const
+    {
+        return _value;
+    }
+
+    /**
+     * @brief sets the value of the sample
+     *
+     * @param[in] value the value
+     */
+    void setValue(const T& value)
+    {
+        _value = value;
+    }
+
+public:
+    size_t capacity() const override
+    {
+        return sizeof(T);
+    }
+
+    const void* cdata() const override
+    {
+        return &_value;
+    }
+
+    size_t size() const override
+    {
+        return sizeof(T);
+    }
+
+    /**
+     * @copydoc fep3::arya::IRawMemory::set
+     * @remark memory of a size other than sizeof(T) is not copied and 0 is returned
+     */
+    size_t set(const void* data, size_t data_size) override
+    {
+        if (sizeof(T) != data_size) {
+            return 0;
+        }
+        std::memcpy(&_value, data, sizeof(T));
+        return sizeof(T);
+    }
+
+    size_t resize(size_t /*data_size*/) override
+    {
+        return sizeof(T);
+    }
+
+public:
+    size_t getSize() const override
+    {
+        return sizeof(T);
+    }
+
+    size_t read(fep3::arya::IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(&_value, sizeof(T));
+    }
+
+    size_t write(const fep3::arya::IRawMemory& from_memory) override
+    {
+        return set(from_memory.cdata(), from_memory.size());
+    }
+
+private:
+    T _value{};
+};
+
+} // namespace arya
+using arya::StreamTypeTraits;
+using arya::TypedDataSample;
+} // namespace core
+} // namespace fep3
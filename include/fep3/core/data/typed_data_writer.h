@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/core/data/data_writer.h>
+#include <fep3/core/data/typed_data_sample.h>
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+/**
+ * @brief Data Writer helper class to write values of a trivially copyable type.
+ *
+ * The stream type is provided by @ref StreamTypeTraits at compile time. Values are written in
+ * place into samples of sizeof(T) bytes, see @ref DataWriter::beginWrite.
+ *
+ * @tparam T the type of the values
+ */
+template <typename T>
+class TypedDataWriter : public DataWriter {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "TypedDataWriter requires a trivially copyable type");
+
+public:
+    /**
+     * @brief Construct a new Typed Data Writer
+     *
+     * @param[in] name name of outgoing data
+     * @param[in] queue_capacity capacity of the writer's queue, @ref DATA_WRITER_QUEUE_SIZE_DYNAMIC
+     * for a dynamic queue
+     */
+    explicit TypedDataWriter(std::string name,
+                             size_t queue_capacity = DATA_WRITER_QUEUE_SIZE_DYNAMIC)
+        : DataWriter(std::move(name), StreamTypeTraits<T>::getStreamType(), queue_capacity)
+    {
+    }
+
+    using DataWriter::write;
+
+    /**
+     * @brief writes a value
+     *
+     * @param[in] value the value to write
+     * @param[in] time the timestamp of the value, 0 to use the time of the clock if the writer has
+     * been added to the components
+     * @return fep3::Result
+     * @retval ERR_NOT_CONNECTED the writer has not been added to a data registry
+     * @remark Not thread safe, the writer shall be written from one thread only.
+     */
+    fep3::Result write(const T& value, fep3::arya::Timestamp time = fep3::arya::Timestamp(0))
+    {
+        const auto memory = beginWrite(sizeof(T));
+        if (!memory.data) {
+            RETURN_ERROR_DESCRIPTION(fep3::ERR_NOT_CONNECTED, "not connected");
+        }
+        std::memcpy(memory.data, &value, sizeof(T));
+        return endWrite(time);
+    }
+};
+
+} // namespace arya
+using arya::TypedDataWriter;
+} // namespace core
+} // namespace fep3
@@ -0,0 +1,290 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/core/data/typed_data_reader.h>
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+template <typename T>
+class WindowedDataReader;
+
+/**
+ * @brief Copy of the latest values received by a @ref WindowedDataReader.
+ * The values and their timestamps are contiguous and ordered from oldest to latest.
+ * The window does not change with samples received by the reader after it has been read.
+ * Pass the same window to every read of the reader to reuse its memory, so reading a window
+ * does not allocate once the window has been filled.
+ *
+ * @tparam T the type of the values
+ */
+template <typename T>
+class SampleWindow {
+public:
+    /**
+     * @brief gets the number of values in the window
+     *
+     * @return size_t the number of values
+     */
+    size_t size() const
+    {
+        return _values.size();
+    }
+
+    /**
+     * @brief checks whether the window is empty
+     *
+     * @return @c true if the window contains no values, @c false otherwise
+     */
+    bool empty() const
+    {
+        return _values.empty();
+    }
+
+    /**
+     * @brief gets the contiguous values of the window
+     *
+     * @return const T* the oldest value, followed by @ref size - 1 later values
+     */
+    const T* values() const
+    {
+        return _values.data();
+    }
+
+    /**
+     * @brief gets the contiguous timestamps of the values of the window
+     *
+     * @return const fep3::arya::Timestamp* the timestamp of the oldest value, followed by the
+     * timestamps of @ref size - 1 later values
+     */
+    const fep3::arya::Timestamp* times() const
+    {
+        return _times.data();
+    }
+
+    /**
+     * @brief gets a value of the window
+     *
+     * @param[in] index the index of the value, 0 for the oldest value
+     * @return const T& the value
+     */
+    const T& operator[](size_t index) const
+    {
+        return _values[index];
+    }
+
+    /// @cond nodoc
+    const T* begin() const
+    {
+        return _values.data();
+    }
+
+    const T* end() const
+    {
+        return _values.data() + _values.size();
+    }
+    /// @endcond
+
+private:
+    friend class WindowedDataReader<T>;
+
+    std::vector<T> _values;
+    std::vector<fep3::arya::Timestamp> _times;
+};
+
+/**
+ * @brief Data Reader helper class to read the latest values of a trivially copyable type as a
+ * sliding window.
+ *
+ * Received values are stored in a ring buffer of window_size values in addition to the backlog of
+ * the reader. Reading a window copies the latest values into a @ref SampleWindow, the ring buffer
+ * is locked only while the values are copied.
+ *
+ * @tparam T the type of the values
+ */
+template <typename T>
+class WindowedDataReader : public TypedDataReader<T> {
+public:
+    /**
+     * @brief Construct a new Windowed Data Reader
+     *
+     * @param[in] name name of incoming data
+     * @param[in] window_size the maximum number of values in the window, at least 1
+     * @param[in] queue_size size of the data reader's sample backlog
+     * @param[in] time_comparator comparator for sample timestamp and simulation time to check
+     * sample validity
+     */
+    WindowedDataReader(std::string name,
+                       size_t window_size,
+                       size_t queue_size = 1,
+                       const std::function<bool(fep3::Timestamp, fep3::Timestamp)>&
+                           time_comparator = std::less<fep3::Timestamp>{})
+        : TypedDataReader<T>(std::move(name), queue_size, time_comparator),
+          _window_size(std::max(window_size, size_t(1))),
+          _values(_window_size),
+          _times(_window_size)
+    {
+    }
+
+    /**
+     * @brief gets the maximum number of values in the window
+     *
+     * @return size_t the window size
+     */
+    size_t getWindowSize() const
+    {
+        return _window_size;
+    }
+
+    /**
+     * @brief reads the latest values received, at most window size values
+     *
+     * @return SampleWindow<T> the copy of the values
+     */
+    SampleWindow<T> readWindow() const
+    {
+        SampleWindow<T> window;
+        readWindow(window, _window_size);
+        return window;
+    }
+
+    /**
+     * @brief reads the latest values received, at most window size values, into @p window
+     * reusing its memory
+     *
+     * @param[out] window the window to copy the values to
+     */
+    void readWindow(SampleWindow<T>& window) const
+    {
+        readWindow(window, _window_size);
+    }
+
+    /**
+     * @brief reads the latest @p count values received
+     *
+     * @param[in] count the maximum number of values to read, limited to the window size
+     * @return SampleWindow<T> the copy of the values
+     */
+    SampleWindow<T> readWindow(size_t count) const
+    {
+        SampleWindow<T> window;
+        readWindow(window, count);
+        return window;
+    }
+
+    /**
+     * @brief reads the latest @p count values received into @p window reusing its memory
+     *
+     * @param[out] window the window to copy the values to
+     * @param[in] count the maximum number of values to read, limited to the window size
+     */
+    void readWindow(SampleWindow<T>& window, size_t count) const
+    {
+        std::lock_guard<std::mutex> lock(_window_mutex);
+        copyLatest(window, std::min(count, _count));
+    }
+
+    /**
+     * @brief reads the latest values received within @p duration before the latest value,
+     * i.e. the latest values with a timestamp not before the timestamp of the latest value minus
+     * @p duration
+     *
+     * @param[in] duration the duration of the window
+     * @return SampleWindow<T> the copy of the values, limited to the window size
+     */
+    SampleWindow<T> readWindowOf(fep3::arya::Timestamp duration) const
+    {
+        SampleWindow<T> window;
+        readWindowOf(window, duration);
+        return window;
+    }
+
+    /**
+     * @brief reads the latest values received within @p duration before the latest value into
+     * @p window reusing its memory, see @ref readWindowOf(fep3::arya::Timestamp) const
+     *
+     * @param[out] window the window to copy the values to
+     * @param[in] duration the duration of the window
+     */
+    void readWindowOf(SampleWindow<T>& window, fep3::arya::Timestamp duration) const
+    {
+        std::lock_guard<std::mutex> lock(_window_mutex);
+        if (0 == _count) {
+            copyLatest(window, 0);
+            return;
+        }
+        const auto lower_bound = _times[getPosition(1)] - duration;
+        // the window starts at the first value not before the lower bound
+        size_t count = 1;
+        while (count < _count && !(_times[getPosition(count + 1)] < lower_bound)) {
+            ++count;
+        }
+        copyLatest(window, count);
+    }
+
+protected:
+    void onSampleReceived(const typename TypedDataReader<T>::SampleType& sample) override
+    {
+        std::lock_guard<std::mutex> lock(_window_mutex);
+        _values[_next] = sample.getValue();
+        _times[_next] = sample.getTime();
+        _next = (_next + 1) % _window_size;
+        _count = std::min(_count + 1, _window_size);
+    }
+
+private:
+    /// gets the position of the @p age latest value in the ring, 1 for the latest value
+    size_t getPosition(size_t age) const
+    {
+        return (_next + _window_size - age) % _window_size;
+    }
+
+    /// has to be called with the ring buffer locked
+    void copyLatest(SampleWindow<T>& window, size_t count) const
+    {
+        // the latest values end before the next value to write and may wrap around the ring
+        const auto first = static_cast<std::ptrdiff_t>(getPosition(count));
+        const auto first_count =
+            std::min(static_cast<std::ptrdiff_t>(count),
+                     static_cast<std::ptrdiff_t>(_window_size) - first);
+        const auto wrapped_count = static_cast<std::ptrdiff_t>(count) - first_count;
+        window._values.assign(_values.cbegin() + first, _values.cbegin() + first + first_count);
+        window._values.insert(
+            window._values.end(), _values.cbegin(), _values.cbegin() + wrapped_count);
+        window._times.assign(_times.cbegin() + first, _times.cbegin() + first + first_count);
+        window._times.insert(window._times.end(), _times.cbegin(), _times.cbegin() + wrapped_count);
+    }
+
+    const size_t _window_size;
+    /// the ring buffer of the values
+    std::vector<T> _values;
+    /// the timestamps of the values
+    std::vector<fep3::arya::Timestamp> _times;
+    /// the position of the next value to write within [0, _window_size)
+    size_t _next{0};
+    /// the number of values in the window
+    size_t _count{0};
+    mutable std::mutex _window_mutex;
+};
+
+} // namespace arya
+using arya::SampleWindow;
+using arya::WindowedDataReader;
+} // namespace core
+} // namespace fep3
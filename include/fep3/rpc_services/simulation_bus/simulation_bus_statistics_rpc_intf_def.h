@@ -0,0 +1,40 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#ifndef _FEP3_RPC_SIMULATIONBUS_STATISTICS_INTF_DEF_H_
+#define _FEP3_RPC_SIMULATIONBUS_STATISTICS_INTF_DEF_H_
+
+// very important to have this relative! system library!
+#include "../base/fep_rpc_iid.h"
+
+namespace fep3 {
+namespace rpc {
+namespace catelyn {
+/**
+ * @brief definition of the external service interface of the simulation bus statistics
+ * @see simulation_bus_statistics.json file
+ */
+class IRPCSimulationBusStatisticsDef {
+protected:
+    /// DTOR
+    ~IRPCSimulationBusStatisticsDef() = default;
+
+public:
+    /// definition of the FEP rpc service iid of the simulation bus statistics
+    FEP_RPC_IID("simulation_bus_statistics.catelyn.fep3.iid", "simulation_bus_statistics");
+};
+} // namespace catelyn
+using catelyn::IRPCSimulationBusStatisticsDef;
+} // namespace rpc
+} // namespace fep3
+
+#endif //_FEP3_RPC_SIMULATIONBUS_STATISTICS_INTF_DEF_H_
@@ -15,7 +15,11 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <boost/circular_buffer.hpp>
 #include <boost/foreach.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <mutex>
+#include <vector>
 
 namespace fep3 {
 namespace base {
@@ -28,8 +32,111 @@ public:
     {
     }
 
+    /// publishes the time of the first sample, must be called with the queue locked
+    void updateFrontSampleTime()
+    {
+        auto front_sample_time = no_sample_time;
+        for (const DataItem& item: _items) {
+            if (DataItem::Type::sample == item.getItemType()) {
+                front_sample_time = item.getSample()->getTime().count();
+                break;
+            }
+        }
+        _front_sample_time.store(front_sample_time, std::memory_order_release);
+    }
+
+    /// appends an item and drops the front item if the capacity is reached, must be called with
+    /// the queue locked
+    void pushBack(DataItem&& item)
+    {
+        if (_items.full()) {
+            popFront();
+        }
+        if (!_items.empty() && item.getTime() < _items.back().getTime()) {
+            ++_time_order_violations;
+        }
+        _items.push_back(std::move(item));
+    }
+
+    /// removes the front item, must be called with the queue locked
+    void popFront()
+    {
+        if (_items.size() > 1 && _items[1].getTime() < _items[0].getTime()) {
+            --_time_order_violations;
+        }
+        _items.pop_front();
+    }
+
+    /// removes the back item, must be called with the queue locked
+    void popBack()
+    {
+        const auto size = _items.size();
+        if (size > 1 && _items[size - 1].getTime() < _items[size - 2].getTime()) {
+            --_time_order_violations;
+        }
+        _items.pop_back();
+    }
+
+    /// removes all items, must be called with the queue locked
+    void clear()
+    {
+        _items.clear();
+        _time_order_violations = 0;
+    }
+
+    /**
+     * reads the latest sample whose time fulfills @p is_before, must be called with the queue
+     * locked. If the items are ordered by time, the items fulfilling @p is_before are found by
+     * binary search, otherwise all items are searched backwards.
+     */
+    template <typename IS_BEFORE>
+    data_read_ptr<SAMPLE_TYPE> readLatestSample(IS_BEFORE is_before) const
+    {
+        auto end = _items.end();
+        if (0 == _time_order_violations) {
+            end = std::partition_point(_items.begin(), end, [&is_before](const DataItem& item) {
+                return is_before(item.getTime());
+            });
+        }
+        for (auto item = end; item != _items.begin();) {
+            --item;
+            if (DataItem::Type::sample == item->getItemType() && is_before(item->getTime())) {
+                return item->getSample();
+            }
+        }
+        return {};
+    }
+
+    /**
+     * reads the earliest sample whose time fulfills @p is_after, must be called with the queue
+     * locked. If the items are ordered by time, the items not fulfilling @p is_after are skipped by
+     * binary search, otherwise all items are searched forwards.
+     */
+    template <typename IS_AFTER>
+    data_read_ptr<SAMPLE_TYPE> readEarliestSample(IS_AFTER is_after) const
+    {
+        auto begin = _items.begin();
+        if (0 == _time_order_violations) {
+            begin = std::partition_point(begin, _items.end(), [&is_after](const DataItem& item) {
+                return !is_after(item.getTime());
+            });
+        }
+        for (auto item = begin; item != _items.end(); ++item) {
+            if (DataItem::Type::sample == item->getItemType() && is_after(item->getTime())) {
+                return item->getSample();
+            }
+        }
+        return {};
+    }
+
+    static constexpr int64_t no_sample_time = std::numeric_limits<int64_t>::min();
+
     boost::circular_buffer<DataItem> _items;
+    // count of adjacent items whose times are descending, the items are ordered by time if 0
+    size_t _time_order_violations{0};
     mutable std::recursive_mutex _recursive_mutex;
+    // time of the first sample within _items, read by nextTime without locking
+    std::atomic<int64_t> _front_sample_time{no_sample_time};
 };
 
 DataItemQueue::DataItemQueue(size_t capacity)
@@ -45,7 +152,15 @@ void DataItemQueue::pushSample(const data_read_ptr<SAMPLE_TYPE>& sample,
                                fep3::arya::Timestamp time_of_receiving)
 {
     std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
-    _impl->_items.push_back({sample, time_of_receiving});
+    const bool drops_front = _impl->_items.full();
+    _impl->pushBack({sample, time_of_receiving});
+    if (drops_front) {
+        _impl->updateFrontSampleTime();
+    }
+    else if (_impl->_front_sample_time.load(std::memory_order_relaxed) ==
+             Implementation::no_sample_time) {
+        _impl->_front_sample_time.store(sample->getTime().count(), std::memory_order_release);
+    }
 }
 
 ///@copydoc fep3::base::arya::detail::DataItemQueueBase::pushType
@@ -53,20 +168,22 @@ void DataItemQueue::pushType(const data_read_ptr<STREAM_TYPE>& type,
                              fep3::arya::Timestamp time_of_receiving)
 {
     std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
-    _impl->_items.push_back({type, time_of_receiving});
+    const bool drops_front = _impl->_items.full();
+    _impl->pushBack({type, time_of_receiving});
+    if (drops_front) {
+        _impl->updateFrontSampleTime();
+    }
 }
 
 ///@copydoc fep3::base::arya::detail::DataItemQueueBase::nextTime
 fep3::arya::Optional<fep3::arya::Timestamp> DataItemQueue::nextTime()
 {
-    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
-    for (auto it = _impl->_items.begin(); it != _impl->_items.end(); ++it) {
-        DataItem& ref = *it;
-        if (DataItem::Type::sample == ref.getItemType()) {
-            return ref.getSample()->getTime();
-        }
+    // lock-free, the time is published on every change of the first sample
+    const auto front_sample_time = _impl->_front_sample_time.load(std::memory_order_acquire);
+    if (front_sample_time == Implementation::no_sample_time) {
+        return {};
     }
-    return {};
+    return fep3::arya::Timestamp(front_sample_time);
 }
 
 ///@copydoc fep3::base::arya::detail::DataItemQueueBase::pop
@@ -75,7 +192,8 @@ bool DataItemQueue::pop()
     std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
 
     if (_impl->_items.size() > 0) {
-        _impl->_items.pop_back();
+        _impl->popBack();
+        _impl->updateFrontSampleTime();
         return true;
     }
     return false;
@@ -98,7 +216,8 @@ bool DataItemQueue::popFront(
             data_item.resetStreamType();
         }
 
-        _impl->_items.pop_front();
+        _impl->popFront();
+        _impl->updateFrontSampleTime();
 
         return true;
     }
@@ -127,13 +246,60 @@ DataItemQueue::popFront()
                 data_item.resetStreamType();
             }
 
-            _impl->_items.pop_front();
+            _impl->popFront();
+            _impl->updateFrontSampleTime();
         }
     }
 
     return std::make_tuple(std::move(sample), std::move(stream_type));
 }
 
+size_t DataItemQueue::popFrontUntil(
+    fep3::arya::Timestamp time,
+    const std::function<bool(fep3::arya::Timestamp, fep3::arya::Timestamp)>& time_comparator,
+    typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::IDataItemReceiver& receiver)
+{
+    // the due items are moved out of the queue within one lock and passed to the receiver after
+    // unlocking, so the receiver does not block the writers of the queue
+    std::vector<DataItem> due_items;
+    {
+        std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+        // pop up to the last due sample in front of the first sample which is not due, stream
+        // types behind the last due sample are kept just like nextTime skips them
+        size_t item_count = 0;
+        for (size_t index = 0; index < _impl->_items.size(); ++index) {
+            const DataItem& data_item = _impl->_items[index];
+            if (DataItem::Type::sample == data_item.getItemType()) {
+                if (!time_comparator(data_item.getSample()->getTime(), time)) {
+                    break;
+                }
+                item_count = index + 1;
+            }
+        }
+
+        due_items.reserve(item_count);
+        for (size_t index = 0; index < item_count; ++index) {
+            due_items.push_back(std::move(_impl->_items.front()));
+            _impl->popFront();
+        }
+        if (item_count > 0) {
+            _impl->updateFrontSampleTime();
+        }
+    }
+
+    for (const DataItem& data_item: due_items) {
+        if (DataItem::Type::sample == data_item.getItemType()) {
+            receiver.onReceive(data_item.getSample());
+        }
+        else if (DataItem::Type::type == data_item.getItemType()) {
+            receiver.onReceive(data_item.getStreamType());
+        }
+    }
+
+    return due_items.size();
+}
+
 ///@copydoc fep3::base::arya::detail::DataItemQueueBase::popBack
 bool DataItemQueue::popBack(
     typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::IDataItemReceiver& receiver)
@@ -151,7 +317,8 @@ bool DataItemQueue::popBack(
             data_item.resetStreamType();
         }
 
-        _impl->_items.pop_back();
+        _impl->popBack();
+        _impl->updateFrontSampleTime();
         return true;
     }
 
@@ -178,7 +345,8 @@ DataItemQueue::popBack()
                 stream_type = std::move(data_item.getStreamType());
                 data_item.resetStreamType();
             }
-            _impl->_items.pop_back();
+            _impl->popBack();
+            _impl->updateFrontSampleTime();
         }
     }
 
@@ -276,7 +444,8 @@ void DataItemQueue::clear()
 {
     std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
 
-    _impl->_items.clear();
+    _impl->clear();
+    _impl->_front_sample_time.store(Implementation::no_sample_time, std::memory_order_release);
 }
 
 ///@copydoc fep3::base::arya::detail::DataItemQueueBase::getQueueType
@@ -302,6 +471,99 @@ size_t DataItemQueue::setCapacity(size_t queue_size)
     return queue_size;
 }
 
+data_read_ptr<DataItemQueue::SAMPLE_TYPE> DataItemQueue::readSampleBefore(
+    fep3::arya::Timestamp upper_bound) const
+{
+    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+    return _impl->readLatestSample(
+        [upper_bound](fep3::arya::Timestamp time) { return time < upper_bound; });
+}
+
+data_read_ptr<DataItemQueue::SAMPLE_TYPE> DataItemQueue::readSampleAt(
+    fep3::arya::Timestamp time) const
+{
+    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+    return _impl->readLatestSample(
+        [time](fep3::arya::Timestamp item_time) { return item_time <= time; });
+}
+
+data_read_ptr<DataItemQueue::SAMPLE_TYPE> DataItemQueue::readSampleAfter(
+    fep3::arya::Timestamp lower_bound) const
+{
+    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+    return _impl->readEarliestSample(
+        [lower_bound](fep3::arya::Timestamp time) { return lower_bound < time; });
+}
+
+std::vector<data_read_ptr<DataItemQueue::SAMPLE_TYPE>> DataItemQueue::readSamplesBetween(
+    fep3::arya::Timestamp lower_bound, fep3::arya::Timestamp upper_bound) const
+{
+    std::vector<data_read_ptr<SAMPLE_TYPE>> samples;
+    readSamplesBetween(samples, lower_bound, upper_bound);
+    return samples;
+}
+
+void DataItemQueue::readSamplesBetween(std::vector<data_read_ptr<SAMPLE_TYPE>>& samples,
+                                       fep3::arya::Timestamp lower_bound,
+                                       fep3::arya::Timestamp upper_bound) const
+{
+    samples.clear();
+
+    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+    auto begin = _impl->_items.begin();
+    auto end = _impl->_items.end();
+    if (0 == _impl->_time_order_violations) {
+        begin = std::partition_point(begin, end, [lower_bound](const DataItem& item) {
+            return item.getTime() < lower_bound;
+        });
+        end = std::partition_point(begin, end, [upper_bound](const DataItem& item) {
+            return item.getTime() < upper_bound;
+        });
+        samples.reserve(static_cast<size_t>(std::distance(begin, end)));
+    }
+    for (auto item = begin; item != end; ++item) {
+        if (DataItem::Type::sample == item->getItemType() && lower_bound <= item->getTime() &&
+            item->getTime() < upper_bound) {
+            samples.push_back(item->getSample());
+        }
+    }
+}
+
+std::vector<data_read_ptr<DataItemQueue::SAMPLE_TYPE>> DataItemQueue::readSamplesLatest(
+    size_t count) const
+{
+    std::vector<data_read_ptr<SAMPLE_TYPE>> samples;
+    readSamplesLatest(samples, count);
+    return samples;
+}
+
+void DataItemQueue::readSamplesLatest(std::vector<data_read_ptr<SAMPLE_TYPE>>& samples,
+                                      size_t count) const
+{
+    samples.clear();
+
+    std::lock_guard<std::recursive_mutex> lock_guard(_impl->_recursive_mutex);
+
+    // the samples are collected backwards from the end of the queue
+    auto begin = _impl->_items.end();
+    for (size_t sample_count = 0; begin != _impl->_items.begin() && sample_count < count;) {
+        --begin;
+        if (DataItem::Type::sample == begin->getItemType()) {
+            ++sample_count;
+        }
+    }
+    samples.reserve(static_cast<size_t>(std::distance(begin, _impl->_items.end())));
+    for (auto item = begin; item != _impl->_items.end(); ++item) {
+        if (DataItem::Type::sample == item->getItemType()) {
+            samples.push_back(item->getSample());
+        }
+    }
+}
+
 void DataItemQueue::reverseIteration(
     const std::function<bool(const data_read_ptr<SAMPLE_TYPE>& sample,
                              const data_read_ptr<STREAM_TYPE>& stream_type,
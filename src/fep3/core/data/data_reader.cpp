@@ -12,6 +12,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <fep3/base/data_registry/data_registry.h>
 #include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/components/data_registry/data_registry_batch_intf.h>
 #include <fep3/core/data/data_reader.h>
 
 namespace {
@@ -79,8 +80,14 @@ fep3::Result DataReader::removeFromDataRegistry(fep3::arya::IDataRegistry& data_
 void DataReader::receiveNow(Timestamp time_of_update)
 {
     if (_connected_reader) {
-        while (_connected_reader->getFrontTime() &&
-               _time_comparator(*_connected_reader->getFrontTime(), time_of_update)) {
+        if (auto batch_reader =
+                dynamic_cast<fep3::arya::IDataRegistryBatchReader*>(_connected_reader.get())) {
+            batch_reader->popUntil(time_of_update, _time_comparator, *this);
+            return;
+        }
+        for (auto front_time = _connected_reader->getFrontTime();
+             front_time && _time_comparator(*front_time, time_of_update);
+             front_time = _connected_reader->getFrontTime()) {
             if (!_connected_reader->pop(*this)) {
                 // something went wrong
                 break;
@@ -54,12 +54,14 @@ fep3::Result DataWriter::addClockTimeGetter(
 
 fep3::Result DataWriter::removeFromDataRegistry()
 {
+    _loaned_sample.reset();
     _connected_writer.reset();
     return {};
 }
 
 fep3::Result DataWriter::removeFromDataRegistry(IDataRegistry& data_registry)
 {
+    _loaned_sample.reset();
     _connected_writer.reset();
     return base::removeDataOut(data_registry, _name);
 }
@@ -155,6 +157,53 @@ fep3::Result DataWriter::write(Timestamp time, const void* data, size_t data_siz
     return write(ref_sample);
 }
 
+DataWriteSpan DataWriter::beginWrite(size_t size)
+{
+    _write_pending = false;
+    _loaned_sample.reset();
+    if (!_connected_writer) {
+        return {};
+    }
+    if (auto loaning_writer =
+            dynamic_cast<fep3::arya::IDataRegistryLoaningWriter*>(_connected_writer.get())) {
+        _loaned_sample = loaning_writer->loanSample(size);
+    }
+    _write_pending = true;
+    if (_loaned_sample) {
+        return {_loaned_sample->data(), size};
+    }
+    // the memory can not be loaned, so the sample is copied on endWrite
+    _write_buffer.resize(size);
+    return {_write_buffer.data(), size};
+}
+
+fep3::Result DataWriter::endWrite(Timestamp time)
+{
+    if (!_write_pending) {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_STATE, "no sample begun to write");
+    }
+    _write_pending = false;
+    if (!_connected_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "not connected");
+    }
+    if (!_loaned_sample) {
+        return write(time, _write_buffer.data(), _write_buffer.size());
+    }
+
+    const auto loaned_sample = std::move(_loaned_sample);
+    if (_clock_service_time_getter && time.count() == 0) {
+        time = _clock_service_time_getter();
+    }
+    loaned_sample->setTime(time);
+    loaned_sample->setCounter(_counter++);
+    auto loaning_writer =
+        dynamic_cast<fep3::arya::IDataRegistryLoaningWriter*>(_connected_writer.get());
+    if (!loaning_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "not connected to the loaning writer");
+    }
+    return loaning_writer->commit(loaned_sample);
+}
+
 fep3::Result DataWriter::flushNow(Timestamp)
 {
     return _connected_writer->flush();
@@ -0,0 +1,482 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/core/data/interpolating_data_reader.h>
+
+#include <a_util/filesystem/filesystem.h>
+#include <ddl/dd/dd_typeinfomodel.h>
+#include <ddl/dd/ddstring.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using InterpolateFunction = void (*)(uint8_t* value,
+                                     const uint8_t* next_value,
+                                     size_t count,
+                                     double ratio);
+
+template <typename T>
+void interpolateLinear(uint8_t* value, const uint8_t* next_value, size_t count, double ratio)
+{
+    // single precision values are interpolated in single precision to keep the loop vectorizable,
+    // the values are copied since ddl elements are not necessarily aligned
+    using Calculation = std::conditional_t<std::is_same<T, float>::value, float, double>;
+    const auto factor = static_cast<Calculation>(ratio);
+    for (size_t index = 0; index < count; ++index) {
+        T current{};
+        T next{};
+        std::memcpy(&current, value + index * sizeof(T), sizeof(T));
+        std::memcpy(&next, next_value + index * sizeof(T), sizeof(T));
+        auto interpolated = static_cast<Calculation>(current) +
+                            (static_cast<Calculation>(next) - static_cast<Calculation>(current)) *
+                                factor;
+        if constexpr (std::is_integral<T>::value) {
+            interpolated = std::round(interpolated);
+        }
+        const auto result = static_cast<T>(interpolated);
+        std::memcpy(value + index * sizeof(T), &result, sizeof(T));
+    }
+}
+
+template <typename T>
+void interpolateLinear64(uint8_t* value, const uint8_t* next_value, size_t count, double ratio)
+{
+    // 64 bit integers do not fit into the mantissa of a double, so only the offset from the
+    // current value is calculated in double: the distance is taken in the unsigned domain where it
+    // can not overflow and the offset is clamped to it, so the result stays between both values
+    using Unsigned = std::make_unsigned_t<T>;
+    for (size_t index = 0; index < count; ++index) {
+        T current{};
+        T next{};
+        std::memcpy(&current, value + index * sizeof(T), sizeof(T));
+        std::memcpy(&next, next_value + index * sizeof(T), sizeof(T));
+        const bool ascending = current <= next;
+        const Unsigned distance =
+            ascending ? static_cast<Unsigned>(next) - static_cast<Unsigned>(current)
+                      : static_cast<Unsigned>(current) - static_cast<Unsigned>(next);
+        const auto scaled_distance = std::round(static_cast<double>(distance) * ratio);
+        const Unsigned offset = scaled_distance >= static_cast<double>(distance)
+                                    ? distance
+                                    : std::min(static_cast<Unsigned>(scaled_distance), distance);
+        const auto result =
+            static_cast<T>(ascending ? static_cast<Unsigned>(current) + offset
+                                     : static_cast<Unsigned>(current) - offset);
+        std::memcpy(value + index * sizeof(T), &result, sizeof(T));
+    }
+}
+
+struct NumericType {
+    size_t _size;
+    /// nullptr if values of the type can not be interpolated linearly
+    InterpolateFunction _interpolate;
+};
+
+const NumericType* getNumericType(const std::string& ddl_type_name)
+{
+    // predefined ddl data types and their c type aliases
+    static const std::map<std::string, NumericType> numeric_types{
+        {"tBool", {sizeof(bool), nullptr}},
+        {"bool", {sizeof(bool), nullptr}},
+        {"tChar", {sizeof(char), &interpolateLinear<char>}},
+        {"char", {sizeof(char), &interpolateLinear<char>}},
+        {"tUInt8", {sizeof(uint8_t), &interpolateLinear<uint8_t>}},
+        {"uint8_t", {sizeof(uint8_t), &interpolateLinear<uint8_t>}},
+        {"tInt8", {sizeof(int8_t), &interpolateLinear<int8_t>}},
+        {"int8_t", {sizeof(int8_t), &interpolateLinear<int8_t>}},
+        {"tUInt16", {sizeof(uint16_t), &interpolateLinear<uint16_t>}},
+        {"uint16_t", {sizeof(uint16_t), &interpolateLinear<uint16_t>}},
+        {"tInt16", {sizeof(int16_t), &interpolateLinear<int16_t>}},
+        {"int16_t", {sizeof(int16_t), &interpolateLinear<int16_t>}},
+        {"tUInt32", {sizeof(uint32_t), &interpolateLinear<uint32_t>}},
+        {"uint32_t", {sizeof(uint32_t), &interpolateLinear<uint32_t>}},
+        {"tInt32", {sizeof(int32_t), &interpolateLinear<int32_t>}},
+        {"int32_t", {sizeof(int32_t), &interpolateLinear<int32_t>}},
+        {"tUInt64", {sizeof(uint64_t), &interpolateLinear64<uint64_t>}},
+        {"uint64_t", {sizeof(uint64_t), &interpolateLinear64<uint64_t>}},
+        {"tInt64", {sizeof(int64_t), &interpolateLinear64<int64_t>}},
+        {"int64_t", {sizeof(int64_t), &interpolateLinear64<int64_t>}},
+        {"tFloat32", {sizeof(float), &interpolateLinear<float>}},
+        {"float", {sizeof(float), &interpolateLinear<float>}},
+        {"tFloat64", {sizeof(double), &interpolateLinear<double>}},
+        {"double", {sizeof(double), &interpolateLinear<double>}}};
+
+    const auto found = numeric_types.find(ddl_type_name);
+    return found == numeric_types.end() ? nullptr : &found->second;
+}
+
+/**
+ * Data sample owning its memory which is written in place while interpolating
+ */
+class InterpolatedSample : public fep3::base::arya::DataSampleBase,
+                           public fep3::arya::IRawMemory {
+public:
+    InterpolatedSample(fep3::arya::Timestamp time, uint32_t counter)
+        : DataSampleBase(time, counter)
+    {
+    }
+
+    uint8_t* data()
+    {
+        return _buffer.data();
+    }
+
+    size_t capacity() const override
+    {
+        return _buffer.capacity();
+    }
+
+    const void* cdata() const override
+    {
+        return _buffer.data();
+    }
+
+    size_t size() const override
+    {
+        return _buffer.size();
+    }
+
+    size_t set(const void* data, size_t data_size) override
+    {
+        _buffer.resize(data_size);
+        std::memcpy(_buffer.data(), data, data_size);
+        return data_size;
+    }
+
+    size_t resize(size_t data_size) override
+    {
+        _buffer.resize(data_size);
+        return data_size;
+    }
+
+    size_t getSize() const override
+    {
+        return size();
+    }
+
+    size_t read(fep3::arya::IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(cdata(), size());
+    }
+
+    size_t write(const fep3::arya::IRawMemory& from_memory) override
+    {
+        return set(from_memory.cdata(), from_memory.size());
+    }
+
+private:
+    std::vector<uint8_t> _buffer;
+};
+
+} // namespace
+
+namespace fep3 {
+namespace core {
+namespace arya {
+
+class InterpolatingDataReader::Implementation {
+public:
+    /// element of the ddl struct which is interpolated linearly
+    struct LinearElement {
+        size_t _byte_pos;
+        size_t _count;
+        InterpolateFunction _interpolate;
+    };
+
+    /// numeric element of the ddl struct
+    struct NumericElement {
+        size_t _byte_pos;
+        size_t _count;
+        const NumericType* _type;
+    };
+
+    /// raw memory which interpolates the sample it is set to into the target memory
+    class LinearInterpolation : public fep3::arya::IRawMemory {
+    public:
+        LinearInterpolation(const Implementation& implementation, uint8_t* target, double ratio)
+            : _implementation(implementation), _target(target), _ratio(ratio)
+        {
+        }
+
+        size_t capacity() const override
+        {
+            return _implementation._size;
+        }
+
+        const void* cdata() const override
+        {
+            return _target;
+        }
+
+        size_t size() const override
+        {
+            return _implementation._size;
+        }
+
+        size_t set(const void* data, size_t data_size) override
+        {
+            // the next sample is interpolated directly from its memory without copying it
+            if (data_size < _implementation._size) {
+                return 0;
+            }
+            const auto next = static_cast<const uint8_t*>(data);
+            for (const auto& element: _implementation._linear_elements) {
+                element._interpolate(_target + element._byte_pos,
+                                     next + element._byte_pos,
+                                     element._count,
+                                     _ratio);
+            }
+            return data_size;
+        }
+
+        size_t resize(size_t data_size) override
+        {
+            return data_size < _implementation._size ? 0 : data_size;
+        }
+
+    private:
+        const Implementation& _implementation;
+        uint8_t* _target;
+        double _ratio;
+    };
+
+    explicit Implementation(Interpolation default_interpolation)
+        : _default_interpolation(default_interpolation)
+    {
+    }
+
+    fep3::Result resolveLayout(const data_read_ptr<const fep3::arya::IStreamType>& stream_type)
+    {
+        _stream_type = stream_type;
+        _size = 0;
+        _elements.clear();
+        _linear_elements.clear();
+        _layout_result = stream_type ? createLayout(*stream_type) :
+                                       CREATE_ERROR_DESCRIPTION(ERR_POINTER, "No stream type set");
+        if (_layout_result) {
+            updateLinearElements();
+        }
+        return _layout_result;
+    }
+
+    fep3::Result setInterpolation(const std::string& element_name, Interpolation interpolation)
+    {
+        FEP3_RETURN_IF_FAILED(_layout_result);
+        const auto element = _elements.find(element_name);
+        if (element == _elements.end()) {
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
+                                     "The stream type contains no numeric element %s",
+                                     element_name.c_str());
+        }
+        if (Interpolation::linear == interpolation && !element->second._type->_interpolate) {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+                                     "The element %s can not be interpolated linearly",
+                                     element_name.c_str());
+        }
+        _interpolations[element_name] = interpolation;
+        updateLinearElements();
+        return {};
+    }
+
+    data_read_ptr<const fep3::arya::IDataSample> interpolate(
+        const data_read_ptr<const fep3::arya::IDataSample>& previous,
+        const data_read_ptr<const fep3::arya::IDataSample>& next,
+        fep3::arya::Timestamp time) const
+    {
+        auto sample = std::make_shared<InterpolatedSample>(time, previous->getCounter());
+        if (previous->read(*sample) < _size) {
+            return previous;
+        }
+        const auto ratio = static_cast<double>((time - previous->getTime()).count()) /
+                           static_cast<double>((next->getTime() - previous->getTime()).count());
+        LinearInterpolation linear_interpolation(*this, sample->data(), ratio);
+        if (next->read(linear_interpolation) < _size) {
+            return previous;
+        }
+        return sample;
+    }
+
+    bool isInterpolating() const
+    {
+        return _layout_result && !_linear_elements.empty();
+    }
+
+    data_read_ptr<const fep3::arya::IStreamType> _stream_type{};
+
+private:
+    fep3::Result createLayout(const fep3::arya::IStreamType& stream_type)
+    {
+        const auto struct_name = stream_type.getProperty(base::arya::meta_type_prop_name_ddlstruct);
+        auto description = stream_type.getProperty(base::arya::meta_type_prop_name_ddldescription);
+        if (description.empty()) {
+            const auto description_file =
+                stream_type.getProperty(base::arya::meta_type_prop_name_ddlfileref);
+            if (description_file.empty() ||
+                a_util::filesystem::readTextFile(description_file, description) !=
+                    a_util::filesystem::OK) {
+                RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE,
+                                         "The stream type %s has no ddl description",
+                                         stream_type.getMetaTypeName().c_str());
+            }
+        }
+
+        try {
+            const auto data_definition = ddl::DDString::fromXMLString(description);
+            const auto struct_type = data_definition.getStructTypes().get(struct_name);
+            if (!struct_type) {
+                RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE,
+                                         "Unable to find the struct type %s in the ddl",
+                                         struct_name.c_str());
+            }
+            const auto type_info = struct_type->getInfo<ddl::dd::TypeInfo>();
+            if (!type_info || type_info->isDynamic()) {
+                RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE,
+                                         "The struct type %s has no static layout",
+                                         struct_name.c_str());
+            }
+            _size = type_info->getDeserializedTypeSize();
+            addNumericElements(data_definition, *struct_type, {}, 0);
+        }
+        catch (const std::exception& e) {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE, e.what());
+        }
+        return {};
+    }
+
+    void addNumericElements(const ddl::dd::DataDefinition& data_definition,
+                            const ddl::dd::StructType& struct_type,
+                            const std::string& path_prefix,
+                            size_t byte_pos)
+    {
+        for (const auto& element: struct_type.getElements()) {
+            const auto element_type_info = element->getInfo<ddl::dd::ElementTypeInfo>();
+            if (!element_type_info) {
+                continue;
+            }
+            const auto element_path = path_prefix + element->getName();
+            const auto element_byte_pos = byte_pos + element_type_info->getDeserializedBytePos();
+            const auto array_size = element->getArraySize().getArraySizeValue();
+
+            if (const auto numeric_type = getNumericType(element->getTypeName())) {
+                _elements.emplace(element_path,
+                                  NumericElement{element_byte_pos, array_size, numeric_type});
+                continue;
+            }
+
+            const auto element_struct_type =
+                data_definition.getStructTypes().get(element->getTypeName());
+            if (!element_struct_type) {
+                continue;
+            }
+            if (1 == array_size) {
+                addNumericElements(
+                    data_definition, *element_struct_type, element_path + ".", element_byte_pos);
+                continue;
+            }
+            const auto element_struct_info = element_struct_type->getInfo<ddl::dd::TypeInfo>();
+            if (!element_struct_info) {
+                continue;
+            }
+            const auto element_struct_size = element_struct_info->getDeserializedTypeSize();
+            for (size_t index = 0; index < array_size; ++index) {
+                addNumericElements(data_definition,
+                                   *element_struct_type,
+                                   element_path + "[" + std::to_string(index) + "].",
+                                   element_byte_pos + index * element_struct_size);
+            }
+        }
+    }
+
+    void updateLinearElements()
+    {
+        _linear_elements.clear();
+        for (const auto& element: _elements) {
+            const auto interpolation = _interpolations.find(element.first);
+            const auto element_interpolation = interpolation == _interpolations.end() ?
+                                                   _default_interpolation :
+                                                   interpolation->second;
+            if (Interpolation::linear == element_interpolation &&
+                element.second._type->_interpolate) {
+                _linear_elements.push_back({element.second._byte_pos,
+                                            element.second._count,
+                                            element.second._type->_interpolate});
+            }
+        }
+        // interpolate in memory order
+        std::sort(_linear_elements.begin(),
+                  _linear_elements.end(),
+                  [](const LinearElement& lhs, const LinearElement& rhs) {
+                      return lhs._byte_pos < rhs._byte_pos;
+                  });
+    }
+
+    const Interpolation _default_interpolation;
+    /// interpolations set by the user, kept if the layout is resolved again
+    std::map<std::string, Interpolation> _interpolations{};
+    fep3::Result _layout_result{};
+    size_t _size{0};
+    std::map<std::string, NumericElement> _elements{};
+    std::vector<LinearElement> _linear_elements{};
+};
+
+InterpolatingDataReader::InterpolatingDataReader(
+    std::string name,
+    const base::StreamType& stream_type,
+    size_t queue_size,
+    Interpolation default_interpolation,
+    const std::function<bool(fep3::Timestamp, fep3::Timestamp)>& time_comparator)
+    : DataReader(std::move(name), stream_type, queue_size, time_comparator),
+      _impl(std::make_unique<Implementation>(default_interpolation))
+{
+    _impl->resolveLayout(readType());
+}
+
+InterpolatingDataReader::~InterpolatingDataReader() = default;
+
+fep3::Result InterpolatingDataReader::setInterpolation(const std::string& element_name,
+                                                       Interpolation interpolation)
+{
+    return _impl->setInterpolation(element_name, interpolation);
+}
+
+data_read_ptr<const IDataSample> InterpolatingDataReader::readSampleInterpolated(Timestamp time)
+{
+    const auto stream_type = readType();
+    if (stream_type != _impl->_stream_type) {
+        _impl->resolveLayout(stream_type);
+    }
+
+    const auto previous = readSampleAt(time);
+    if (!previous) {
+        // clamped to the oldest sample
+        return readSampleAfter(time);
+    }
+    if (previous->getTime() == time || !_impl->isInterpolating()) {
+        return previous;
+    }
+    const auto next = readSampleAfter(time);
+    if (!next) {
+        // clamped to the latest sample
+        return previous;
+    }
+    return _impl->interpolate(previous, next, time);
+}
+
+} // namespace arya
+} // namespace core
+} // namespace fep3
@@ -51,6 +51,23 @@ fep3::Result DataRegistry::DataWriter::flush()
     return _dataout_writer_ref.transmit();
 }
 
+std::shared_ptr<ILoanedDataSample> DataRegistry::DataWriter::loanSample(size_t size)
+{
+    if (!_loaning_writer) {
+        return nullptr;
+    }
+    return _loaning_writer->loanSample(size);
+}
+
+fep3::Result DataRegistry::DataWriter::commit(
+    const std::shared_ptr<ILoanedDataSample>& loaned_sample)
+{
+    if (!_loaning_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED, "Data writer does not loan samples");
+    }
+    return _loaning_writer->commit(loaned_sample);
+}
+
 size_t DataRegistry::DataWriter::capacity() const
 {
     return _queue_capacity;
@@ -61,7 +78,7 @@ size_t DataRegistry::DataWriter::capacity() const
 /***************************************************************/
 
 DataRegistry::DataReaderProxy::DataReaderProxy(std::shared_ptr<IDataRegistry::IDataReader> reader)
-    : _data_reader(reader)
+    : _data_reader(reader), _batch_reader(dynamic_cast<IDataRegistryBatchReader*>(reader.get()))
 {
     if (!_data_reader) {
         throw std::runtime_error(
@@ -89,12 +106,32 @@ fep3::Optional<Timestamp> DataRegistry::DataReaderProxy::getFrontTime() const
     return _data_reader->getFrontTime();
 }
 
+size_t DataRegistry::DataReaderProxy::popUntil(
+    Timestamp time,
+    const std::function<bool(Timestamp, Timestamp)>& time_comparator,
+    IDataReceiver& receiver)
+{
+    if (_batch_reader) {
+        return _batch_reader->popUntil(time, time_comparator, receiver);
+    }
+    size_t item_count = 0;
+    for (auto front_time = _data_reader->getFrontTime();
+         front_time && time_comparator(*front_time, time);
+         front_time = _data_reader->getFrontTime()) {
+        if (!_data_reader->pop(receiver)) {
+            break;
+        }
+        ++item_count;
+    }
+    return item_count;
+}
+
 /***************************************************************/
 /* DataWriterProxy                                             */
 /***************************************************************/
 
 DataRegistry::DataWriterProxy::DataWriterProxy(std::shared_ptr<IDataRegistry::IDataWriter> writer)
-    : _data_writer(writer)
+    : _data_writer(writer), _loaning_writer(dynamic_cast<IDataRegistryLoaningWriter*>(writer.get()))
 {
     if (!_data_writer) {
         throw std::runtime_error(
@@ -115,4 +152,21 @@ fep3::Result DataRegistry::DataWriterProxy::write(const IStreamType& stream_type
 fep3::Result DataRegistry::DataWriterProxy::flush()
 {
     return _data_writer->flush();
-}
\ No newline at end of file
+}
+
+std::shared_ptr<ILoanedDataSample> DataRegistry::DataWriterProxy::loanSample(size_t size)
+{
+    if (!_loaning_writer) {
+        return nullptr;
+    }
+    return _loaning_writer->loanSample(size);
+}
+
+fep3::Result DataRegistry::DataWriterProxy::commit(
+    const std::shared_ptr<ILoanedDataSample>& loaned_sample)
+{
+    if (!_loaning_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED, "Data writer does not loan samples");
+    }
+    return _loaning_writer->commit(loaned_sample);
+}
@@ -15,6 +15,8 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include "data_reader_queue.hpp"
 #include "data_registry.h"
 
+#include <fep3/components/data_registry/data_registry_loan_intf.h>
+
 namespace fep3 {
 namespace native {
 namespace arya {
@@ -32,12 +34,16 @@ public:
 
 /**
  * Internal data writer class that holds the unique_ptr to the data writer of the simulation bus.
+ * Samples are loaned from the simulation bus if the data writer of the signal supports loaning.
  */
-class DataRegistry::DataWriter : public IDataRegistry::IDataWriter {
+class DataRegistry::DataWriter : public IDataRegistry::IDataWriter,
+                                 public IDataRegistryLoaningWriter {
 public:
     DataWriter() = delete;
     explicit DataWriter(ISimulationBus::IDataWriter& _writer_ref, const size_t queue_capacity)
-        : _dataout_writer_ref(_writer_ref), _queue_capacity(queue_capacity)
+        : _dataout_writer_ref(_writer_ref),
+          _loaning_writer(dynamic_cast<ILoaningDataWriter*>(&_writer_ref)),
+          _queue_capacity(queue_capacity)
     {
     }
     ~DataWriter() override = default;
@@ -45,11 +51,15 @@ public:
     fep3::Result write(const IDataSample& data_sample) override;
     fep3::Result write(const IStreamType& stream_type) override;
     fep3::Result flush() override;
+    std::shared_ptr<ILoanedDataSample> loanSample(size_t size) override;
+    fep3::Result commit(const std::shared_ptr<ILoanedDataSample>& loaned_sample) override;
 
     size_t capacity() const;
 
 private:
     ISimulationBus::IDataWriter& _dataout_writer_ref;
+    // the loaning interface of the data writer, nullptr if it does not loan samples
+    ILoaningDataWriter* const _loaning_writer{nullptr};
     size_t _queue_capacity{0};
 };
 
@@ -57,7 +67,8 @@ private:
  * Proxy class that forwards all function calls to the data reader object shared between this and
  * the data registry.
  */
-class DataRegistry::DataReaderProxy : public IDataRegistry::IDataReader {
+class DataRegistry::DataReaderProxy : public IDataRegistry::IDataReader,
+                                      public IDataRegistryBatchReader {
 public:
     DataReaderProxy() = delete;
     explicit DataReaderProxy(std::shared_ptr<IDataRegistry::IDataReader> reader);
@@ -67,16 +78,22 @@ public:
     size_t capacity() const override;
     fep3::Result pop(IDataReceiver& receiver) override;
     fep3::Optional<Timestamp> getFrontTime() const override;
+    size_t popUntil(Timestamp time,
+                    const std::function<bool(Timestamp, Timestamp)>& time_comparator,
+                    IDataReceiver& receiver) override;
 
 private:
     const std::shared_ptr<IDataRegistry::IDataReader> _data_reader{nullptr};
+    // the batch interface of the data reader, nullptr if it pops item by item only
+    IDataRegistryBatchReader* const _batch_reader{nullptr};
 };
 
 /**
  * Proxy class that forwards all function calls to the data writer object shared between this and
  * the data registry.
  */
-class DataRegistry::DataWriterProxy : public IDataRegistry::IDataWriter {
+class DataRegistry::DataWriterProxy : public IDataRegistry::IDataWriter,
+                                      public IDataRegistryLoaningWriter {
 public:
     DataWriterProxy() = delete;
     explicit DataWriterProxy(std::shared_ptr<IDataRegistry::IDataWriter> writer);
@@ -85,9 +102,13 @@ public:
     fep3::Result write(const IDataSample& data_sample) override;
     fep3::Result write(const IStreamType& stream_type) override;
     fep3::Result flush() override;
+    std::shared_ptr<ILoanedDataSample> loanSample(size_t size) override;
+    fep3::Result commit(const std::shared_ptr<ILoanedDataSample>& loaned_sample) override;
 
 private:
     const std::shared_ptr<IDataRegistry::IDataWriter> _data_writer{nullptr};
+    // the loaning interface of the data writer, nullptr if it does not loan samples
+    IDataRegistryLoaningWriter* const _loaning_writer{nullptr};
 };
 
 } // namespace arya
@@ -13,6 +13,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #pragma once
 
 #include <fep3/base/queue/data_item_queue.h>
+#include <fep3/components/data_registry/data_registry_batch_intf.h>
 #include <fep3/components/data_registry/data_registry_intf.h>
 
 namespace fep3 {
@@ -38,7 +39,8 @@ struct WrappedDataItemReceiver : public base::arya::detail::DataItemQueueBase<>:
  * @brief A data reader queue implementation
  */
 class DataReaderQueue : public fep3::arya::IDataRegistry::IDataReceiver,
-                        public fep3::arya::IDataRegistry::IDataReader {
+                        public fep3::arya::IDataRegistry::IDataReader,
+                        public fep3::arya::IDataRegistryBatchReader {
 public:
     /**
      * @brief Construct a new Data Reader Queue object
@@ -120,6 +122,24 @@ public:
         return _queue.popFront(wrap) ? fep3::Result() : fep3::ERR_EMPTY;
     }
 
+    /**
+     * @brief pops the items as long as the next sample is due (within one lock of the queue)
+     *
+     * @param[in] time the time to pop the items until
+     * @param[in] time_comparator returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp
+     * @param[in] receiver the receiver to "send" the items to
+     * @return size_t the number of popped items
+     */
+    size_t popUntil(fep3::arya::Timestamp time,
+                    const std::function<bool(fep3::arya::Timestamp, fep3::arya::Timestamp)>&
+                        time_comparator,
+                    fep3::arya::IDataRegistry::IDataReceiver& receiver) override final
+    {
+        WrappedDataItemReceiver wrap(receiver);
+        return _queue.popFrontUntil(time, time_comparator, wrap);
+    }
+
     /**
      * @brief empty the queue
      */
@@ -24,6 +24,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <a_util/filesystem/filesystem.h>
 #include <a_util/system/address_info.h>
 
+#include <algorithm>
 #include <future>
 
 #ifndef WIN32
@@ -91,6 +92,11 @@ fep3::Result DataRegistryConfiguration::registerPropertyVariables()
                                                    FEP3_MAPPING_CONFIGURATION_FILE_PATH_PROPERTY));
     FEP3_RETURN_IF_FAILED(
         registerPropertyVariable(_mapping_ddl_file_paths, FEP3_MAPPING_DDL_FILE_PATHS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_mapping_compilation, FEP3_MAPPING_COMPILATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_mapping_parallel_evaluation_threshold,
+                                 FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_PROPERTY));
     FEP3_RETURN_IF_FAILED(_data_signal_renaming.registerPropertyVariables(*this));
 
     return {};
@@ -102,6 +108,11 @@ fep3::Result DataRegistryConfiguration::unregisterPropertyVariables()
         _mapping_configuration_file_path, FEP3_MAPPING_CONFIGURATION_FILE_PATH_PROPERTY));
     FEP3_RETURN_IF_FAILED(
         unregisterPropertyVariable(_mapping_ddl_file_paths, FEP3_MAPPING_DDL_FILE_PATHS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_mapping_compilation, FEP3_MAPPING_COMPILATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_mapping_parallel_evaluation_threshold,
+                                   FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_PROPERTY));
     FEP3_RETURN_IF_FAILED(_data_signal_renaming.unregisterPropertyVariables(*this));
 
     return {};
@@ -200,6 +211,8 @@ fep3::Result DataRegistry::applyMapping()
     for (const auto& mapped_signal: mapped_signals) {
         FEP3_RETURN_IF_FAILED(_mapping.registerSignal(mapped_signal));
         auto mapped_signal_in = _ins.at(mapped_signal);
+        // Mapped signals are not received from the simulation bus so they don't hold an alias
+        _in_aliases.erase(mapped_signal_in->getAlias());
         mapped_signal_in->setAlias(mapped_signal);
         _mapped_ins.emplace(mapped_signal, mapped_signal_in);
         _ins.erase(mapped_signal);
@@ -217,38 +230,14 @@ fep3::Result DataRegistry::initialize()
     FEP3_RETURN_IF_FAILED(_data_signal_renaming.parseProperties());
 
     // Apply alias naming from renaming configuration to all already registered signals
-    for (auto in: _ins) {
-        const auto alias_name = _data_signal_renaming.getAliasInputName(in.second->getName());
-
-        // Check that we not collide with another alias name
-        for (const auto& signal: _ins) {
-            if (signal.first != in.first && signal.second->getAlias() == alias_name) {
-                RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED,
-                                         "The input signal name '%s' alias '%s' is already "
-                                         "registered as signal with same alias name.",
-                                         signal.first.c_str(),
-                                         alias_name.c_str());
-            }
-        }
-
-        in.second->setAlias(alias_name);
+    for (const auto& in: _ins) {
+        FEP3_RETURN_IF_FAILED(applyAliasName(
+            *in.second, _data_signal_renaming.getAliasInputName(in.second->getName()), false));
     }
 
-    for (auto out: _outs) {
-        const auto alias_name = _data_signal_renaming.getAliasOutputName(out.second->getName());
-
-        // Check that we not collide with another alias name
-        for (const auto& signal: _outs) {
-            if (signal.first != out.first && signal.second->getAlias() == alias_name) {
-                RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED,
-                                         "The output signal name '%s' alias '%s' is already "
-                                         "registered as signal with same alias name.",
-                                         signal.first.c_str(),
-                                         alias_name.c_str());
-            }
-        }
-
-        out.second->setAlias(alias_name);
+    for (const auto& out: _outs) {
+        FEP3_RETURN_IF_FAILED(applyAliasName(
+            *out.second, _data_signal_renaming.getAliasOutputName(out.second->getName()), true));
     }
     return {};
 }
@@ -295,6 +284,10 @@ fep3::Result DataRegistry::tense()
 
 fep3::Result DataRegistry::start()
 {
+    _configuration.updatePropertyVariables();
+    _mapping.setParallelEvaluationThreshold(static_cast<size_t>(
+        std::max<int32_t>(_configuration._mapping_parallel_evaluation_threshold, 0)));
+
     return _mapping.startMappingEngine();
 }
 
@@ -339,11 +332,18 @@ fep3::Result DataRegistry::relax()
 
 fep3::Result DataRegistry::unregisterDataIn(const std::string& name)
 {
-    if (_ins.erase(name) > 0) {
+    auto found = _ins.find(name);
+    if (found != _ins.end()) {
+        _in_aliases.erase(found->second->getAlias());
+        releaseSignalId(found->second->getId());
+        _ins.erase(found);
         return {};
     }
 
-    if (_mapped_ins.erase(name) > 0) {
+    found = _mapped_ins.find(name);
+    if (found != _mapped_ins.end()) {
+        releaseSignalId(found->second->getId());
+        _mapped_ins.erase(found);
         return _mapping.unregisterSignal(name);
     }
 
@@ -354,7 +354,11 @@ fep3::Result DataRegistry::unregisterDataIn(const std::string& name)
 
 fep3::Result DataRegistry::unregisterDataOut(const std::string& name)
 {
-    if (_outs.erase(name) > 0) {
+    auto found = _outs.find(name);
+    if (found != _outs.end()) {
+        _out_aliases.erase(found->second->getAlias());
+        releaseSignalId(found->second->getId());
+        _outs.erase(found);
         return {};
     }
 
@@ -523,9 +527,22 @@ fep3::Result DataRegistry::resolveSignalType(const std::string& type_name,
     return {};
 }
 
+fep3::Result DataRegistry::resolveSignalTypeLayout(const std::string& type_name,
+                                                   std::shared_ptr<const DDLTypeLayout>& layout)
+{
+    return _description_mgr.resolveTypeLayout(type_name, layout);
+}
+
+fep3::Result DataRegistry::resolveSignalCodecFactory(
+    const std::string& type_name, std::shared_ptr<const ddl::CodecFactory>& codec_factory)
+{
+    return _description_mgr.resolveCodecFactory(type_name, codec_factory);
+}
+
 fep3::Result DataRegistry::updateMappingConfiguration()
 {
     _configuration.updatePropertyVariables();
+    _mapping.setCompilationEnabled(static_cast<bool>(_configuration._mapping_compilation));
 
     FEP3_RETURN_IF_FAILED(registerDDLsFromFiles(
         static_cast<std::vector<std::string>>(_configuration._mapping_ddl_file_paths)));
@@ -643,8 +660,11 @@ fep3::Result DataRegistry::registerDataIn(const std::string& name,
 
     const auto alias_name = _data_signal_renaming.getAliasInputName(name);
     if (checkFreeAliasName(alias_name)) {
+        const auto id = acquireSignalId();
         auto data_signal_in =
-            std::make_shared<DataSignalIn>(name, alias_name, type, is_dynamic_meta_type);
+            std::make_shared<DataSignalIn>(id, name, alias_name, type, is_dynamic_meta_type);
+        _signals[id] = data_signal_in.get();
+        _in_aliases.emplace(alias_name, id);
         _ins.emplace(name, data_signal_in);
 
         if (signals_registered_at_simulation_bus) {
@@ -702,8 +722,11 @@ fep3::Result DataRegistry::registerDataOut(const std::string& name,
 
     const auto alias_name = _data_signal_renaming.getAliasOutputName(name);
     if (checkFreeAliasName(alias_name, true)) {
+        const auto id = acquireSignalId();
         auto data_signal_out =
-            std::make_shared<DataSignalOut>(name, alias_name, type, is_dynamic_meta_type);
+            std::make_shared<DataSignalOut>(id, name, alias_name, type, is_dynamic_meta_type);
+        _signals[id] = data_signal_out.get();
+        _out_aliases.emplace(alias_name, id);
         _outs.emplace(name, data_signal_out);
 
         if (signals_registered_at_simulation_bus) {
@@ -766,37 +789,69 @@ DataRegistry::DataSignalOut* DataRegistry::getDataOut(const std::string& name)
 
 DataRegistry::DataSignalIn* DataRegistry::getDataInByAlias(const std::string& name)
 {
-    for (auto in: _ins) {
-        if (in.second->getAlias() == name)
-            return in.second.get();
+    auto found = _in_aliases.find(name);
+    if (found != _in_aliases.end()) {
+        return static_cast<DataSignalIn*>(getSignal(found->second));
     }
     return nullptr;
 }
 
 DataRegistry::DataSignalOut* DataRegistry::getDataOutByAlias(const std::string& name)
 {
-    for (auto out: _outs) {
-        if (out.second->getAlias() == name)
-            return out.second.get();
+    auto found = _out_aliases.find(name);
+    if (found != _out_aliases.end()) {
+        return static_cast<DataSignalOut*>(getSignal(found->second));
     }
     return nullptr;
 }
 
 bool DataRegistry::checkFreeAliasName(const std::string& name, bool output)
 {
-    if (output) {
-        for (const auto& signal: _outs) {
-            if (signal.second->getAlias() == name) {
-                return false;
-            }
-        }
+    const auto& aliases = output ? _out_aliases : _in_aliases;
+    return aliases.find(name) == aliases.end();
+}
+
+fep3::Result DataRegistry::applyAliasName(DataSignal& signal,
+                                          const std::string& alias_name,
+                                          bool output)
+{
+    auto& aliases = output ? _out_aliases : _in_aliases;
+
+    // Check that we not collide with another alias name
+    const auto found = aliases.find(alias_name);
+    if (found != aliases.end() && found->second != signal.getId()) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED,
+                                 "The %s signal name '%s' alias '%s' is already "
+                                 "registered as signal with same alias name.",
+                                 output ? "output" : "input",
+                                 getSignal(found->second)->getName().c_str(),
+                                 alias_name.c_str());
     }
-    else {
-        for (const auto& signal: _ins) {
-            if (signal.second->getAlias() == name) {
-                return false;
-            }
-        }
+
+    aliases.erase(signal.getAlias());
+    aliases.emplace(alias_name, signal.getId());
+    signal.setAlias(alias_name);
+    return {};
+}
+
+DataRegistry::DataSignal* DataRegistry::getSignal(SignalId id)
+{
+    return id < _signals.size() ? _signals[id] : nullptr;
+}
+
+DataRegistry::SignalId DataRegistry::acquireSignalId()
+{
+    if (!_free_signal_ids.empty()) {
+        const auto id = _free_signal_ids.back();
+        _free_signal_ids.pop_back();
+        return id;
     }
-    return true;
+    _signals.push_back(nullptr);
+    return static_cast<SignalId>(_signals.size() - 1);
+}
+
+void DataRegistry::releaseSignalId(SignalId id)
+{
+    _signals[id] = nullptr;
+    _free_signal_ids.push_back(id);
 }
@@ -56,6 +56,11 @@ struct DataRegistryConfiguration : public base::Configuration {
     base::PropertyVariable<std::string> _mapping_configuration_file_path{""};
     /// Property for a list of file paths to ddl descriptions files
     fep3::base::PropertyVariable<std::vector<std::string>> _mapping_ddl_file_paths{};
+    /// Property to map target signals with precompiled mapping programs where possible
+    base::PropertyVariable<bool> _mapping_compilation{FEP3_MAPPING_COMPILATION_DEFAULT_VALUE};
+    /// Property for the minimal count of compiled targets of a source to evaluate them in parallel
+    base::PropertyVariable<int32_t> _mapping_parallel_evaluation_threshold{
+        FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_DEFAULT_VALUE};
 
     DataSignalRenaming& _data_signal_renaming;
 };
@@ -75,6 +80,8 @@ public: // Types
         Replace,
         Merge
     };
+    /// Dense signal id assigned at registration, ids of unregistered signals are reused
+    using SignalId = uint32_t;
 
 private:
     typedef std::map<std::string, std::string> tDescriptionMap;
@@ -153,6 +160,31 @@ public: // Member functions
      */
     fep3::Result resolveSignalType(const std::string& type, std::string*& description);
 
+    /**
+     * @brief Gets the deserialized memory layout of the given type
+     *
+     * @param [in] type The DDL datatype to get the layout of
+     * @param [out] layout The memory layout of the type, cached by the ddl description manager
+     *
+     * @retval ERR_NOT_FOUND The type was not found in the registered ddl description
+     * @retval ERR_INVALID_TYPE The layout of the type could not be computed
+     */
+    fep3::Result resolveSignalTypeLayout(const std::string& type,
+                                         std::shared_ptr<const DDLTypeLayout>& layout);
+
+    /**
+     * @brief Gets a codec factory for samples of the given type
+     *
+     * @param [in] type The DDL datatype to get the codec factory of
+     * @param [out] codec_factory The codec factory of the type, cached by the ddl description
+     *                            manager
+     *
+     * @retval ERR_NOT_FOUND The type was not found in the registered ddl description
+     * @retval ERR_INVALID_TYPE No codec factory could be created for the type
+     */
+    fep3::Result resolveSignalCodecFactory(const std::string& type,
+                                           std::shared_ptr<const ddl::CodecFactory>& codec_factory);
+
 public:               // Data registry implementation detail classes
     class DataSignal; // public because it's used as a handle in the mapping engine
 
@@ -178,6 +210,11 @@ private: // Helper functions
     fep3::Result registerDDLsFromFiles(const std::vector<std::string>& ddl_files);
 
     bool checkFreeAliasName(const std::string& name, bool output = false);
+    fep3::Result applyAliasName(DataSignal& signal, const std::string& alias_name, bool output);
+
+    DataSignal* getSignal(SignalId id);
+    SignalId acquireSignalId();
+    void releaseSignalId(SignalId id);
     fep3::Result applyMapping();
 
 private: // Member variables
@@ -185,6 +222,14 @@ private: // Member variables
     std::unordered_map<std::string, std::shared_ptr<DataSignalIn>> _ins{};
     /// Internal list of all output signals going to the simualtion bus
     std::unordered_map<std::string, std::shared_ptr<DataSignalOut>> _outs{};
+    /// Signal table indexed by signal id, unused slots are nullptr
+    std::vector<DataSignal*> _signals{};
+    /// Ids of unregistered signals to be reused by the next registration
+    std::vector<SignalId> _free_signal_ids{};
+    /// Alias name to id relation of the input signals coming from the simulation bus
+    std::unordered_map<std::string, SignalId> _in_aliases{};
+    /// Alias name to id relation of the output signals going to the simulation bus
+    std::unordered_map<std::string, SignalId> _out_aliases{};
     std::thread _receive_thread;
     std::shared_ptr<IRPCServer::IRPCService> _rpc_service{nullptr};
 
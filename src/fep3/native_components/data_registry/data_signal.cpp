@@ -12,6 +12,8 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "data_signal.h"
 
+#include <algorithm>
+
 using namespace fep3;
 using namespace fep3::native;
 
@@ -19,6 +21,11 @@ using namespace fep3::native;
 /* DataSignal                                                  */
 /***************************************************************/
 
+DataRegistry::SignalId DataRegistry::DataSignal::getId() const
+{
+    return _id;
+}
+
 std::string DataRegistry::DataSignal::getName() const
 {
     return _name;
@@ -61,38 +68,52 @@ DataRegistry::DataSignalIn::~DataSignalIn()
 void DataRegistry::DataSignalIn::registerDataListener(
     const std::shared_ptr<IDataReceiver>& listener)
 {
-    for (auto& current_listener: _listeners) {
-        if (current_listener == listener) {
-            return;
+    updateReceivers([&listener](Receivers& receivers) {
+        if (std::find(receivers._listeners.begin(), receivers._listeners.end(), listener) ==
+            receivers._listeners.end()) {
+            receivers._listeners.push_back(listener);
         }
-    }
-    _listeners.push_back(listener);
+    });
 }
 
 void DataRegistry::DataSignalIn::unregisterDataListener(
     const std::shared_ptr<IDataReceiver>& listener)
 {
-    auto listener_it = std::find_if(_listeners.begin(),
-                                    _listeners.end(),
-                                    [&listener](std::shared_ptr<IDataReceiver> current_listener) {
-                                        return current_listener == listener;
-                                    });
-    if (listener_it != _listeners.end()) {
-        _listeners.erase(listener_it);
-    }
+    updateReceivers([&listener](Receivers& receivers) {
+        receivers._listeners.erase(
+            std::remove(receivers._listeners.begin(), receivers._listeners.end(), listener),
+            receivers._listeners.end());
+    });
+}
+
+void DataRegistry::DataSignalIn::removeReader(const DataRegistry::DataReader* reader)
+{
+    updateReceivers([reader](Receivers& receivers) {
+        receivers._readers.erase(std::remove_if(receivers._readers.begin(),
+                                                receivers._readers.end(),
+                                                [reader](const auto& current_reader) {
+                                                    return current_reader.get() == reader;
+                                                }),
+                                 receivers._readers.end());
+    });
+}
+
+void DataRegistry::DataSignalIn::updateReceivers(const std::function<void(Receivers&)>& update)
+{
+    std::lock_guard<std::mutex> lock(_receivers_mutex);
+    auto receivers = std::make_shared<Receivers>(*_receivers);
+    update(*receivers);
+    std::atomic_store(&_receivers, std::shared_ptr<const Receivers>(std::move(receivers)));
 }
 
 size_t DataRegistry::DataSignalIn::getMaxQueueSize() const
 {
     size_t size_result = 1;
-    auto readers = _readers;
-    for (const auto& reader: *readers) {
-        auto reader_locked = reader.lock();
-        if (reader_locked) {
-            auto size_current = reader_locked->capacity();
-            if (size_current > size_result) {
-                size_result = size_current;
-            }
+    const auto receivers = std::atomic_load(&_receivers);
+    for (const auto& reader: receivers->_readers) {
+        auto size_current = reader->capacity();
+        if (size_current > size_result) {
+            size_result = size_current;
         }
     }
     return size_result;
@@ -137,20 +158,19 @@ fep3::Result DataRegistry::DataSignalIn::registerAtSignalMapping(SignalMapping&
 std::unique_ptr<IDataRegistry::IDataReader> DataRegistry::DataSignalIn::getReader(
     const size_t queue_capacity)
 {
-    const auto& iter = _readers->insert(_readers->end(), std::weak_ptr<DataRegistry::DataReader>());
-    // Construct shared_ptr with custom deleter
-    std::shared_ptr<DataRegistry::DataReader> reader{
-        new DataRegistry::DataReader(queue_capacity),
-        [readers_ptr = std::weak_ptr<DataReaderList>(_readers),
-         iter](DataRegistry::DataReader* ptr) {
-            delete ptr;
-            auto readers = readers_ptr.lock();
-            if (readers) {
-                readers->erase(iter);
+    auto reader = std::make_shared<DataRegistry::DataReader>(queue_capacity);
+    updateReceivers([&reader](Receivers& receivers) { receivers._readers.push_back(reader); });
+    // The proxy's handle removes the reader from the receivers on destruction. The reader itself
+    // lives on until the last snapshot referring to it is released by the receiving thread.
+    std::shared_ptr<DataRegistry::DataReader> reader_handle{
+        reader.get(),
+        [signal = weak_from_this(), reader](DataRegistry::DataReader*) {
+            auto locked_signal = signal.lock();
+            if (locked_signal) {
+                static_cast<DataSignalIn&>(*locked_signal).removeReader(reader.get());
             }
         }};
-    *iter = reader;
-    return std::make_unique<DataRegistry::DataReaderProxy>(reader);
+    return std::make_unique<DataRegistry::DataReaderProxy>(reader_handle);
 }
 
 void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IStreamType>& type)
@@ -158,16 +178,11 @@ void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IStreamTyp
     setType(*type);
 
     // first of all we receive for the queues
-    auto readers = _readers;
-    for (auto& reader: *readers) {
-        // very very very slow! why we have this very slow weak pointer here ????
-        auto locked_reader = reader.lock();
-        if (locked_reader) {
-            // i really do not understand this operator thisng here (it makes no sense)
-            locked_reader->operator()(type);
-        }
+    const auto receivers = std::atomic_load(&_receivers);
+    for (const auto& reader: receivers->_readers) {
+        (*reader)(type);
     }
-    for (auto& listener: _listeners) {
+    for (const auto& listener: receivers->_listeners) {
         (*listener)(type);
     }
 }
@@ -175,15 +190,11 @@ void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IStreamTyp
 void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IDataSample>& sample)
 {
     // first of all we receive for the queues
-    auto readers = _readers;
-    for (auto& reader: *readers) {
-        // very very very slow! why we have this very slow weak pointer here ????
-        auto locked_reader = reader.lock();
-        if (locked_reader) {
-            locked_reader->operator()(sample);
-        }
+    const auto receivers = std::atomic_load(&_receivers);
+    for (const auto& reader: receivers->_readers) {
+        (*reader)(sample);
     }
-    for (auto& listener: _listeners) {
+    for (const auto& listener: receivers->_listeners) {
         (*listener)(sample);
     }
 }
@@ -295,6 +306,30 @@ fep3::Result DataRegistry::DataSignalOut::transmit()
     }
 }
 
+std::shared_ptr<ILoanedDataSample> DataRegistry::DataSignalOut::loanSample(size_t size)
+{
+    const auto loaning_writer = dynamic_cast<ILoaningDataWriter*>(_sim_bus_writer.get());
+    if (!loaning_writer) {
+        return nullptr;
+    }
+    return loaning_writer->loanSample(size);
+}
+
+fep3::Result DataRegistry::DataSignalOut::commit(
+    const std::shared_ptr<ILoanedDataSample>& loaned_sample)
+{
+    if (!_sim_bus_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_DEVICE_NOT_READY, "Simulation bus not initialized");
+    }
+    const auto loaning_writer = dynamic_cast<ILoaningDataWriter*>(_sim_bus_writer.get());
+    if (!loaning_writer) {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED,
+                                 "Simulation bus data writer of signal '%s' does not loan samples",
+                                 getAlias().c_str());
+    }
+    return loaning_writer->commit(loaned_sample);
+}
+
 std::unique_ptr<IDataRegistry::IDataWriter> DataRegistry::DataSignalOut::getWriter(
     const size_t queue_capacity)
 {
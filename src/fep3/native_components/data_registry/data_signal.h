@@ -16,6 +16,9 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <fep3/base/stream_type/default_stream_type.h>
 
+#include <functional>
+#include <mutex>
+
 namespace fep3 {
 namespace native {
 namespace arya {
@@ -29,15 +32,21 @@ public:
     DataSignal(const DataSignal&) = default;
     DataSignal& operator=(DataSignal&&) = default;
     DataSignal& operator=(const DataSignal&) = default;
-    DataSignal(const std::string name,
+    DataSignal(SignalId id,
+               const std::string name,
                const std::string alias,
                const IStreamType& type,
                bool dynamic_type)
-        : _name(std::move(name)), _alias(std::move(alias)), _type(type), _dynamic_type(dynamic_type)
+        : _id(id),
+          _name(std::move(name)),
+          _alias(std::move(alias)),
+          _type(type),
+          _dynamic_type(dynamic_type)
     {
     }
     virtual ~DataSignal() = default;
 
+    SignalId getId() const;
     std::string getName() const;
     std::string getAlias() const;
     void setAlias(const std::string&);
@@ -47,6 +56,7 @@ public:
     bool hasDynamicType() const;
 
 private:
+    SignalId _id{};
     std::string _name{};
     std::string _alias{};
     base::StreamType _type{fep3::base::arya::meta_type_raw};
@@ -63,15 +73,16 @@ class DataRegistry::DataSignalIn
       public std::enable_shared_from_this<ISimulationBus::IDataReceiver> {
 public:
     DataSignalIn() = delete;
-    DataSignalIn(DataSignalIn&&) = default;
-    DataSignalIn(const DataSignalIn&) = default;
-    DataSignalIn& operator=(DataSignalIn&&) = default;
-    DataSignalIn& operator=(const DataSignalIn&) = default;
-    DataSignalIn(const std::string& name,
+    DataSignalIn(DataSignalIn&&) = delete;
+    DataSignalIn(const DataSignalIn&) = delete;
+    DataSignalIn& operator=(DataSignalIn&&) = delete;
+    DataSignalIn& operator=(const DataSignalIn&) = delete;
+    DataSignalIn(SignalId id,
+                 const std::string& name,
                  const std::string& alias,
                  const IStreamType& type,
                  bool dynamic_type)
-        : DataSignal(name, alias, type, dynamic_type)
+        : DataSignal(id, name, alias, type, dynamic_type)
     {
     }
     ~DataSignalIn() override;
@@ -92,30 +103,43 @@ public:
     void operator()(const data_read_ptr<const IDataSample>& sample) override;
 
 private:
+    /// Readers and listeners every received item is passed on to
+    struct Receivers {
+        std::vector<std::shared_ptr<DataRegistry::DataReader>> _readers{};
+        std::vector<std::shared_ptr<IDataReceiver>> _listeners{};
+    };
+
     std::unique_ptr<ISimulationBus::IDataReader> _sim_bus_reader;
 
-    typedef std::list<std::weak_ptr<DataRegistry::DataReader>> DataReaderList;
-    std::shared_ptr<DataReaderList> _readers{std::make_shared<DataReaderList>()};
-    std::vector<std::shared_ptr<IDataReceiver>> _listeners{};
+    /// Serializes the replacement of the receivers snapshot
+    std::mutex _receivers_mutex;
+    /// Immutable snapshot of the receivers, replaced as a whole on every (un)registration
+    std::shared_ptr<const Receivers> _receivers{std::make_shared<Receivers>()};
 
     size_t getMaxQueueSize() const;
+    void updateReceivers(const std::function<void(Receivers&)>& update);
+    void removeReader(const DataRegistry::DataReader* reader);
 };
 
 /**
  * Internal output signal class that holds the writer registered at the simulation bus.
+ * Samples are loaned from the writer registered at the simulation bus if it supports loaning.
  */
-class DataRegistry::DataSignalOut : public DataSignal, public ISimulationBus::IDataWriter {
+class DataRegistry::DataSignalOut : public DataSignal,
+                                    public ISimulationBus::IDataWriter,
+                                    public ILoaningDataWriter {
 public:
     DataSignalOut() = delete;
     DataSignalOut(DataSignalOut&&) = default;
     DataSignalOut(const DataSignalOut&) = default;
     DataSignalOut& operator=(DataSignalOut&&) = default;
     DataSignalOut& operator=(const DataSignalOut&) = default;
-    DataSignalOut(const std::string& name,
+    DataSignalOut(SignalId id,
+                  const std::string& name,
                   const std::string& alias,
                   const IStreamType& type,
                   bool dynamic_type)
-        : DataSignal(name, alias, type, dynamic_type)
+        : DataSignal(id, name, alias, type, dynamic_type)
     {
     }
     ~DataSignalOut() override;
@@ -130,6 +154,8 @@ public:
     fep3::Result write(const IDataSample& data_sample) override;
     fep3::Result write(const IStreamType& stream_type) override;
     fep3::Result transmit() override;
+    std::shared_ptr<ILoanedDataSample> loanSample(size_t size) override;
+    fep3::Result commit(const std::shared_ptr<ILoanedDataSample>& loaned_sample) override;
 
 private:
     std::unique_ptr<ISimulationBus::IDataWriter> _sim_bus_writer;
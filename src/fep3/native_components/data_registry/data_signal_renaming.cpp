@@ -102,7 +102,9 @@ Result DataSignalRenaming::parseProperties()
 
 Result DataSignalRenaming::checkName(const std::string& name)
 {
-    if (!std::regex_match(name, std::regex("^[A-Za-z0-9_]+$"))) {
+    // Compiling the pattern is far more expensive than matching, so do it once only
+    static const std::regex signal_name_pattern("^[A-Za-z0-9_]+$");
+    if (!std::regex_match(name, signal_name_pattern)) {
         RETURN_ERROR_DESCRIPTION(
             ERR_NOT_SUPPORTED,
             "Signal name '%s' is not supported. Use alphanumeric characters and underscore only!",
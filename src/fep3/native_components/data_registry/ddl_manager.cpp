@@ -30,6 +30,39 @@ bool hasDynamicStructs(const ddl::dd::DataDefinition& data_definition) noexcept
     return it != struct_types.cend();
 }
 
+void addElementLayouts(const ddl::dd::DataDefinition& data_definition,
+                       const ddl::dd::StructType& struct_type,
+                       const std::string& path_prefix,
+                       size_t byte_pos,
+                       fep3::DDLTypeLayout& layout)
+{
+    for (const auto& element: struct_type.getElements()) {
+        const auto element_type_info = element->getInfo<ddl::dd::ElementTypeInfo>();
+        if (!element_type_info) {
+            continue;
+        }
+        const auto element_path = path_prefix + element->getName();
+        const auto element_byte_pos = byte_pos + element_type_info->getDeserializedBytePos();
+        const auto array_size = element->getArraySize().getArraySizeValue();
+        layout._elements.emplace(element_path,
+                                 fep3::DDLTypeLayout::Element{element_byte_pos,
+                                                              element->getTypeName(),
+                                                              array_size,
+                                                              element->getDefault()});
+
+        // Elements of nested struct arrays are not flattened
+        const auto element_struct_type =
+            data_definition.getStructTypes().get(element->getTypeName());
+        if (element_struct_type && array_size == 1) {
+            addElementLayouts(data_definition,
+                              *element_struct_type,
+                              element_path + ".",
+                              element_byte_pos,
+                              layout);
+        }
+    }
+}
+
 } // namespace
 
 using namespace fep3;
@@ -62,6 +95,7 @@ fep3::Result DDLManager::loadDDL(const std::string& ddl,
                 "a dynamic array");
         }
         *_ddl = std::move(data_definition);
+        invalidateCache();
     }
     catch (const ddl::dd::Error& e) {
         RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, e.what());
@@ -94,6 +128,7 @@ fep3::Result DDLManager::mergeDDL(const std::string& ddl,
                 "a dynamic array");
         }
         _ddl->add(data_definition);
+        invalidateCache();
     }
     catch (const ddl::dd::Error& e) {
         RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, e.what());
@@ -112,11 +147,79 @@ fep3::Result DDLManager::resolveType(const std::string& type, std::string& descr
                                  type.c_str(),
                                  " in the ddl");
     }
-    description = ddl::DDString::toXMLString(type, *_ddl);
+
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    auto& cached_type = _cache[type];
+    if (cached_type._description.empty()) {
+        cached_type._description = ddl::DDString::toXMLString(type, *_ddl);
+    }
+    description = cached_type._description;
+    return {};
+}
+
+fep3::Result DDLManager::resolveTypeLayout(const std::string& type,
+                                           std::shared_ptr<const DDLTypeLayout>& layout) const
+{
+    const auto struct_type = _ddl->getStructTypes().get(type);
+    if (!struct_type) {
+        RETURN_ERROR_DESCRIPTION(
+            ERR_NOT_FOUND, "Unable to find the struct type %s in the ddl", type.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    auto& cached_type = _cache[type];
+    if (!cached_type._layout) {
+        const auto type_info = struct_type->getInfo<ddl::dd::TypeInfo>();
+        if (!type_info) {
+            RETURN_ERROR_DESCRIPTION(
+                ERR_INVALID_TYPE, "No type information available for struct type %s", type.c_str());
+        }
+        auto computed_layout = std::make_shared<DDLTypeLayout>();
+        computed_layout->_size = type_info->getDeserializedTypeSize();
+        computed_layout->_dynamic = type_info->isDynamic();
+        try {
+            addElementLayouts(*_ddl, *struct_type, {}, 0, *computed_layout);
+        }
+        catch (const std::exception& e) {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE, e.what());
+        }
+        cached_type._layout = std::move(computed_layout);
+    }
+    layout = cached_type._layout;
+    return {};
+}
+
+fep3::Result DDLManager::resolveCodecFactory(
+    const std::string& type, std::shared_ptr<const ddl::CodecFactory>& codec_factory) const
+{
+    const auto struct_type = _ddl->getStructTypes().get(type);
+    if (!struct_type) {
+        RETURN_ERROR_DESCRIPTION(
+            ERR_NOT_FOUND, "Unable to find the struct type %s in the ddl", type.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    auto& cached_type = _cache[type];
+    if (!cached_type._codec_factory) {
+        auto created_codec_factory = std::make_shared<ddl::CodecFactory>(*struct_type, *_ddl);
+        if (!created_codec_factory->isValid()) {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_TYPE,
+                                     "Unable to create a codec factory for struct type %s",
+                                     type.c_str());
+        }
+        cached_type._codec_factory = std::move(created_codec_factory);
+    }
+    codec_factory = cached_type._codec_factory;
     return {};
 }
 
 const ddl::dd::DataDefinition& DDLManager::getDDL() const noexcept
 {
     return *_ddl;
+}
+
+void DDLManager::invalidateCache() noexcept
+{
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    _cache.clear();
 }
\ No newline at end of file
@@ -16,10 +16,38 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <fep3/components/logging/easy_logger.h>
 
+#include <ddl/codec/codec_factory.h>
 #include <ddl/dd/dd.h>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace fep3 {
 namespace arya {
+/**
+ * @brief Deserialized memory layout of a DDL struct
+ */
+struct DDLTypeLayout {
+    /// Layout of a single element
+    struct Element {
+        /// Deserialized byte position inside the struct
+        size_t _byte_pos;
+        /// Name of the data type, enum or struct of the element
+        std::string _type_name;
+        /// Array size of the element, 0 for dynamic arrays
+        size_t _array_size;
+        /// Default value of the element, empty if the element has no default value
+        std::string _default_value;
+    };
+
+    /// Deserialized size of the struct
+    size_t _size{};
+    /// Whether the struct contains dynamic arrays
+    bool _dynamic{};
+    /// All elements of the struct and of its nested structs by their dot separated path
+    std::unordered_map<std::string, Element> _elements{};
+};
+
 class DDLManager {
 public:
     /// CTOR
@@ -54,6 +82,32 @@ public:
      */
     fep3::Result resolveType(const std::string& type, std::string& description) const;
 
+    /**
+     * @brief Gets the deserialized memory layout of the given type.
+     * The layout is computed once and cached until the description is loaded or merged.
+     *
+     * @param [in] type The name of a DDL struct
+     * @param [out] layout The memory layout of the struct
+     *
+     * @retval ERR_NOT_FOUND The type was not found in the description
+     * @retval ERR_INVALID_TYPE The layout of the type could not be computed
+     */
+    fep3::Result resolveTypeLayout(const std::string& type,
+                                   std::shared_ptr<const DDLTypeLayout>& layout) const;
+
+    /**
+     * @brief Gets a codec factory to decode and encode samples of the given type.
+     * The codec factory is created once and cached until the description is loaded or merged.
+     *
+     * @param [in] type The name of a DDL struct
+     * @param [out] codec_factory The codec factory of the struct
+     *
+     * @retval ERR_NOT_FOUND The type was not found in the description
+     * @retval ERR_INVALID_TYPE No codec factory could be created for the type
+     */
+    fep3::Result resolveCodecFactory(const std::string& type,
+                                     std::shared_ptr<const ddl::CodecFactory>& codec_factory) const;
+
     /**
      * @brief Returns a const reference to the internal data definition object
      *
@@ -61,10 +115,26 @@ public:
      */
     const ddl::dd::DataDefinition& getDDL() const noexcept;
 
+private:
+    /// Representations of a single struct, computed on first request
+    struct CachedType {
+        std::string _description{};
+        std::shared_ptr<const DDLTypeLayout> _layout{};
+        std::shared_ptr<const ddl::CodecFactory> _codec_factory{};
+    };
+
+    /// Clears the cache, has to be called whenever the description changes
+    void invalidateCache() noexcept;
+
 private:
     /// The actual ddl description managed by this instance
     std::unique_ptr<ddl::dd::DataDefinition> _ddl;
+    /// Mutex guarding the cache
+    mutable std::mutex _cache_mutex;
+    /// Cached representations of the requested structs by their name
+    mutable std::unordered_map<std::string, CachedType> _cache{};
 };
 } // namespace arya
 using arya::DDLManager;
+using arya::DDLTypeLayout;
 } // namespace fep3
\ No newline at end of file
@@ -13,6 +13,13 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/base/sample/data_sample.h>
 #include <fep3/native_components/data_registry/data_signal.h>
 
+#include <a_util/strings/strings_functions.h>
+#include <threaded_executor.h>
+
+#include <algorithm>
+#include <exception>
+#include <future>
+
 using namespace fep3;
 using namespace fep3::native;
 
@@ -83,6 +90,173 @@ private:
     ddl::mapping::rt::ISignalListener& _signal_listener;
 };
 
+namespace {
+bool hasDefaultValues(const DDLTypeLayout& layout)
+{
+    return std::any_of(layout._elements.cbegin(), layout._elements.cend(), [](const auto& element) {
+        return !element.second._default_value.empty();
+    });
+}
+
+bool resolveElement(const DDLTypeLayout& layout,
+                    const std::string& element_path,
+                    size_t& byte_pos,
+                    MappingElementType& type)
+{
+    // Array elements are not contained in the layout and left to the mapping engine
+    const auto element = layout._elements.find(element_path);
+    if (element == layout._elements.cend() || element->second._array_size != 1) {
+        return false;
+    }
+    byte_pos = element->second._byte_pos;
+    return getMappingElementType(element->second._type_name, type);
+}
+} // namespace
+
+/***************************************************************/
+/* SignalMapping::CompiledTarget                               */
+/***************************************************************/
+
+/// Target signal mapped by mapping programs instead of the mapping engine
+struct SignalMapping::CompiledTarget {
+    /// Mapping program and trigger of a single source signal of the target
+    struct Source {
+        Source(CompiledTarget& target, const std::string& name, const std::string& type)
+            : _target(target), _name(name), _type(type)
+        {
+        }
+
+        void evaluate(const void* data, size_t size) const
+        {
+            _target.onSourceReceived(*this, data, size);
+        }
+
+        CompiledTarget& _target;
+        const std::string _name;
+        const std::string _type;
+        MappingProgram _program{};
+        /// Whether a received sample of this source triggers the target
+        bool _trigger{false};
+        /// Whether the source is registered at the compiled source of the signal mapping
+        bool _registered{false};
+    };
+
+    CompiledTarget(SignalMapping& mapping,
+                   const std::string& name,
+                   const std::string& type,
+                   size_t size)
+        : _mapping(mapping), _name(name), _type(type), _initial_memory(size)
+    {
+    }
+
+    Source& getSource(const std::string& source_name, const std::string& source_type)
+    {
+        for (auto& source: _sources) {
+            if (source->_name == source_name) {
+                return *source;
+            }
+        }
+        _sources.push_back(std::make_unique<Source>(*this, source_name, source_type));
+        return *_sources.back();
+    }
+
+    void onSourceReceived(const Source& source, const void* data, size_t size)
+    {
+        // Samples smaller than the source type cannot be mapped and are dropped
+        if (size < source._program.getSourceSize()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        source._program.run(data, _memory.data());
+        if (source._trigger) {
+            _mapping.sendTarget(this, _memory.data(), _memory.size(), _mapping.getTime());
+        }
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _memory = _initial_memory;
+    }
+
+    SignalMapping& _mapping;
+    const std::string _name;
+    const std::string _type;
+    /// Target memory holding the constants, the target is reset to it on stop
+    std::vector<uint8_t> _initial_memory;
+    std::vector<uint8_t> _memory{};
+    std::vector<std::unique_ptr<Source>> _sources{};
+    std::mutex _mutex;
+};
+
+/***************************************************************/
+/* SignalMapping::CompiledSource                               */
+/***************************************************************/
+
+/// Source signal evaluating all compiled targets using it
+struct SignalMapping::CompiledSource : public ddl::mapping::rt::ISignalListener {
+    explicit CompiledSource(SignalMapping& mapping)
+        : _mapping(mapping), _receiver(std::make_shared<DataReceiverAdapter>(*this))
+    {
+    }
+
+    bool onSampleReceived(const void* data, size_t size) override
+    {
+        // Samples received while the mapping is stopped are dropped
+        if (!_mapping._compiled_targets_running) {
+            return true;
+        }
+
+        const auto& worker_pool = _mapping._worker_pool;
+        if (!worker_pool || _target_sources.size() < _mapping._parallel_evaluation_threshold) {
+            for (const auto target_source: _target_sources) {
+                target_source->evaluate(data, size);
+            }
+            return true;
+        }
+
+        // The targets are evaluated in parallel, but the sample is completely evaluated before the
+        // next sample of this source is received, which keeps the order of every target
+        std::vector<std::future<void>> evaluations;
+        evaluations.reserve(_target_sources.size() - 1);
+        for (auto target_source = std::next(_target_sources.cbegin());
+             target_source != _target_sources.cend();
+             ++target_source) {
+            evaluations.push_back(worker_pool->postWithCompletionFuture(
+                [source = *target_source, data, size]() { source->evaluate(data, size); }));
+        }
+        // All evaluations are awaited before an exception is rethrown, because they still use the
+        // received sample
+        std::exception_ptr exception;
+        try {
+            _target_sources.front()->evaluate(data, size);
+        }
+        catch (...) {
+            exception = std::current_exception();
+        }
+        for (auto& evaluation: evaluations) {
+            try {
+                evaluation.get();
+            }
+            catch (...) {
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return true;
+    }
+
+    SignalMapping& _mapping;
+    /// Receiver registered at the source signal of the data registry
+    const std::shared_ptr<IDataRegistry::IDataReceiver> _receiver;
+    /// Sources of all compiled targets using this source signal
+    std::vector<const CompiledTarget::Source*> _target_sources{};
+};
+
 /***************************************************************/
 /* SignalMapping                                               */
 /***************************************************************/
@@ -144,8 +318,25 @@ void SignalMapping::resetSignalDescription(const ddl::dd::DataDefinition& ddl_de
     _engine.setConfiguration(_config);
 }
 
+void SignalMapping::setCompilationEnabled(bool compilation_enabled) noexcept
+{
+    _compilation_enabled = compilation_enabled;
+}
+
+void SignalMapping::setParallelEvaluationThreshold(size_t parallel_evaluation_threshold) noexcept
+{
+    _parallel_evaluation_threshold = parallel_evaluation_threshold;
+}
+
 a_util::result::Result SignalMapping::registerSignal(const std::string& target_signal_name)
 {
+    // Already mapped targets are rejected by the mapping engine
+    if (_compilation_enabled && _mapped_signals.find(target_signal_name) == _mapped_signals.end()) {
+        auto compiled_target = compileTarget(target_signal_name);
+        if (compiled_target) {
+            return registerCompiledTarget(std::move(compiled_target));
+        }
+    }
     handle_t handle{nullptr}; // The mapping engine will assign an object to the pointer
     return _engine.Map(target_signal_name, handle);
 }
@@ -154,6 +345,10 @@ a_util::result::Result SignalMapping::unregisterSignal(const std::string& target
 {
     auto found = _mapped_signals.find(target_signal_name);
     if (found != _mapped_signals.end()) {
+        auto compiled_target = _compiled_targets.find(found->second);
+        if (compiled_target != _compiled_targets.end()) {
+            return unregisterCompiledTarget(*compiled_target->second);
+        }
         return _engine.unmap(found->second);
     }
     RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "Signal has not been registered");
@@ -165,14 +360,14 @@ a_util::result::Result SignalMapping::registerDataReceiver(
 {
     auto signal_handle_it = _mapped_signals.find(target_signal_name);
     if (signal_handle_it != _mapped_signals.end()) {
-        auto data_receiver_it = _data_receivers.find(signal_handle_it->second);
-        if (data_receiver_it != _data_receivers.end()) {
+        auto& mapped_target = _mapped_targets[signal_handle_it->second];
+        if (mapped_target._data_receiver) {
             RETURN_ERROR_DESCRIPTION(
                 ERR_RESOURCE_IN_USE,
                 "A data receiver is already registered for this target signal");
         }
         else {
-            _data_receivers.emplace(std::make_pair(signal_handle_it->second, data_receiver));
+            mapped_target._data_receiver = std::move(data_receiver);
             return {};
         }
     }
@@ -185,13 +380,14 @@ a_util::result::Result SignalMapping::unregisterDataReceiver(const std::string&
 {
     auto signal_handle_it = _mapped_signals.find(target_signal_name);
     if (signal_handle_it != _mapped_signals.end()) {
-        auto data_receiver_it = _data_receivers.find(signal_handle_it->second);
-        if (data_receiver_it == _data_receivers.end()) {
+        auto mapped_target_it = _mapped_targets.find(signal_handle_it->second);
+        if (mapped_target_it == _mapped_targets.end() ||
+            !mapped_target_it->second._data_receiver) {
             RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
                                      "No data receiver is registered for this target signal");
         }
         else {
-            _data_receivers.erase(data_receiver_it);
+            mapped_target_it->second._data_receiver.reset();
             return {};
         }
     }
@@ -202,42 +398,261 @@ a_util::result::Result SignalMapping::unregisterDataReceiver(const std::string&
 
 fep3::Result SignalMapping::startMappingEngine()
 {
-    return _engine.start();
+    FEP3_RETURN_IF_FAILED(_engine.start());
+
+    // The worker pool is only needed if a source signal has enough compiled targets
+    const auto parallel_evaluation =
+        _parallel_evaluation_threshold > 0 &&
+        std::any_of(_compiled_sources.cbegin(),
+                    _compiled_sources.cend(),
+                    [this](const auto& compiled_source) {
+                        return compiled_source.second->_target_sources.size() >=
+                               _parallel_evaluation_threshold;
+                    });
+    // The worker pool is kept until the last compiled target is unregistered, because samples
+    // may be received until the reception of the simulation bus is stopped
+    if (parallel_evaluation && !_worker_pool) {
+        // The receiving thread evaluates one of the targets itself
+        _worker_pool = std::make_shared<ThreadPoolExecutor>(
+            std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+        _worker_pool->start();
+    }
+    _compiled_targets_running = true;
+    return {};
 }
 
 fep3::Result SignalMapping::stopAndResetMappingEngine()
 {
+    _compiled_targets_running = false;
+    for (auto& compiled_target: _compiled_targets) {
+        compiled_target.second->reset();
+    }
     FEP3_RETURN_IF_FAILED(_engine.stop());
     return _engine.reset();
 }
 
+std::unique_ptr<SignalMapping::CompiledTarget> SignalMapping::compileTarget(
+    const std::string& target_signal_name)
+{
+    const auto target = _config.getTarget(target_signal_name);
+    if (!target) {
+        return {};
+    }
+
+    // Invalid descriptions and mapping configurations leave the target to the mapping engine
+    try {
+        std::shared_ptr<const DDLTypeLayout> target_layout;
+        if (!_data_registry.resolveSignalTypeLayout(target->getType(), target_layout) ||
+            target_layout->_dynamic) {
+            return {};
+        }
+
+        auto compiled_target = std::make_unique<CompiledTarget>(
+            *this, target_signal_name, target->getType(), target_layout->_size);
+
+        // Default values of the target elements are written once into the initial target memory,
+        // by a codec of the cached codec factory of the target type
+        if (hasDefaultValues(*target_layout)) {
+            std::shared_ptr<const ddl::CodecFactory> codec_factory;
+            if (!_data_registry.resolveSignalCodecFactory(target->getType(), codec_factory)) {
+                return {};
+            }
+            auto codec = codec_factory->makeCodecFor(compiled_target->_initial_memory.data(),
+                                                     compiled_target->_initial_memory.size());
+            codec.resetValues();
+        }
+
+        for (const auto& assignment: target->getAssignmentList()) {
+            if (!assignment.getFunction().empty() || !assignment.getTransformation().empty()) {
+                return {};
+            }
+            size_t target_byte_pos{};
+            MappingElementType target_element_type{};
+            if (!resolveElement(
+                    *target_layout, assignment.getTo(), target_byte_pos, target_element_type)) {
+                return {};
+            }
+
+            if (!assignment.getConstant().empty()) {
+                const double constant = std::stod(assignment.getConstant());
+                if (target_byte_pos + getMappingElementSize(target_element_type) >
+                    compiled_target->_initial_memory.size()) {
+                    return {};
+                }
+                convertMappingElement(&constant,
+                                      MappingElementType::Float64,
+                                      compiled_target->_initial_memory.data() + target_byte_pos,
+                                      target_element_type);
+                continue;
+            }
+
+            // Assignments of whole source signals are left to the mapping engine
+            const auto source = _config.getSource(assignment.getSource());
+            if (!source || assignment.getFrom().empty()) {
+                return {};
+            }
+            std::shared_ptr<const DDLTypeLayout> source_layout;
+            if (!_data_registry.resolveSignalTypeLayout(source->getType(), source_layout) ||
+                source_layout->_dynamic) {
+                return {};
+            }
+            size_t source_byte_pos{};
+            MappingElementType source_element_type{};
+            if (!resolveElement(
+                    *source_layout, assignment.getFrom(), source_byte_pos, source_element_type)) {
+                return {};
+            }
+            compiled_target->getSource(source->getName(), source->getType())
+                ._program.addAssignment(
+                    source_byte_pos, source_element_type, target_byte_pos, target_element_type);
+        }
+
+        // Periodic and data triggers are left to the mapping engine
+        for (const auto trigger: target->getTriggerList()) {
+            const auto signal_trigger =
+                dynamic_cast<const ddl::mapping::MapSignalTrigger*>(trigger);
+            if (!signal_trigger) {
+                return {};
+            }
+            const auto source = _config.getSource(signal_trigger->getVariable());
+            if (!source) {
+                return {};
+            }
+            compiled_target->getSource(source->getName(), source->getType())._trigger = true;
+        }
+
+        for (auto& source: compiled_target->_sources) {
+            source->_program.finalize();
+            if (source->_program.getTargetSize() > compiled_target->_initial_memory.size()) {
+                return {};
+            }
+        }
+        compiled_target->_memory = compiled_target->_initial_memory;
+        return compiled_target;
+    }
+    catch (const std::exception&) {
+        return {};
+    }
+}
+
+fep3::Result SignalMapping::registerCompiledTarget(std::unique_ptr<CompiledTarget> compiled_target)
+{
+    auto& target = *compiled_target;
+    const handle_t handle = &target;
+    _compiled_targets.emplace(handle, std::move(compiled_target));
+
+    for (auto& source: target._sources) {
+        auto result = registerSourceSignal(source->_name, source->_type);
+        if (result) {
+            auto& compiled_source = _compiled_sources[source->_name];
+            if (!compiled_source) {
+                compiled_source = std::make_shared<CompiledSource>(*this);
+                result = _data_registry.registerDataReceiveListener(source->_name,
+                                                                    compiled_source->_receiver);
+            }
+            compiled_source->_target_sources.push_back(source.get());
+            source->_registered = true;
+        }
+        if (!result) {
+            unregisterCompiledTarget(target);
+            return result;
+        }
+    }
+
+    return targetMapped(target._name.c_str(), target._type.c_str(), handle, target._memory.size());
+}
+
+fep3::Result SignalMapping::unregisterCompiledTarget(CompiledTarget& compiled_target)
+{
+    const handle_t handle = &compiled_target;
+    fep3::Result result;
+    for (auto& source: compiled_target._sources) {
+        if (source->_registered) {
+            auto compiled_source = _compiled_sources.find(source->_name);
+            auto& target_sources = compiled_source->second->_target_sources;
+            target_sources.erase(
+                std::remove(target_sources.begin(), target_sources.end(), source.get()),
+                target_sources.end());
+            if (target_sources.empty()) {
+                _data_registry.unregisterDataReceiveListener(
+                    source->_name, compiled_source->second->_receiver);
+                _compiled_sources.erase(compiled_source);
+            }
+            result |= unregisterSourceSignal(source->_name);
+        }
+    }
+    targetUnmapped(compiled_target._name.c_str(), handle);
+    _compiled_targets.erase(handle);
+    if (_compiled_sources.empty()) {
+        _worker_pool.reset();
+    }
+    return result;
+}
+
+fep3::Result SignalMapping::registerSourceSignal(const std::string& source_name,
+                                                 const std::string& type_name)
+{
+    auto& user_count = _source_signals[source_name];
+    if (user_count == 0) {
+        // Resource allocation done by data registry through resolveType()
+        const char* type_description;
+        if (!resolveType(type_name.c_str(), type_description)) {
+            _source_signals.erase(source_name);
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
+                                     "Source signal type not found in type description");
+        }
+        const auto result = _data_registry.registerDataIn(
+            source_name, base::StreamTypeDDL{type_name, type_description});
+        if (!result) {
+            _source_signals.erase(source_name);
+            return result;
+        }
+    }
+    ++user_count;
+    return {};
+}
+
+fep3::Result SignalMapping::unregisterSourceSignal(const std::string& source_name)
+{
+    auto found = _source_signals.find(source_name);
+    if (found == _source_signals.end()) {
+        RETURN_ERROR_DESCRIPTION(
+            ERR_NOT_FOUND, "The source signal %s is not registered", source_name.c_str());
+    }
+    if (--found->second > 0) {
+        return {};
+    }
+    _source_signals.erase(found);
+    return _data_registry.unregisterDataIn(source_name);
+}
+
 a_util::result::Result SignalMapping::registerSource(const char* source_name,
                                                      const char* type_name,
                                                      ddl::mapping::rt::ISignalListener* listener,
                                                      handle_t& handle)
 {
-    const char* type_description; // Resource allocation done by data registry through resolveType()
-    if (!resolveType(type_name, type_description)) {
-        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "Source signal type not found in type description");
-    }
-    FEP3_RETURN_IF_FAILED(_data_registry.registerDataIn(
-        source_name, base::StreamTypeDDL{type_name, type_description}));
-    if (listener) {
-        FEP3_RETURN_IF_FAILED(_data_registry.registerDataReceiveListener(
-            source_name, std::make_shared<DataReceiverAdapter>(*listener)));
-    }
-    else {
+    if (!listener) {
         RETURN_ERROR_DESCRIPTION(ERR_POINTER, "Signal listener pointer is null");
     }
+    FEP3_RETURN_IF_FAILED(registerSourceSignal(source_name, type_name));
+    auto receiver = std::make_shared<DataReceiverAdapter>(*listener);
+    FEP3_RETURN_IF_FAILED(_data_registry.registerDataReceiveListener(source_name, receiver));
+    _engine_sources[source_name] = std::move(receiver);
     handle = _data_registry.getSignalInHandle(source_name);
     return {};
 }
 
 a_util::result::Result SignalMapping::unregisterSource(handle_t handle)
 {
-    // The corresponding data listener will be destroyed automatically with the signal destruction
-    return _data_registry.unregisterDataIn(
-        reinterpret_cast<DataRegistry::DataSignal*>(handle)->getName());
+    // Source signals may still be in use by compiled targets, so only the listener of the mapping
+    // engine is removed here
+    const std::string source_name = reinterpret_cast<DataRegistry::DataSignal*>(handle)->getName();
+    auto engine_source = _engine_sources.find(source_name);
+    if (engine_source != _engine_sources.end()) {
+        _data_registry.unregisterDataReceiveListener(source_name, engine_source->second);
+        _engine_sources.erase(engine_source);
+    }
+    return unregisterSourceSignal(source_name);
 }
 
 a_util::result::Result SignalMapping::sendTarget(handle_t target,
@@ -245,16 +660,16 @@ a_util::result::Result SignalMapping::sendTarget(handle_t target,
                                                  size_t size,
                                                  timestamp_t time_stamp)
 {
-    auto it_buffer = _sample_buffers.find(target);
-    if (it_buffer != _sample_buffers.end()) {
-        std::shared_ptr<IDataSample> sample = it_buffer->second;
+    auto mapped_target_it = _mapped_targets.find(target);
+    if (mapped_target_it != _mapped_targets.end() && mapped_target_it->second._sample_buffer) {
+        const auto& mapped_target = mapped_target_it->second;
+        const std::shared_ptr<IDataSample>& sample = mapped_target._sample_buffer;
         base::RawMemoryRef memory{data, size};
         sample->write(memory);
         sample->setTime(std::chrono::duration<timestamp_t>(time_stamp));
 
-        auto data_receiver_it = _data_receivers.find(target);
-        if (data_receiver_it != _data_receivers.end()) {
-            (*(data_receiver_it->second))(sample);
+        if (mapped_target._data_receiver) {
+            (*mapped_target._data_receiver)(sample);
             return {};
         }
         else {
@@ -272,14 +687,14 @@ a_util::result::Result SignalMapping::targetMapped(const char* target_name,
                                                    size_t target_size)
 {
     _mapped_signals.emplace(std::make_pair(target_name, target));
-    _sample_buffers.emplace(
-        std::make_pair(target, std::make_shared<base::DataSample>(target_size, false)));
+    _mapped_targets[target]._sample_buffer =
+        std::make_shared<base::DataSample>(target_size, false);
     return {};
 }
 
 a_util::result::Result SignalMapping::targetUnmapped(const char* target_name, handle_t target)
 {
-    _data_receivers.erase(target);
+    _mapped_targets.erase(target);
     _mapped_signals.erase(target_name);
     return {};
 }
@@ -12,12 +12,18 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include "mapping_program.h"
+
 #include <fep3/components/data_registry/data_registry_intf.h>
 
 #include <ddl/mapping/engine/mapping_engine.h>
 
+#include <atomic>
+#include <unordered_map>
+
 namespace fep3 {
 namespace native {
+struct ThreadPoolExecutor;
 namespace arya {
 class DataRegistry;
 /**
@@ -73,6 +79,27 @@ public:
      */
     void resetSignalDescription(const ddl::dd::DataDefinition& ddl_description) noexcept;
 
+    /*
+     * @brief Enables or disables the compilation of target signals into mapping programs.
+     * A compiled target signal is mapped by a flat list of memory copies instead of the mapping
+     * engine. Target signals, which cannot be compiled, are always mapped by the mapping engine.
+     * This has no effect on currently registered signals.
+     *
+     * @param [in] compilation_enabled Whether target signals shall be compiled
+     */
+    void setCompilationEnabled(bool compilation_enabled) noexcept;
+
+    /*
+     * @brief Sets the minimal count of compiled targets using the same source signal to evaluate
+     * these targets in parallel on a worker pool. The receiving thread waits until all targets
+     * are evaluated, so every target is delivered in the order of the received source samples.
+     * This takes effect with the next start of the mapping.
+     *
+     * @param [in] parallel_evaluation_threshold Minimal count of targets, 0 disables the parallel
+     * evaluation
+     */
+    void setParallelEvaluationThreshold(size_t parallel_evaluation_threshold) noexcept;
+
     /*
      * @brief Tries to register a target signal at the mapping engine using the current mapping
      * configuration. This will also register all source signals at the data registry.
@@ -161,6 +188,29 @@ public:
     a_util::result::Result unregisterPeriodicTimer(
         timestamp_t period_us, ::ddl::mapping::rt::IPeriodicListener* listener) override;
 
+private:
+    struct CompiledTarget;
+    struct CompiledSource;
+
+    /*
+     * @brief Compiles a target signal of the current mapping configuration into mapping programs
+     *
+     * @param [in] target_signal_name The name of the target signal
+     * @return The compiled target or nullptr if the target has to be mapped by the mapping engine
+     */
+    std::unique_ptr<CompiledTarget> compileTarget(const std::string& target_signal_name);
+
+    fep3::Result registerCompiledTarget(std::unique_ptr<CompiledTarget> compiled_target);
+    fep3::Result unregisterCompiledTarget(CompiledTarget& compiled_target);
+
+    /*
+     * @brief Registers a source signal at the data registry. Source signals are shared by the
+     * mapping engine and all compiled targets and unregistered with their last user.
+     */
+    fep3::Result registerSourceSignal(const std::string& source_name,
+                                      const std::string& type_name);
+    fep3::Result unregisterSourceSignal(const std::string& source_name);
+
 private:
     /// Mapping configuration from the mapping configuration file
     ddl::mapping::MapConfiguration _config{};
@@ -168,12 +218,33 @@ private:
     DataRegistry& _data_registry;
     /// Name to handle relation of the target signals
     std::map<std::string, handle_t> _mapped_signals{};
-    /// Preallocated sample buffers for every registered target
-    std::map<handle_t, std::shared_ptr<IDataSample>> _sample_buffers{};
-    /// List of data receivers for every signal to be called during target signal trigger
-    std::map<handle_t, std::shared_ptr<IDataRegistry::IDataReceiver>> _data_receivers{};
-    /// Mapping engine doing the actual mapping
+    /// Everything needed to send a target signal, looked up once per target signal trigger
+    struct MappedTarget {
+        /// Preallocated sample buffer of the target
+        std::shared_ptr<IDataSample> _sample_buffer;
+        /// Data receiver to be called during target signal trigger
+        std::shared_ptr<IDataRegistry::IDataReceiver> _data_receiver;
+    };
+    /// Sample buffer and data receiver of every registered target
+    std::unordered_map<handle_t, MappedTarget> _mapped_targets{};
+    /// Mapping engine doing the actual mapping of all targets which are not compiled
     ddl::mapping::rt::MappingEngine _engine{*this};
+    /// Whether target signals are compiled into mapping programs during registration
+    bool _compilation_enabled{FEP3_MAPPING_COMPILATION_DEFAULT_VALUE};
+    /// Compiled targets by their handle, shared to keep the type incomplete in this header
+    std::map<handle_t, std::shared_ptr<CompiledTarget>> _compiled_targets{};
+    /// Source signals of the compiled targets by their name
+    std::map<std::string, std::shared_ptr<CompiledSource>> _compiled_sources{};
+    /// Minimal count of compiled targets of a source signal to evaluate them in parallel
+    size_t _parallel_evaluation_threshold{FEP3_MAPPING_PARALLEL_EVALUATION_THRESHOLD_DEFAULT_VALUE};
+    /// Worker pool evaluating compiled targets in parallel, created on start if needed
+    std::shared_ptr<ThreadPoolExecutor> _worker_pool{};
+    /// Count of users by source signal name
+    std::map<std::string, size_t> _source_signals{};
+    /// Receivers of the mapping engine by source signal name
+    std::map<std::string, std::shared_ptr<IDataRegistry::IDataReceiver>> _engine_sources{};
+    /// Whether compiled targets are triggered, set between start and stop of the mapping
+    std::atomic<bool> _compiled_targets_running{false};
 };
 
 } // namespace arya
@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "mapping_program.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+using namespace fep3::native;
+
+namespace {
+using Converter = void (*)(const void* source, void* target);
+
+template <typename Source, typename Target>
+void convert(const void* source, void* target)
+{
+    Source source_value;
+    std::memcpy(&source_value, source, sizeof(Source));
+    const auto target_value = static_cast<Target>(source_value);
+    std::memcpy(target, &target_value, sizeof(Target));
+}
+
+template <typename Source>
+Converter getConverter(MappingElementType target_type)
+{
+    switch (target_type) {
+    case MappingElementType::Bool:
+        return &convert<Source, bool>;
+    case MappingElementType::Char:
+        return &convert<Source, char>;
+    case MappingElementType::UInt8:
+        return &convert<Source, uint8_t>;
+    case MappingElementType::Int8:
+        return &convert<Source, int8_t>;
+    case MappingElementType::UInt16:
+        return &convert<Source, uint16_t>;
+    case MappingElementType::Int16:
+        return &convert<Source, int16_t>;
+    case MappingElementType::UInt32:
+        return &convert<Source, uint32_t>;
+    case MappingElementType::Int32:
+        return &convert<Source, int32_t>;
+    case MappingElementType::UInt64:
+        return &convert<Source, uint64_t>;
+    case MappingElementType::Int64:
+        return &convert<Source, int64_t>;
+    case MappingElementType::Float32:
+        return &convert<Source, float>;
+    case MappingElementType::Float64:
+        return &convert<Source, double>;
+    }
+    return nullptr;
+}
+
+Converter getConverter(MappingElementType source_type, MappingElementType target_type)
+{
+    switch (source_type) {
+    case MappingElementType::Bool:
+        return getConverter<bool>(target_type);
+    case MappingElementType::Char:
+        return getConverter<char>(target_type);
+    case MappingElementType::UInt8:
+        return getConverter<uint8_t>(target_type);
+    case MappingElementType::Int8:
+        return getConverter<int8_t>(target_type);
+    case MappingElementType::UInt16:
+        return getConverter<uint16_t>(target_type);
+    case MappingElementType::Int16:
+        return getConverter<int16_t>(target_type);
+    case MappingElementType::UInt32:
+        return getConverter<uint32_t>(target_type);
+    case MappingElementType::Int32:
+        return getConverter<int32_t>(target_type);
+    case MappingElementType::UInt64:
+        return getConverter<uint64_t>(target_type);
+    case MappingElementType::Int64:
+        return getConverter<int64_t>(target_type);
+    case MappingElementType::Float32:
+        return getConverter<float>(target_type);
+    case MappingElementType::Float64:
+        return getConverter<double>(target_type);
+    }
+    return nullptr;
+}
+} // namespace
+
+bool fep3::native::arya::getMappingElementType(const std::string& ddl_type_name,
+                                               MappingElementType& type)
+{
+    // predefined ddl data types and their c type aliases
+    static const std::map<std::string, MappingElementType> predefined_types{
+        {"tBool", MappingElementType::Bool},       {"bool", MappingElementType::Bool},
+        {"tChar", MappingElementType::Char},       {"char", MappingElementType::Char},
+        {"tUInt8", MappingElementType::UInt8},     {"uint8_t", MappingElementType::UInt8},
+        {"tInt8", MappingElementType::Int8},       {"int8_t", MappingElementType::Int8},
+        {"tUInt16", MappingElementType::UInt16},   {"uint16_t", MappingElementType::UInt16},
+        {"tInt16", MappingElementType::Int16},     {"int16_t", MappingElementType::Int16},
+        {"tUInt32", MappingElementType::UInt32},   {"uint32_t", MappingElementType::UInt32},
+        {"tInt32", MappingElementType::Int32},     {"int32_t", MappingElementType::Int32},
+        {"tUInt64", MappingElementType::UInt64},   {"uint64_t", MappingElementType::UInt64},
+        {"tInt64", MappingElementType::Int64},     {"int64_t", MappingElementType::Int64},
+        {"tFloat32", MappingElementType::Float32}, {"float", MappingElementType::Float32},
+        {"tFloat64", MappingElementType::Float64}, {"double", MappingElementType::Float64}};
+
+    const auto found = predefined_types.find(ddl_type_name);
+    if (found == predefined_types.end()) {
+        return false;
+    }
+    type = found->second;
+    return true;
+}
+
+size_t fep3::native::arya::getMappingElementSize(MappingElementType type)
+{
+    switch (type) {
+    case MappingElementType::Bool:
+        return sizeof(bool);
+    case MappingElementType::Char:
+    case MappingElementType::UInt8:
+    case MappingElementType::Int8:
+        return 1;
+    case MappingElementType::UInt16:
+    case MappingElementType::Int16:
+        return 2;
+    case MappingElementType::UInt32:
+    case MappingElementType::Int32:
+    case MappingElementType::Float32:
+        return 4;
+    case MappingElementType::UInt64:
+    case MappingElementType::Int64:
+    case MappingElementType::Float64:
+        return 8;
+    }
+    return 0;
+}
+
+void fep3::native::arya::convertMappingElement(const void* source,
+                                               MappingElementType source_type,
+                                               void* target,
+                                               MappingElementType target_type)
+{
+    getConverter(source_type, target_type)(source, target);
+}
+
+void MappingProgram::addAssignment(size_t source_offset,
+                                   MappingElementType source_type,
+                                   size_t target_offset,
+                                   MappingElementType target_type)
+{
+    if (source_type == target_type) {
+        addCopy(source_offset, target_offset, getMappingElementSize(source_type));
+        return;
+    }
+    _operations.push_back({source_offset,
+                           target_offset,
+                           getMappingElementSize(target_type),
+                           getConverter(source_type, target_type)});
+    _source_size = std::max(_source_size, source_offset + getMappingElementSize(source_type));
+    _target_size = std::max(_target_size, target_offset + getMappingElementSize(target_type));
+}
+
+void MappingProgram::addCopy(size_t source_offset, size_t target_offset, size_t size)
+{
+    _operations.push_back({source_offset, target_offset, size, nullptr});
+    _source_size = std::max(_source_size, source_offset + size);
+    _target_size = std::max(_target_size, target_offset + size);
+}
+
+void MappingProgram::finalize()
+{
+    std::stable_sort(_operations.begin(),
+                     _operations.end(),
+                     [](const Operation& left, const Operation& right) {
+                         return left._source_offset < right._source_offset;
+                     });
+
+    std::vector<Operation> merged_operations;
+    merged_operations.reserve(_operations.size());
+    for (const auto& operation: _operations) {
+        if (!merged_operations.empty()) {
+            auto& previous = merged_operations.back();
+            if (!previous._convert && !operation._convert &&
+                previous._source_offset + previous._size == operation._source_offset &&
+                previous._target_offset + previous._size == operation._target_offset) {
+                previous._size += operation._size;
+                continue;
+            }
+        }
+        merged_operations.push_back(operation);
+    }
+    _operations = std::move(merged_operations);
+}
+
+void MappingProgram::run(const void* source, void* target) const
+{
+    const auto source_memory = static_cast<const uint8_t*>(source);
+    const auto target_memory = static_cast<uint8_t*>(target);
+    for (const auto& operation: _operations) {
+        if (operation._convert) {
+            operation._convert(source_memory + operation._source_offset,
+                               target_memory + operation._target_offset);
+        }
+        else {
+            std::memcpy(target_memory + operation._target_offset,
+                        source_memory + operation._source_offset,
+                        operation._size);
+        }
+    }
+}
+
+size_t MappingProgram::getOperationCount() const
+{
+    return _operations.size();
+}
+
+size_t MappingProgram::getSourceSize() const
+{
+    return _source_size;
+}
+
+size_t MappingProgram::getTargetSize() const
+{
+    return _target_size;
+}
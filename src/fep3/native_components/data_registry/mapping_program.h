@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+namespace arya {
+/**
+ * @brief Primitive ddl data types a mapping program copies or converts between
+ */
+enum class MappingElementType : uint8_t
+{
+    Bool,
+    Char,
+    UInt8,
+    Int8,
+    UInt16,
+    Int16,
+    UInt32,
+    Int32,
+    UInt64,
+    Int64,
+    Float32,
+    Float64
+};
+
+/**
+ * @brief Gets the primitive element type of a predefined ddl data type
+ *
+ * @param [in] ddl_type_name Name of the ddl data type, e.g. "tUInt16"
+ * @param [out] type The primitive element type
+ * @return false if @p ddl_type_name is not a predefined ddl data type
+ */
+bool getMappingElementType(const std::string& ddl_type_name, MappingElementType& type);
+
+/**
+ * @brief Gets the size in bytes of a primitive element type
+ */
+size_t getMappingElementSize(MappingElementType type);
+
+/**
+ * @brief Converts a single value between primitive element types like a static_cast does
+ *
+ * @param [in] source Memory of the source value, does not need to be aligned
+ * @param [in] source_type Type of the source value
+ * @param [out] target Memory of the target value, does not need to be aligned
+ * @param [in] target_type Type of the target value
+ */
+void convertMappingElement(const void* source,
+                           MappingElementType source_type,
+                           void* target,
+                           MappingElementType target_type);
+
+/**
+ * @brief Flat list of copy operations mapping the deserialized memory of a source signal into the
+ * deserialized memory of a target signal.
+ *
+ * Assignments of elements with equal types become plain byte copies, all other assignments become
+ * single element conversions. @ref finalize merges copies of adjacent source and target memory
+ * into a single memcpy.
+ */
+class MappingProgram {
+public:
+    /**
+     * @brief Adds an assignment of a source element to a target element
+     *
+     * @param [in] source_offset Byte position of the element in the source memory
+     * @param [in] source_type Type of the source element
+     * @param [in] target_offset Byte position of the element in the target memory
+     * @param [in] target_type Type of the target element
+     */
+    void addAssignment(size_t source_offset,
+                       MappingElementType source_type,
+                       size_t target_offset,
+                       MappingElementType target_type);
+
+    /**
+     * @brief Adds a byte copy from the source memory to the target memory
+     *
+     * @param [in] source_offset Byte position of the first byte in the source memory
+     * @param [in] target_offset Byte position of the first byte in the target memory
+     * @param [in] size Count of bytes to copy
+     */
+    void addCopy(size_t source_offset, size_t target_offset, size_t size);
+
+    /**
+     * @brief Sorts the operations by their source position and merges adjacent copies.
+     * Has to be called after the last operation was added.
+     */
+    void finalize();
+
+    /**
+     * @brief Executes all operations
+     *
+     * @param [in] source Source memory, at least @ref getSourceSize bytes
+     * @param [out] target Target memory, at least @ref getTargetSize bytes
+     */
+    void run(const void* source, void* target) const;
+
+    /// Gets the count of operations, which is the count of memcpys and conversions per run
+    size_t getOperationCount() const;
+    /// Gets the minimal size of the source memory accessed by @ref run
+    size_t getSourceSize() const;
+    /// Gets the minimal size of the target memory accessed by @ref run
+    size_t getTargetSize() const;
+
+private:
+    struct Operation {
+        size_t _source_offset;
+        size_t _target_offset;
+        size_t _size;
+        /// Element conversion, plain byte copy if nullptr
+        void (*_convert)(const void* source, void* target);
+    };
+
+    std::vector<Operation> _operations{};
+    size_t _source_size{0};
+    size_t _target_size{0};
+};
+
+} // namespace arya
+using arya::MappingElementType;
+using arya::MappingProgram;
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,586 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "capture_file.h"
+
+#include <fep3/base/stream_type/stream_type.h>
+
+#ifdef WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif // NOMINMAX
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+namespace {
+
+constexpr char capture_file_magic[8] = "FEP3CAP";
+constexpr uint32_t capture_file_version = 1;
+constexpr size_t record_alignment = 8;
+
+// the header is shared through the mapping, also with readers of other processes
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) &&
+                  std::atomic<uint64_t>::is_always_lock_free,
+              "the capture file header requires lock free 64 bit atomics");
+
+size_t align(size_t size)
+{
+    return (size + record_alignment - 1) & ~(record_alignment - 1);
+}
+
+/// Raw memory writing into a fixed memory area of the mapping
+class FixedRawMemory : public fep3::arya::IRawMemory {
+public:
+    FixedRawMemory(uint8_t* data, size_t capacity) : _data(data), _capacity(capacity)
+    {
+    }
+
+    size_t capacity() const override
+    {
+        return _capacity;
+    }
+
+    const void* cdata() const override
+    {
+        return _data;
+    }
+
+    size_t size() const override
+    {
+        return _size;
+    }
+
+    size_t set(const void* data, size_t data_size) override
+    {
+        _size = std::min(data_size, _capacity);
+        if (0 < _size) {
+            std::memcpy(_data, data, _size);
+        }
+        return _size;
+    }
+
+    size_t resize(size_t data_size) override
+    {
+        _size = std::min(data_size, _capacity);
+        return _size;
+    }
+
+private:
+    uint8_t* _data;
+    size_t _capacity;
+    size_t _size{0};
+};
+
+size_t getStringsSize(const fep3::IStreamType& stream_type)
+{
+    size_t size = stream_type.getMetaTypeName().size() + 1;
+    for (const auto& property_name: stream_type.getPropertyNames()) {
+        size += property_name.size() + 1;
+        size += stream_type.getProperty(property_name).size() + 1;
+        size += stream_type.getPropertyType(property_name).size() + 1;
+    }
+    return size;
+}
+
+uint8_t* writeString(uint8_t* data, const std::string& value)
+{
+    std::memcpy(data, value.c_str(), value.size() + 1);
+    return data + value.size() + 1;
+}
+
+bool readString(const uint8_t* data, size_t size, size_t& position, std::string& value)
+{
+    const auto begin = data + position;
+    const auto end = std::find(begin, data + size, 0);
+    if (end == data + size) {
+        return false;
+    }
+    value.assign(begin, end);
+    position = static_cast<size_t>(end - data) + 1;
+    return true;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace native {
+
+#ifdef WIN32
+struct MappedFile::Handle {
+    HANDLE _file{INVALID_HANDLE_VALUE};
+    HANDLE _mapping{nullptr};
+
+    ~Handle()
+    {
+        if (_mapping) {
+            CloseHandle(_mapping);
+        }
+        if (_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(_file);
+        }
+    }
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string& path, size_t size)
+{
+    auto handle = std::make_unique<Handle>();
+    handle->_file = CreateFileA(path.c_str(),
+                                GENERIC_READ | GENERIC_WRITE,
+                                FILE_SHARE_READ,
+                                nullptr,
+                                CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL,
+                                nullptr);
+    if (handle->_file == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+    const auto size_high = static_cast<DWORD>(static_cast<uint64_t>(size) >> 32);
+    const auto size_low = static_cast<DWORD>(size & 0xFFFFFFFFu);
+    handle->_mapping =
+        CreateFileMappingA(handle->_file, nullptr, PAGE_READWRITE, size_high, size_low, nullptr);
+    if (!handle->_mapping) {
+        return nullptr;
+    }
+    const auto data = MapViewOfFile(handle->_mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (!data) {
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(
+        new MappedFile(std::move(handle), static_cast<uint8_t*>(data), size));
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& path)
+{
+    auto handle = std::make_unique<Handle>();
+    handle->_file = CreateFileA(path.c_str(),
+                                GENERIC_READ,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL,
+                                nullptr);
+    LARGE_INTEGER size;
+    if (handle->_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(handle->_file, &size) ||
+        size.QuadPart == 0) {
+        return nullptr;
+    }
+    handle->_mapping = CreateFileMappingA(handle->_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!handle->_mapping) {
+        return nullptr;
+    }
+    const auto data = MapViewOfFile(handle->_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(new MappedFile(
+        std::move(handle), static_cast<uint8_t*>(data), static_cast<size_t>(size.QuadPart)));
+}
+
+MappedFile::~MappedFile()
+{
+    UnmapViewOfFile(_data);
+}
+
+void MappedFile::flush() const
+{
+    FlushViewOfFile(_data, _size);
+}
+#else
+struct MappedFile::Handle {
+    int _file{-1};
+
+    ~Handle()
+    {
+        if (_file != -1) {
+            ::close(_file);
+        }
+    }
+};
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string& path, size_t size)
+{
+    auto handle = std::make_unique<Handle>();
+    handle->_file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (handle->_file == -1 || ::ftruncate(handle->_file, static_cast<off_t>(size)) != 0) {
+        return nullptr;
+    }
+    const auto data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle->_file, 0);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(
+        new MappedFile(std::move(handle), static_cast<uint8_t*>(data), size));
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& path)
+{
+    auto handle = std::make_unique<Handle>();
+    handle->_file = ::open(path.c_str(), O_RDONLY);
+    struct stat file_status;
+    if (handle->_file == -1 || ::fstat(handle->_file, &file_status) != 0 ||
+        file_status.st_size == 0) {
+        return nullptr;
+    }
+    const auto size = static_cast<size_t>(file_status.st_size);
+    const auto data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, handle->_file, 0);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::unique_ptr<MappedFile>(
+        new MappedFile(std::move(handle), static_cast<uint8_t*>(data), size));
+}
+
+MappedFile::~MappedFile()
+{
+    ::munmap(_data, _size);
+}
+
+void MappedFile::flush() const
+{
+    ::msync(_data, _size, MS_SYNC);
+}
+#endif
+
+MappedFile::MappedFile(std::unique_ptr<Handle> handle, uint8_t* data, size_t size)
+    : _handle(std::move(handle)), _data(data), _size(size)
+{
+}
+
+uint8_t* MappedFile::getData() const
+{
+    return _data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return _size;
+}
+
+std::unique_ptr<CaptureFileWriter> CaptureFileWriter::create(const std::string& path,
+                                                             size_t file_size,
+                                                             uint32_t index_interval)
+{
+    const size_t index_offset = align(sizeof(CaptureFileHeader));
+    if (index_interval < record_alignment || file_size <= index_offset) {
+        return nullptr;
+    }
+    // every index interval of the record area needs one index entry
+    const size_t index_capacity =
+        (file_size - index_offset) / (index_interval + sizeof(CaptureIndexEntry)) + 1;
+    const size_t records_offset = index_offset + index_capacity * sizeof(CaptureIndexEntry);
+    if (file_size <= records_offset) {
+        return nullptr;
+    }
+
+    auto file = MappedFile::create(path, file_size);
+    if (!file) {
+        return nullptr;
+    }
+    auto header = new (file->getData()) CaptureFileHeader();
+    std::memcpy(header->_magic, capture_file_magic, sizeof(capture_file_magic));
+    header->_version = capture_file_version;
+    header->_index_interval = index_interval;
+    header->_index_offset = index_offset;
+    header->_index_capacity = index_capacity;
+    header->_records_offset = records_offset;
+    header->_records_capacity = file_size - records_offset;
+    return std::unique_ptr<CaptureFileWriter>(new CaptureFileWriter(std::move(file)));
+}
+
+CaptureFileWriter::CaptureFileWriter(std::unique_ptr<MappedFile> file)
+    : _file(std::move(file)),
+      _header(reinterpret_cast<CaptureFileHeader*>(_file->getData())),
+      _index(reinterpret_cast<CaptureIndexEntry*>(_file->getData() + _header->_index_offset)),
+      _records(_file->getData() + _header->_records_offset)
+{
+}
+
+CaptureFileWriter::~CaptureFileWriter()
+{
+    flush();
+}
+
+bool CaptureFileWriter::appendSignal(uint32_t signal_id, const std::string& signal_name)
+{
+    const auto payload = beginRecord(CaptureRecordType::signal, signal_id, signal_name.size() + 1);
+    if (!payload) {
+        return false;
+    }
+    writeString(payload, signal_name);
+    linkMetaRecord();
+    endRecord();
+    return true;
+}
+
+bool CaptureFileWriter::append(uint32_t signal_id, const IDataSample& sample)
+{
+    const auto size = sample.getSize();
+    const auto payload = beginRecord(CaptureRecordType::sample, signal_id, size);
+    if (!payload) {
+        return false;
+    }
+    FixedRawMemory memory(payload, size);
+    sample.read(memory);
+    _current_record->_size = static_cast<uint32_t>(memory.size());
+    _current_record->_counter = sample.getCounter();
+    _current_record->_time = sample.getTime().count();
+
+    // index the first sample starting in each index interval
+    const auto offset = static_cast<uint64_t>(reinterpret_cast<uint8_t*>(_current_record) -
+                                              _records);
+    // the entries are published by the release of the index count
+    const auto old_index_count = _header->_index_count.load(std::memory_order_relaxed);
+    auto index_count = old_index_count;
+    while (index_count <= offset / _header->_index_interval &&
+           index_count < _header->_index_capacity) {
+        _index[index_count] = {_current_record->_time, offset};
+        ++index_count;
+    }
+    if (index_count != old_index_count) {
+        _header->_index_count.store(index_count, std::memory_order_release);
+    }
+    endRecord();
+    return true;
+}
+
+bool CaptureFileWriter::append(uint32_t signal_id, const IStreamType& stream_type)
+{
+    const auto payload =
+        beginRecord(CaptureRecordType::stream_type, signal_id, getStringsSize(stream_type));
+    if (!payload) {
+        return false;
+    }
+    auto position = writeString(payload, stream_type.getMetaTypeName());
+    for (const auto& property_name: stream_type.getPropertyNames()) {
+        position = writeString(position, property_name);
+        position = writeString(position, stream_type.getProperty(property_name));
+        position = writeString(position, stream_type.getPropertyType(property_name));
+    }
+    linkMetaRecord();
+    endRecord();
+    return true;
+}
+
+void CaptureFileWriter::countOverflow(uint64_t count)
+{
+    _header->_overflow_count.fetch_add(count, std::memory_order_relaxed);
+}
+
+uint64_t CaptureFileWriter::getOverflowCount() const
+{
+    return _header->_overflow_count.load(std::memory_order_relaxed);
+}
+
+void CaptureFileWriter::flush() const
+{
+    _file->flush();
+}
+
+uint8_t* CaptureFileWriter::beginRecord(CaptureRecordType type,
+                                        uint32_t signal_id,
+                                        size_t payload_size)
+{
+    const auto record_size = align(sizeof(CaptureRecordHeader) + payload_size);
+    // the writer is the only one modifying the header
+    const auto records_size = _header->_records_size.load(std::memory_order_relaxed);
+    if (payload_size > UINT32_MAX || _header->_records_capacity - records_size < record_size) {
+        countOverflow(1);
+        return nullptr;
+    }
+    _current_record = reinterpret_cast<CaptureRecordHeader*>(_records + records_size);
+    _current_record->_size = static_cast<uint32_t>(payload_size);
+    _current_record->_type = type;
+    _current_record->_signal_id = signal_id;
+    _current_record->_counter = 0;
+    _current_record->_time = 0;
+    return reinterpret_cast<uint8_t*>(_current_record + 1);
+}
+
+void CaptureFileWriter::endRecord()
+{
+    // the record becomes visible to readers by the release of the records size, a meta record
+    // is linked only once it is covered by the records size
+    _header->_records_size.store(_header->_records_size.load(std::memory_order_relaxed) +
+                                     align(sizeof(CaptureRecordHeader) + _current_record->_size),
+                                 std::memory_order_release);
+    _header->_record_count.fetch_add(1, std::memory_order_relaxed);
+    if (_current_meta_link != 0) {
+        _header->_last_meta_link.store(_current_meta_link, std::memory_order_release);
+        _current_meta_link = 0;
+    }
+    _current_record = nullptr;
+}
+
+void CaptureFileWriter::linkMetaRecord()
+{
+    const auto offset = static_cast<uint64_t>(reinterpret_cast<uint8_t*>(_current_record) -
+                                              _records);
+    _current_record->_time =
+        static_cast<int64_t>(_header->_last_meta_link.load(std::memory_order_relaxed));
+    _current_meta_link = offset + 1;
+}
+
+std::unique_ptr<CaptureFileReader> CaptureFileReader::open(const std::string& path)
+{
+    auto file = MappedFile::open(path);
+    if (!file || file->getSize() < sizeof(CaptureFileHeader)) {
+        return nullptr;
+    }
+    const auto header = reinterpret_cast<const CaptureFileHeader*>(file->getData());
+    if (std::memcmp(header->_magic, capture_file_magic, sizeof(capture_file_magic)) != 0 ||
+        header->_version != capture_file_version) {
+        return nullptr;
+    }
+    // the areas are checked without overflowing sums, a corrupt file must not let the reader
+    // access memory outside of the mapping
+    const uint64_t file_size = file->getSize();
+    if (header->_index_offset < sizeof(CaptureFileHeader) ||
+        header->_index_offset % alignof(CaptureIndexEntry) != 0 ||
+        header->_records_offset % record_alignment != 0 ||
+        header->_records_offset < header->_index_offset ||
+        header->_records_offset > file_size ||
+        header->_index_capacity >
+            (header->_records_offset - header->_index_offset) / sizeof(CaptureIndexEntry) ||
+        header->_records_capacity > file_size - header->_records_offset ||
+        header->_index_count.load(std::memory_order_acquire) > header->_index_capacity ||
+        header->_records_size.load(std::memory_order_acquire) > header->_records_capacity) {
+        return nullptr;
+    }
+    return std::unique_ptr<CaptureFileReader>(new CaptureFileReader(std::move(file)));
+}
+
+CaptureFileReader::CaptureFileReader(std::unique_ptr<MappedFile> file)
+    : _file(std::move(file)),
+      _header(reinterpret_cast<const CaptureFileHeader*>(_file->getData())),
+      _index(reinterpret_cast<const CaptureIndexEntry*>(_file->getData() + _header->_index_offset)),
+      _records(_file->getData() + _header->_records_offset)
+{
+}
+
+uint64_t CaptureFileReader::findSample(Timestamp time) const
+{
+    const auto records_size = _header->_records_size.load(std::memory_order_acquire);
+    // the count is limited to the capacity checked on open, the file may be written meanwhile
+    const auto index_count = std::min(_header->_index_count.load(std::memory_order_acquire),
+                                      _header->_index_capacity);
+    // the entry of a record being written may precede the record becoming complete
+    const auto index_end = std::partition_point(
+        _index, _index + index_count, [&](const CaptureIndexEntry& entry) {
+            return entry._offset < records_size;
+        });
+    // the last entry before the time, the sample of the time may follow within its interval
+    const auto entry = std::lower_bound(
+        _index, index_end, time.count(), [](const CaptureIndexEntry& entry, int64_t entry_time) {
+            return entry._time < entry_time;
+        });
+    uint64_t offset = (entry == _index) ? 0 : std::prev(entry)->_offset;
+
+    CaptureRecord record;
+    for (auto next_offset = offset; read(next_offset, record); offset = next_offset) {
+        if (record._type == CaptureRecordType::sample && record._time >= time) {
+            return offset;
+        }
+    }
+    return records_size;
+}
+
+std::vector<uint64_t> CaptureFileReader::getMetaRecordOffsets() const
+{
+    std::vector<uint64_t> offsets;
+    // the link is published after the records size covering its record
+    const auto last_link = _header->_last_meta_link.load(std::memory_order_acquire);
+    const auto records_size = _header->_records_size.load(std::memory_order_acquire);
+    for (auto link = last_link; link != 0 && link <= records_size;) {
+        const auto offset = link - 1;
+        offsets.push_back(offset);
+        const auto next_link = static_cast<uint64_t>(
+            reinterpret_cast<const CaptureRecordHeader*>(_records + offset)->_time);
+        // the chain runs backwards only, anything else is a corrupt file
+        if (next_link > offset) {
+            break;
+        }
+        link = next_link;
+    }
+    std::reverse(offsets.begin(), offsets.end());
+    return offsets;
+}
+
+bool CaptureFileReader::read(uint64_t& offset, CaptureRecord& record) const
+{
+    const auto records_size = _header->_records_size.load(std::memory_order_acquire);
+    if (offset + sizeof(CaptureRecordHeader) > records_size) {
+        return false;
+    }
+    const auto record_header = reinterpret_cast<const CaptureRecordHeader*>(_records + offset);
+    const auto record_size = align(sizeof(CaptureRecordHeader) + record_header->_size);
+    if (offset + record_size > records_size) {
+        return false;
+    }
+    record._type = record_header->_type;
+    record._signal_id = record_header->_signal_id;
+    record._counter = record_header->_counter;
+    record._time = Timestamp(record_header->_time);
+    record._data = reinterpret_cast<const uint8_t*>(record_header + 1);
+    record._size = record_header->_size;
+    offset += record_size;
+    return true;
+}
+
+uint64_t CaptureFileReader::getRecordCount() const
+{
+    return _header->_record_count.load(std::memory_order_relaxed);
+}
+
+uint64_t CaptureFileReader::getOverflowCount() const
+{
+    return _header->_overflow_count.load(std::memory_order_relaxed);
+}
+
+const CaptureFileHeader& CaptureFileReader::getHeader() const
+{
+    return *_header;
+}
+
+data_read_ptr<const IStreamType> toStreamType(const CaptureRecord& record)
+{
+    size_t position = 0;
+    std::string meta_type_name;
+    if (record._type != CaptureRecordType::stream_type ||
+        !readString(record._data, record._size, position, meta_type_name)) {
+        return nullptr;
+    }
+
+    auto stream_type = std::make_shared<base::StreamType>(base::StreamMetaType(meta_type_name));
+    std::string name, value, type;
+    while (position < record._size) {
+        if (!readString(record._data, record._size, position, name) ||
+            !readString(record._data, record._size, position, value) ||
+            !readString(record._data, record._size, position, type)) {
+            return nullptr;
+        }
+        stream_type->setProperty(name, value, type);
+    }
+    return stream_type;
+}
+
+} // namespace native
+} // namespace fep3
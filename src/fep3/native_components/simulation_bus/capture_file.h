@@ -0,0 +1,355 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/base/sample/data_sample_intf.h>
+#include <fep3/base/stream_type/stream_type_intf.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief File mapped into memory, either preallocated for writing or read-only
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Creates (or truncates) a file of the given size and maps it for writing
+     *
+     * @param[in] path path of the file
+     * @param[in] size size of the file in bytes
+     * @return the mapped file, nullptr if the file could not be created or mapped
+     */
+    static std::unique_ptr<MappedFile> create(const std::string& path, size_t size);
+
+    /**
+     * @brief Maps an existing file read-only
+     *
+     * @param[in] path path of the file
+     * @return the mapped file, nullptr if the file could not be opened or mapped
+     */
+    static std::unique_ptr<MappedFile> open(const std::string& path);
+
+    /// DTOR, unmaps and closes the file
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /**
+     * @brief Gets the mapped memory
+     *
+     * @return pointer to the first byte of the file
+     */
+    uint8_t* getData() const;
+
+    /**
+     * @brief Gets the size of the mapping
+     *
+     * @return the size in bytes
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Writes the modified pages of the mapping back to the file
+     */
+    void flush() const;
+
+private:
+    struct Handle;
+    MappedFile(std::unique_ptr<Handle> handle, uint8_t* data, size_t size);
+
+    std::unique_ptr<Handle> _handle;
+    uint8_t* const _data;
+    const size_t _size;
+};
+
+/**
+ * @brief Type of a record of a capture file
+ */
+enum class CaptureRecordType : uint32_t
+{
+    /// defines the name of a signal id, the payload is the signal name
+    signal = 1,
+    /// a sample, the payload is the sample data
+    sample = 2,
+    /// a stream type, the payload is the meta type name followed by name, value and type of each
+    /// property, all of them zero terminated
+    stream_type = 3
+};
+
+/**
+ * @brief Header at the beginning of a capture file.
+ * A capture file consists of the header, the time index and the record area. Records are
+ * appended to the record area only, the header is updated after every record, so a capture file
+ * is readable up to the last complete record even if the recording has been aborted.
+ * The fields changing while recording are atomics the writer stores with release order after
+ * the records and index entries they cover, so a file may be read while it is still recorded.
+ */
+struct CaptureFileHeader {
+    /// "FEP3CAP" zero terminated
+    char _magic[8];
+    /// version of the file format
+    uint32_t _version;
+    /// number of record area bytes covered by one index entry
+    uint32_t _index_interval;
+    /// offset of the index from the beginning of the file
+    uint64_t _index_offset;
+    /// max number of index entries
+    uint64_t _index_capacity;
+    /// number of valid index entries
+    std::atomic<uint64_t> _index_count;
+    /// offset of the record area from the beginning of the file
+    uint64_t _records_offset;
+    /// size of the record area
+    uint64_t _records_capacity;
+    /// number of bytes of the record area holding complete records
+    std::atomic<uint64_t> _records_size;
+    /// number of complete records
+    std::atomic<uint64_t> _record_count;
+    /// number of items which could not be recorded
+    std::atomic<uint64_t> _overflow_count;
+    /// link to the last signal or stream type record, see @ref CaptureRecordHeader::_time
+    std::atomic<uint64_t> _last_meta_link;
+};
+
+/**
+ * @brief Entry of the time index of a capture file.
+ * Entry n refers to the first sample record starting at or behind n times the index interval
+ * within the record area.
+ */
+struct CaptureIndexEntry {
+    /// time of the sample in ns
+    int64_t _time;
+    /// offset of the sample record within the record area
+    uint64_t _offset;
+};
+
+/**
+ * @brief Header of a record of a capture file, followed by the payload.
+ * Records are aligned to 8 bytes. The signal and stream type records are chained backwards, so
+ * they can be found without reading the sample records in between.
+ */
+struct CaptureRecordHeader {
+    /// size of the payload in bytes
+    uint32_t _size;
+    /// type of the record
+    CaptureRecordType _type;
+    /// id of the signal, as defined by the preceding signal record
+    uint32_t _signal_id;
+    /// counter of the sample
+    uint32_t _counter;
+    /// time of the sample in ns, for signal and stream type records the link to the preceding
+    /// signal or stream type record instead, which is its offset + 1 (0 if there is none)
+    int64_t _time;
+};
+
+/**
+ * @brief Appends records to a preallocated memory mapped capture file.
+ * Payloads are written straight into the mapping. Records which do not fit into the remaining
+ * record area are not written but counted as overflow.
+ *
+ * @remark This is not threadsafe, there must be only one thread appending records.
+ */
+class CaptureFileWriter {
+public:
+    /// default number of record area bytes covered by one index entry
+    static constexpr uint32_t default_index_interval = 64 * 1024;
+
+    /**
+     * @brief Creates a capture file
+     *
+     * @param[in] path path of the file, an existing file is overwritten
+     * @param[in] file_size size of the preallocated file in bytes
+     * @param[in] index_interval number of record area bytes covered by one index entry
+     * @return the writer, nullptr if the file could not be created or is too small
+     */
+    static std::unique_ptr<CaptureFileWriter> create(
+        const std::string& path,
+        size_t file_size,
+        uint32_t index_interval = default_index_interval);
+
+    /// DTOR, flushes the file
+    ~CaptureFileWriter();
+    CaptureFileWriter(const CaptureFileWriter&) = delete;
+    CaptureFileWriter(CaptureFileWriter&&) = delete;
+    CaptureFileWriter& operator=(const CaptureFileWriter&) = delete;
+    CaptureFileWriter& operator=(CaptureFileWriter&&) = delete;
+
+    /**
+     * @brief Appends a signal record defining the name of @p signal_id
+     *
+     * @param[in] signal_id id of the signal
+     * @param[in] signal_name name of the signal
+     * @return @c true if appended, @c false if the record area is full
+     */
+    bool appendSignal(uint32_t signal_id, const std::string& signal_name);
+
+    /**
+     * @brief Appends a sample record
+     *
+     * @param[in] signal_id id of the signal
+     * @param[in] sample the sample
+     * @return @c true if appended, @c false if the record area is full
+     */
+    bool append(uint32_t signal_id, const IDataSample& sample);
+
+    /**
+     * @brief Appends a stream type record
+     *
+     * @param[in] signal_id id of the signal
+     * @param[in] stream_type the stream type
+     * @return @c true if appended, @c false if the record area is full
+     */
+    bool append(uint32_t signal_id, const IStreamType& stream_type);
+
+    /**
+     * @brief Adds items which could not be recorded to the overflow count of the file
+     *
+     * @param[in] count number of items
+     */
+    void countOverflow(uint64_t count);
+
+    /**
+     * @brief Gets the number of items which could not be recorded
+     *
+     * @return the overflow count
+     */
+    uint64_t getOverflowCount() const;
+
+    /**
+     * @brief Writes the modified pages back to the file
+     */
+    void flush() const;
+
+private:
+    explicit CaptureFileWriter(std::unique_ptr<MappedFile> file);
+    uint8_t* beginRecord(CaptureRecordType type, uint32_t signal_id, size_t payload_size);
+    void endRecord();
+    void linkMetaRecord();
+
+    std::unique_ptr<MappedFile> _file;
+    CaptureFileHeader* _header;
+    CaptureIndexEntry* _index;
+    uint8_t* _records;
+    CaptureRecordHeader* _current_record{nullptr};
+    /// link to the current record if it is a signal or stream type record, 0 otherwise
+    uint64_t _current_meta_link{0};
+};
+
+/**
+ * @brief Record read from a capture file, the payload points into the mapping of the file
+ */
+struct CaptureRecord {
+    /// type of the record
+    CaptureRecordType _type;
+    /// id of the signal
+    uint32_t _signal_id;
+    /// counter of the sample
+    uint32_t _counter;
+    /// time of the sample
+    Timestamp _time;
+    /// payload
+    const uint8_t* _data;
+    /// size of the payload in bytes
+    size_t _size;
+};
+
+/**
+ * @brief Reads the records of a memory mapped capture file
+ */
+class CaptureFileReader {
+public:
+    /**
+     * @brief Opens a capture file
+     *
+     * @param[in] path path of the file
+     * @return the reader, nullptr if the file could not be opened or is no valid capture file
+     */
+    static std::unique_ptr<CaptureFileReader> open(const std::string& path);
+
+    /**
+     * @brief Reads the record at @p offset and advances @p offset to the next record
+     *
+     * @param[in,out] offset offset of the record within the record area, 0 for the first record
+     * @param[out] record the record
+     * @return @c true if a record has been read, @c false if there is no complete record at
+     *         @p offset
+     */
+    bool read(uint64_t& offset, CaptureRecord& record) const;
+
+    /**
+     * @brief Finds the first sample record of the given time or later by means of the time index
+     *
+     * @param[in] time the time to find
+     * @return offset of the sample record within the record area, the size of the record area if
+     *         there is no such sample
+     * @remark The index is searched binary assuming the samples have been recorded in the order
+     *         of their time, as they are when transmitted following the simulation time.
+     */
+    uint64_t findSample(Timestamp time) const;
+
+    /**
+     * @brief Gets the offsets of all signal and stream type records by their backward chain
+     *
+     * @return the offsets within the record area in ascending order
+     */
+    std::vector<uint64_t> getMetaRecordOffsets() const;
+
+    /**
+     * @brief Gets the number of complete records
+     *
+     * @return the record count
+     */
+    uint64_t getRecordCount() const;
+
+    /**
+     * @brief Gets the number of items which could not be recorded
+     *
+     * @return the overflow count
+     */
+    uint64_t getOverflowCount() const;
+
+    /**
+     * @brief Gets the header of the file
+     *
+     * @return the header
+     */
+    const CaptureFileHeader& getHeader() const;
+
+private:
+    explicit CaptureFileReader(std::unique_ptr<MappedFile> file);
+
+    std::unique_ptr<MappedFile> _file;
+    const CaptureFileHeader* _header;
+    const CaptureIndexEntry* _index;
+    const uint8_t* _records;
+};
+
+/**
+ * @brief Deserializes the payload of a stream type record
+ *
+ * @param[in] record the stream type record
+ * @return the stream type, nullptr if the payload is malformed
+ */
+data_read_ptr<const IStreamType> toStreamType(const CaptureRecord& record);
+
+} // namespace native
+} // namespace fep3
@@ -13,8 +13,13 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #pragma once
 
 #include "data_item_queue_base.h"
+#include "reception_notification.h"
 
+#include <atomic>
+#include <limits>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace fep3 {
 namespace native {
@@ -24,6 +29,8 @@ namespace native {
  * This implementation will provide a FIFO queue to read samples and types in the same order it was
  * added. The capacity of the DataItemQueue is fixed. If samples are pushed into the queue while the
  * queue's capacity is reached old samples are dropped.
+ * The time of the front sample is published through an atomic on every change of the front, so
+ * @ref getFrontTime does not lock the queue.
  *
  * @tparam IDataRegistry::IDataSample class for samples
  * @tparam IStreamType class for types
@@ -33,6 +40,8 @@ class DataItemQueue : public DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE> {
 private:
     using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::DataItem;
     using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::QueueType;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::TimeComparator;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::ItemCallback;
 
 public:
     /**
@@ -40,8 +49,10 @@ public:
      *
      * @param[in] capacity capacity by item count of the queue (there are sample + stream type
      * covered)
+     * @param[in] notification optional notification to be signaled on every push
      */
-    DataItemQueue(size_t capacity) : DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>()
+    DataItemQueue(size_t capacity, std::shared_ptr<ReceptionNotification> notification = {})
+        : DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>(std::move(notification))
     {
         if (capacity <= 0) {
             capacity = 1;
@@ -65,72 +76,60 @@ public:
      */
     void push(const data_read_ptr<SAMPLE_TYPE>& sample) override
     {
-        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
-        if (_next_write_idx == _items.size()) {
-            _next_write_idx = 0;
-        }
-
-        DataItem& ref = _items[_next_write_idx];
-        ref.set(sample);
-
-        ++_next_write_idx;
-        ++_current_size;
-
-        // if queue is full we need to change read index ... item was dropped
-        if (_current_size > capacity()) {
-            if (_next_read_idx == _items.size()) {
-                _next_read_idx = 0;
-            }
-            _current_size = capacity();
-            ++_next_read_idx;
-        }
+        pushItem(sample);
+        // notify outside of the queue lock, so the woken up reception thread can pop immediately
+        this->notify();
     }
     /**
      * @brief pushes a stream type data read pointer to the queue
      *
      * @param[in] type the types read pointer to push
-     * @param[in] time_of_receiving the timestamp at which the sample was received
      * @remark this is threadsafe against push and other pop calls
      */
     void push(const data_read_ptr<STREAM_TYPE>& type) override
     {
-        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
-        if (_next_write_idx == _items.size()) {
-            _next_write_idx = 0;
-        }
-        DataItem& ref = _items[_next_write_idx];
-        ref.set(type);
+        pushItem(type);
+        this->notify();
+    }
 
-        ++_next_write_idx;
-        ++_current_size;
-        // if queue is full we need to change read index ... item was dropped
-        if (_current_size > capacity()) {
-            if (_next_read_idx == _items.size()) {
-                _next_read_idx = 0;
-            }
-            _current_size = capacity();
-            ++_next_read_idx;
-        }
+    /**
+     * @brief pushes a sample data read pointer to the queue unless the capacity is reached
+     *
+     * @param[in] sample the samples read pointer to push
+     * @return @c true if the sample has been pushed, @c false if the queue is full
+     * @remark this is threadsafe against push and other pop calls
+     */
+    bool tryPush(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        return tryPushItem(sample);
+    }
+
+    /**
+     * @brief pushes a stream type data read pointer to the queue unless the capacity is reached
+     *
+     * @param[in] type the types read pointer to push
+     * @return @c true if the stream type has been pushed, @c false if the queue is full
+     * @remark this is threadsafe against push and other pop calls
+     */
+    bool tryPush(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        return tryPushItem(type);
     }
 
+    /**
+     * @brief gets the time of the front item if it is a sample
+     *
+     * @return the time of the front sample, no value if the queue is empty or the front item is
+     *         a stream type
+     * @remark this is lock-free
+     */
     Optional<Timestamp> getFrontTime() override
     {
-        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
-        if (_current_size > 0) {
-            if (_next_read_idx == _items.size()) {
-                _next_read_idx = 0;
-            }
-            DataItem& ref = _items[_next_read_idx];
-            if (DataItem::Type::sample == ref.getItemType()) {
-                return ref.getSample()->getTime();
-            }
-            else {
-                return {};
-            }
-        }
-        else {
+        const auto front_time = _front_time.load(std::memory_order_acquire);
+        if (front_time == no_front_time) {
             return {};
         }
+        return Timestamp(front_time);
     }
 
     /**
@@ -151,20 +150,85 @@ public:
                     _next_read_idx = 0;
                 }
                 DataItem& ref = _items[_next_read_idx];
+                // the slot releases the item, so e.g. pooled samples return to their pool as
+                // soon as the receiver drops them
                 if (DataItem::Type::sample == ref.getItemType()) {
-                    sample = std::move(ref.getSample());
+                    sample = ref.getSample();
+                    ref.resetSample();
                 }
                 else if (DataItem::Type::type == ref.getItemType()) {
-                    stream_type = std::move(ref.getStreamType());
+                    stream_type = ref.getStreamType();
+                    ref.resetStreamType();
                 }
                 ++_next_read_idx;
                 --_current_size;
+                updateFrontTime();
             }
         }
+        if (sample || stream_type) {
+            this->notifyPop();
+        }
 
         return std::make_tuple(std::move(sample), std::move(stream_type));
     }
 
+    /**
+     * @brief pops the items at the front of the queue up to the last due sample in front of the
+     * first sample which is not due, stream types in front of or between the due samples are
+     * popped as well and stream types behind the last due sample are kept
+     *
+     * @param[in] time the time to pop the items until
+     * @param[in] time_comparator returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp
+     * @param[in] callback callback receiving the popped items in order
+     * @return the number of popped items
+     * @remark the queue is locked once for all items, the callback is called after unlocking
+     */
+    size_t popUntil(Timestamp time,
+                    const TimeComparator& time_comparator,
+                    const ItemCallback& callback) override
+    {
+        std::vector<DataItem> due_items;
+        {
+            std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+            size_t item_count = 0;
+            for (size_t offset = 0; offset < _current_size; ++offset) {
+                const DataItem& ref = _items[(_next_read_idx + offset) % _items.size()];
+                if (DataItem::Type::sample == ref.getItemType()) {
+                    if (!time_comparator(ref.getSample()->getTime(), time)) {
+                        break;
+                    }
+                    item_count = offset + 1;
+                }
+            }
+
+            due_items.reserve(item_count);
+            for (size_t index = 0; index < item_count; ++index) {
+                if (_next_read_idx == _items.size()) {
+                    _next_read_idx = 0;
+                }
+                // the slot releases the item like in pop
+                DataItem& ref = _items[_next_read_idx];
+                due_items.push_back(std::move(ref));
+                ref = DataItem();
+                ++_next_read_idx;
+                --_current_size;
+            }
+            if (item_count > 0) {
+                updateFrontTime();
+            }
+        }
+        if (due_items.empty()) {
+            return 0;
+        }
+        this->notifyPop();
+
+        for (const DataItem& data_item: due_items) {
+            callback(data_item.getSample(), data_item.getStreamType());
+        }
+        return due_items.size();
+    }
+
     size_t capacity() const override
     {
         std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
@@ -184,6 +248,8 @@ public:
         _next_write_idx = 0;
         _next_read_idx = 0;
         _current_size = 0;
+        updateFrontTime();
+        this->notifyPop();
     }
 
     QueueType getQueueType() const override
@@ -192,12 +258,72 @@ public:
     }
 
 private:
+    template <typename ITEM_TYPE>
+    bool tryPushItem(const ITEM_TYPE& item)
+    {
+        {
+            std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+            if (_current_size >= _items.size()) {
+                return false;
+            }
+            pushItem(item);
+        }
+        this->notify();
+        return true;
+    }
+
+    template <typename ITEM_TYPE>
+    void pushItem(const ITEM_TYPE& item)
+    {
+        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+        if (_next_write_idx == _items.size()) {
+            _next_write_idx = 0;
+        }
+
+        DataItem& ref = _items[_next_write_idx];
+        ref.set(item);
+
+        ++_next_write_idx;
+        ++_current_size;
+
+        // if queue is full we need to change read index ... item was dropped
+        if (_current_size > capacity()) {
+            if (_next_read_idx == _items.size()) {
+                _next_read_idx = 0;
+            }
+            _current_size = capacity();
+            ++_next_read_idx;
+            this->countDrop();
+            updateFrontTime();
+        }
+        else if (_current_size == 1) {
+            updateFrontTime();
+        }
+        this->countPush(item, _current_size);
+    }
+
+    /// publishes the time of the front item, must be called with the queue locked
+    void updateFrontTime()
+    {
+        auto front_time = no_front_time;
+        if (_current_size > 0) {
+            const DataItem& ref = _items[_next_read_idx == _items.size() ? 0 : _next_read_idx];
+            if (DataItem::Type::sample == ref.getItemType()) {
+                front_time = ref.getSample()->getTime().count();
+            }
+        }
+        _front_time.store(front_time, std::memory_order_release);
+    }
+
+    static constexpr int64_t no_front_time = std::numeric_limits<int64_t>::min();
+
     std::vector<DataItem> _items;
 
     size_t _next_write_idx;
     size_t _next_read_idx;
     size_t _current_size;
     mutable std::recursive_mutex _recursive_mutex;
+    std::atomic<int64_t> _front_time{no_front_time};
 };
 
 } // namespace native
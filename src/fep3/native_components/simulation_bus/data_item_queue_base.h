@@ -12,10 +12,20 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include "reception_notification.h"
+#include "signal_counters.h"
+
 #include <fep3/base/sample/data_sample_intf.h>
 #include <fep3/base/stream_type/stream_type_intf.h>
 #include <fep3/fep3_optional.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 namespace fep3 {
 namespace native {
 /**
@@ -141,11 +151,71 @@ protected:
      */
     virtual QueueType getQueueType() const = 0;
 
+    /**
+     * @brief Signals the reception notification of the queue (if any), to be called on every push
+     */
+    void notify()
+    {
+        if (_notification) {
+            _notification->notify();
+        }
+    }
+
+    /**
+     * @brief Wakes up the writers waiting for free space in the queue by @ref waitForPop, to be
+     * called after every pop and clear which freed space
+     */
+    void notifyPop()
+    {
+        _pop_count.fetch_add(1);
+        if (_pop_waiters.load() > 0) {
+            // a waiter either checks the pop count after the increment or already waits, as it
+            // holds the lock in between
+            std::lock_guard<std::mutex> lock(_pop_mutex);
+            _pop_condition.notify_all();
+        }
+    }
+
+    /**
+     * @brief Counts an item which has been dropped, to be called whenever a push drops the oldest
+     * item because the capacity is reached
+     */
+    void countDrop()
+    {
+        _counters->countDrop();
+    }
+
+    /**
+     * @brief Counts a pushed sample, to be called on every push of a sample
+     *
+     * @param[in] sample the pushed sample
+     * @param[in] queue_size number of items in the queue after the push
+     */
+    void countPush(const data_read_ptr<SAMPLE_TYPE>& sample, size_t queue_size)
+    {
+        _counters->countSample(sample ? sample->getSize() : 0, queue_size);
+    }
+
+    /**
+     * @brief Counts a pushed stream type, to be called on every push of a stream type
+     *
+     * @param[in] queue_size number of items in the queue after the push
+     */
+    void countPush(const data_read_ptr<STREAM_TYPE>&, size_t queue_size)
+    {
+        _counters->countStreamType(queue_size);
+    }
+
 public:
     /**
      * @brief CTOR
+     *
+     * @param[in] notification optional notification to be signaled on every push
      */
-    DataItemQueueBase() = default;
+    explicit DataItemQueueBase(std::shared_ptr<ReceptionNotification> notification = {})
+        : _notification(std::move(notification))
+    {
+    }
 
     /**
      * @brief DTOR
@@ -167,6 +237,25 @@ public:
      */
     virtual void push(const data_read_ptr<STREAM_TYPE>& type) = 0;
 
+    /**
+     * @brief Pushes a sample data read pointer to the queue unless the capacity is reached,
+     * i.e. the oldest item is never dropped
+     *
+     * @param[in] sample The samples read pointer to push
+     * @return @c true if the sample has been pushed, @c false if the queue is full
+     * @remark This is threadsafe against pop and other push calls
+     */
+    virtual bool tryPush(const data_read_ptr<SAMPLE_TYPE>& sample) = 0;
+    /**
+     * @brief Pushes a stream type data read pointer to the queue unless the capacity is reached,
+     * i.e. the oldest item is never dropped
+     *
+     * @param[in] type The types read pointer to push
+     * @return @c true if the stream type has been pushed, @c false if the queue is full
+     * @remark This is threadsafe against pop and other push calls
+     */
+    virtual bool tryPush(const data_read_ptr<STREAM_TYPE>& type) = 0;
+
     /**
      * @brief Returns the timestamp of the oldest available sample of the item queue,
      * which is the sample at the front of the queue
@@ -183,6 +272,48 @@ public:
      */
     virtual std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE>> pop() = 0;
 
+    /// Compares the time of a sample with the time to pop until, see @ref popUntil
+    using TimeComparator = std::function<bool(Timestamp, Timestamp)>;
+    /// Receives a popped item, one of both pointers is set, see @ref popUntil
+    using ItemCallback =
+        std::function<void(const data_read_ptr<SAMPLE_TYPE>&, const data_read_ptr<STREAM_TYPE>&)>;
+
+    /**
+     * @brief Pops the items at the front of the queue up to the last due sample, i.e. the
+     * samples for which @c time_comparator(sample time, time) returns @c true and the stream types
+     * in front of or between them
+     * This default implementation pops item by item. As it cannot look behind a stream type at the
+     * front of the queue, it pops stream types at the front even if no due sample follows. Queues
+     * guarded by a lock override it to pop all items within one lock.
+     *
+     * @param[in] time The time to pop the items until
+     * @param[in] time_comparator Returns @c true if a sample of the first timestamp is due at the
+     *                            second timestamp
+     * @param[in] callback Callback receiving the popped items in order
+     * @return The number of popped items
+     * @remark This is threadsafe against push and pop calls
+     */
+    virtual size_t popUntil(Timestamp time,
+                            const TimeComparator& time_comparator,
+                            const ItemCallback& callback)
+    {
+        size_t item_count = 0;
+        for (;;) {
+            // no front time means the queue is empty or a stream type is at the front
+            const auto front_time = getFrontTime();
+            if (front_time && !time_comparator(*front_time, time)) {
+                break;
+            }
+            const auto item = pop();
+            if (!std::get<0>(item) && !std::get<1>(item)) {
+                break;
+            }
+            callback(std::get<0>(item), std::get<1>(item));
+            ++item_count;
+        }
+        return item_count;
+    }
+
     /**
      * @brief Return the maximum capacity of the queue
      *
@@ -201,6 +332,74 @@ public:
      * @brief Remove all elements of the queue
      */
     virtual void clear() = 0;
+
+    /**
+     * @brief Gets the notification which is signaled on every push, i.e. the notification the
+     * reception thread dispatching this queue waits for
+     *
+     * @return The notification, nullptr if the queue does not notify
+     */
+    const std::shared_ptr<ReceptionNotification>& getReceptionNotification() const
+    {
+        return _notification;
+    }
+
+    /**
+     * @brief Gets the number of pops so far, to be passed to @ref waitForPop
+     *
+     * @return The number of pops
+     */
+    uint64_t getPopCount() const
+    {
+        return _pop_count.load();
+    }
+
+    /**
+     * @brief Blocks until an item has been popped after @p pop_count has been retrieved by
+     * @ref getPopCount, i.e. until a push failing meanwhile might succeed, or until the deadline
+     *
+     * @param[in] pop_count The number of pops retrieved before the failed push
+     * @param[in] deadline The point in time to wait until at most
+     * @return @c true if an item has been popped, @c false if the deadline has been reached
+     * @remark This is threadsafe against push and pop calls and may be called by several writers
+     */
+    bool waitForPop(uint64_t pop_count, std::chrono::steady_clock::time_point deadline)
+    {
+        std::unique_lock<std::mutex> lock(_pop_mutex);
+        ++_pop_waiters;
+        const bool popped = _pop_condition.wait_until(
+            lock, deadline, [this, pop_count]() { return _pop_count.load() != pop_count; });
+        --_pop_waiters;
+        return popped;
+    }
+
+    /**
+     * @brief Gets the number of items which have been dropped because the capacity was reached
+     *
+     * @return The number of dropped items
+     */
+    uint64_t getDropCount() const
+    {
+        return _counters->getDrops();
+    }
+
+    /**
+     * @brief Gets the counters of the queue, which outlive the queue if shared
+     *
+     * @return The counters
+     */
+    const std::shared_ptr<SignalCounters>& getCounters() const
+    {
+        return _counters;
+    }
+
+private:
+    const std::shared_ptr<ReceptionNotification> _notification;
+    const std::shared_ptr<SignalCounters> _counters{std::make_shared<SignalCounters>()};
+    std::atomic<uint64_t> _pop_count{0};
+    std::atomic<uint32_t> _pop_waiters{0};
+    std::mutex _pop_mutex;
+    std::condition_variable _pop_condition;
 };
 
 } // namespace native
@@ -0,0 +1,126 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/simulation_bus/simulation_bus_loan_intf.h>
+
+#include <cstring>
+#include <memory>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Data sample loaned by the native simulation bus data writer.
+ * The memory is allocated once on loan and shared with all readers after commit, so the payload is
+ * neither copied by the writer nor by the transmitter.
+ */
+class LoanedDataSample final : public arya::ILoanedDataSample {
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] size the size of the memory to allocate
+     * @param[in] owner the writer the sample is loaned from
+     */
+    LoanedDataSample(size_t size, const void* owner)
+        : _buffer(new uint8_t[size]), _capacity(size), _size(size), _owner(owner)
+    {
+    }
+
+    LoanedDataSample(const LoanedDataSample&) = delete;
+    LoanedDataSample(LoanedDataSample&&) = delete;
+    LoanedDataSample& operator=(const LoanedDataSample&) = delete;
+    LoanedDataSample& operator=(LoanedDataSample&&) = delete;
+    ~LoanedDataSample() = default;
+
+public: // ILoanedDataSample
+    void* data() override
+    {
+        return _buffer.get();
+    }
+
+    size_t getCapacity() const override
+    {
+        return _capacity;
+    }
+
+    size_t setSize(size_t size) override
+    {
+        _size = (size < _capacity) ? size : _capacity;
+        return _size;
+    }
+
+public: // IDataSample
+    Timestamp getTime() const override
+    {
+        return _time;
+    }
+
+    uint32_t getCounter() const override
+    {
+        return _counter;
+    }
+
+    void setTime(const Timestamp& time) override
+    {
+        _time = time;
+    }
+
+    void setCounter(uint32_t counter) override
+    {
+        _counter = counter;
+    }
+
+    size_t getSize() const override
+    {
+        return _size;
+    }
+
+    size_t read(arya::IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(_buffer.get(), _size);
+    }
+
+    size_t write(const arya::IRawMemory& from_memory) override
+    {
+        const auto size = setSize(from_memory.size());
+        if (0 < size) {
+            std::memcpy(_buffer.get(), from_memory.cdata(), size);
+        }
+        return size;
+    }
+
+public:
+    /**
+     * @brief Checks whether the sample has been loaned from the given writer
+     *
+     * @param[in] owner the writer to check
+     * @return @c true if the sample has been loaned from @p owner, @c false otherwise
+     */
+    bool isLoanedFrom(const void* owner) const
+    {
+        return _owner == owner;
+    }
+
+private:
+    std::unique_ptr<uint8_t[]> _buffer;
+    size_t _capacity;
+    size_t _size;
+    const void* _owner;
+    Timestamp _time{0};
+    uint32_t _counter{0};
+};
+
+} // namespace native
+} // namespace fep3
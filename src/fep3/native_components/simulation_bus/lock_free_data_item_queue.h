@@ -0,0 +1,272 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "data_item_queue_base.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Lock-free data item queue for one producer (the transmitter) and one consumer (the
+ * reader).
+ * Like @ref DataItemQueue this is a FIFO queue with fixed capacity, which drops the oldest item if
+ * an item is pushed while the capacity is reached. The producer and the consumer compete for the
+ * oldest item via compare and swap of the read position, so neither of them takes a lock.
+ * The producer only has to wait for the consumer if the consumer is just moving the item out of
+ * the slot the producer wants to write next.
+ *
+ * @remark @ref push must only be called from one thread at a time and @ref pop,
+ * @ref getFrontTime, @ref clear must only be called from one (other) thread at a time. The
+ * native simulation bus adds the queue by @ref SimulationBus::Transmitter::addSingleProducer,
+ * which refuses a second writer of the signal. @ref size may be called from any thread.
+ * @remark The item whose time has been returned by @ref getFrontTime is held by the consumer until
+ * it is popped and is not dropped anymore, so the queue may hold one item more than its capacity.
+ *
+ * @tparam SAMPLE_TYPE class for samples
+ * @tparam STREAM_TYPE class for types
+ */
+template <class SAMPLE_TYPE = const IDataSample, class STREAM_TYPE = const IStreamType>
+class LockFreeDataItemQueue : public DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE> {
+private:
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::DataItem;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::QueueType;
+
+    /**
+     * A slot of the ring buffer. The sequence tells which position the slot is ready for:
+     * sequence == position means the slot is free to be written for this position,
+     * sequence == position + 1 means the slot holds the item of this position.
+     */
+    struct Slot {
+        std::atomic<size_t> _sequence{0};
+        DataItem _item;
+    };
+
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] capacity capacity by item count of the queue (there are sample + stream type
+     * covered)
+     * @param[in] notification optional notification to be signaled on every push
+     */
+    LockFreeDataItemQueue(size_t capacity,
+                          std::shared_ptr<ReceptionNotification> notification = {})
+        : DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>(std::move(notification)),
+          _slots(capacity > 0 ? capacity : 1)
+    {
+        for (size_t position = 0; position < _slots.size(); ++position) {
+            _slots[position]._sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief DTOR
+     */
+    virtual ~LockFreeDataItemQueue() = default;
+
+    /**
+     * @brief pushes a sample data read pointer to the queue
+     *
+     * @param[in] sample the samples read pointer to push
+     * @remark this is lock-free against pop, but must not be called concurrently to other push
+     * calls
+     */
+    void push(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        pushItem(sample);
+        this->notify();
+    }
+
+    /**
+     * @brief pushes a stream type data read pointer to the queue
+     *
+     * @param[in] type the types read pointer to push
+     * @remark this is lock-free against pop, but must not be called concurrently to other push
+     * calls
+     */
+    void push(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        pushItem(type);
+        this->notify();
+    }
+
+    /**
+     * @brief pushes a sample data read pointer to the queue unless the capacity is reached
+     *
+     * @param[in] sample the samples read pointer to push
+     * @return @c true if the sample has been pushed, @c false if the queue is full
+     * @remark this is lock-free against pop, but must not be called concurrently to other push
+     * calls
+     */
+    bool tryPush(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        return tryPushItem(sample);
+    }
+
+    /**
+     * @brief pushes a stream type data read pointer to the queue unless the capacity is reached
+     *
+     * @param[in] type the types read pointer to push
+     * @return @c true if the stream type has been pushed, @c false if the queue is full
+     * @remark this is lock-free against pop, but must not be called concurrently to other push
+     * calls
+     */
+    bool tryPush(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        return tryPushItem(type);
+    }
+
+    Optional<Timestamp> getFrontTime() override
+    {
+        if (_front_item.getItemType() == DataItem::Type::none) {
+            _front_item = popItem();
+            _front_item_held.store(_front_item.getItemType() != DataItem::Type::none,
+                                   std::memory_order_release);
+        }
+        if (_front_item.getItemType() == DataItem::Type::sample) {
+            return _front_item.getSample()->getTime();
+        }
+        else {
+            return {};
+        }
+    }
+
+    /**
+     * @brief pops the item at the front of the queue
+     *
+     * @return {nullptr, nullptr} if queue is empty
+     * @remark this is lock-free against push, but must not be called concurrently to other pop
+     * calls
+     */
+    std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE>> pop() override
+    {
+        DataItem item;
+        if (_front_item.getItemType() != DataItem::Type::none) {
+            std::swap(item, _front_item);
+            _front_item_held.store(false, std::memory_order_release);
+        }
+        else {
+            item = popItem();
+        }
+        if (item.getItemType() != DataItem::Type::none) {
+            this->notifyPop();
+        }
+        return std::make_tuple(item.getSample(), item.getStreamType());
+    }
+
+    size_t capacity() const override
+    {
+        return _slots.size();
+    }
+
+    size_t size() const override
+    {
+        const auto read_position = _read_position.load(std::memory_order_acquire);
+        const auto write_position = _write_position.load(std::memory_order_acquire);
+        const size_t front_item_count = _front_item_held.load(std::memory_order_acquire) ? 1 : 0;
+        return write_position - read_position + front_item_count;
+    }
+
+    void clear() override
+    {
+        _front_item = DataItem();
+        _front_item_held.store(false, std::memory_order_release);
+        while (popItem().getItemType() != DataItem::Type::none) {
+        }
+        this->notifyPop();
+    }
+
+    QueueType getQueueType() const override
+    {
+        return QueueType::fixed;
+    }
+
+private:
+    template <typename ITEM_TYPE>
+    bool tryPushItem(const ITEM_TYPE& item)
+    {
+        // only the single producer advances the write position and the consumer only frees
+        // slots, so the queue cannot become full between the check and the push
+        if (_write_position.load(std::memory_order_relaxed) -
+                _read_position.load(std::memory_order_acquire) >=
+            _slots.size()) {
+            return false;
+        }
+        pushItem(item);
+        this->notify();
+        return true;
+    }
+
+    template <typename ITEM_TYPE>
+    void pushItem(const ITEM_TYPE& item)
+    {
+        const auto write_position = _write_position.load(std::memory_order_relaxed);
+        auto& slot = _slots[write_position % _slots.size()];
+
+        auto read_position = _read_position.load(std::memory_order_acquire);
+        if (write_position - read_position >= _slots.size() &&
+            _read_position.compare_exchange_strong(
+                read_position, read_position + 1, std::memory_order_acq_rel)) {
+            // the queue is full and the oldest item has been claimed by the producer, so the slot
+            // of the dropped item is overwritten right away
+            this->countDrop();
+        }
+        else {
+            // the slot is released by the consumer once it moved the item out of it
+            while (slot._sequence.load(std::memory_order_acquire) != write_position) {
+                std::this_thread::yield();
+            }
+        }
+
+        slot._item.set(item);
+        slot._sequence.store(write_position + 1, std::memory_order_release);
+        _write_position.store(write_position + 1, std::memory_order_release);
+        this->countPush(item, write_position + 1 - _read_position.load(std::memory_order_relaxed));
+    }
+
+    DataItem popItem()
+    {
+        auto read_position = _read_position.load(std::memory_order_acquire);
+        do {
+            if (read_position == _write_position.load(std::memory_order_acquire)) {
+                return {};
+            }
+            // on failure the read position has been advanced by the producer dropping the oldest
+            // item and the new read position is retried
+        } while (!_read_position.compare_exchange_weak(
+            read_position, read_position + 1, std::memory_order_acq_rel));
+
+        auto& slot = _slots[read_position % _slots.size()];
+        DataItem item = std::move(slot._item);
+        slot._item = DataItem();
+        slot._sequence.store(read_position + _slots.size(), std::memory_order_release);
+        return item;
+    }
+
+    std::vector<Slot> _slots;
+    alignas(64) std::atomic<size_t> _write_position{0};
+    alignas(64) std::atomic<size_t> _read_position{0};
+    // consumer side only
+    alignas(64) DataItem _front_item;
+    // whether the consumer holds the front item, published for size() called by other threads
+    std::atomic<bool> _front_item_held{false};
+};
+
+} // namespace native
+} // namespace fep3
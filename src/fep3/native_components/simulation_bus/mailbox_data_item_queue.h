@@ -0,0 +1,315 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "data_item_queue_base.h"
+
+#include <atomic>
+#include <memory>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Wait-free data item queue of capacity 1 which only keeps the newest sample and the
+ * newest stream type ("latest value mailbox").
+ * The sample and the stream type are held in separate slots, so a sample does not drop a
+ * preceding stream type. Each slot is an atomic pointer to a mail, which is published by one
+ * atomic exchange and taken by one atomic exchange. A mail replaced before it has been taken is
+ * dropped. Mails are recycled via a spare slot, so the queue does not allocate once a mail has been
+ * taken at least once. The items of both slots are popped in the order they have been pushed.
+ *
+ * @remark @ref push may be called from any number of threads. @ref pop, @ref getFrontTime and
+ * @ref clear must only be called from one (other) thread at a time.
+ * @remark The item whose time has been returned by @ref getFrontTime is held by the consumer and
+ * is the one returned by the next @ref pop, so a sample checked to be due is the sample popped.
+ * A newer item of the same kind replaces a held item only on the next @ref getFrontTime or on a
+ * @ref pop without a preceding @ref getFrontTime, so the mailbox never delivers more than one
+ * sample and one stream type.
+ *
+ * @tparam SAMPLE_TYPE class for samples
+ * @tparam STREAM_TYPE class for types
+ */
+template <class SAMPLE_TYPE = const IDataSample, class STREAM_TYPE = const IStreamType>
+class MailboxDataItemQueue : public DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE> {
+private:
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::DataItem;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::QueueType;
+
+    /**
+     * An item published to a slot, the sequence tells the order the items have been pushed in
+     */
+    struct Mail {
+        DataItem _item;
+        uint64_t _sequence{0};
+    };
+
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] notification optional notification to be signaled on every push
+     */
+    explicit MailboxDataItemQueue(std::shared_ptr<ReceptionNotification> notification = {})
+        : DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>(std::move(notification))
+    {
+    }
+
+    /**
+     * @brief DTOR
+     */
+    virtual ~MailboxDataItemQueue()
+    {
+        for (auto slot: {&_sample_slot,
+                         &_stream_type_slot,
+                         &_front_sample,
+                         &_front_stream_type,
+                         &_spare}) {
+            delete slot->load(std::memory_order_acquire);
+        }
+    }
+
+    MailboxDataItemQueue(const MailboxDataItemQueue&) = delete;
+    MailboxDataItemQueue(MailboxDataItemQueue&&) = delete;
+    MailboxDataItemQueue& operator=(const MailboxDataItemQueue&) = delete;
+    MailboxDataItemQueue& operator=(MailboxDataItemQueue&&) = delete;
+
+    /**
+     * @brief replaces the sample of the mailbox
+     *
+     * @param[in] sample the samples read pointer to push
+     * @remark this is wait-free against pop and other push calls
+     */
+    void push(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        pushItem(sample, _sample_slot);
+        this->notify();
+    }
+
+    /**
+     * @brief replaces the stream type of the mailbox
+     *
+     * @param[in] type the types read pointer to push
+     * @remark this is wait-free against pop and other push calls
+     */
+    void push(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        pushItem(type, _stream_type_slot);
+        this->notify();
+    }
+
+    /**
+     * @brief sets the sample of the mailbox unless it still holds a sample
+     *
+     * @param[in] sample the samples read pointer to push
+     * @return @c true if the sample has been pushed, @c false if the mailbox holds a sample
+     * @remark this is wait-free against pop and other push calls
+     */
+    bool tryPush(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        return tryPushItem(sample, _front_sample, _sample_slot);
+    }
+
+    /**
+     * @brief sets the stream type of the mailbox unless it still holds a stream type
+     *
+     * @param[in] type the types read pointer to push
+     * @return @c true if the stream type has been pushed, @c false if the mailbox holds a stream
+     * type
+     * @remark this is wait-free against pop and other push calls
+     */
+    bool tryPush(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        return tryPushItem(type, _front_stream_type, _stream_type_slot);
+    }
+
+    Optional<Timestamp> getFrontTime() override
+    {
+        _peeked_front = getFront();
+        if (_peeked_front == &_front_sample) {
+            return _front_sample.load(std::memory_order_relaxed)->_item.getSample()->getTime();
+        }
+        else {
+            return {};
+        }
+    }
+
+    /**
+     * @brief pops the older one of the sample and the stream type of the mailbox
+     *
+     * @return {nullptr, nullptr} if the mailbox is empty
+     * @remark this is wait-free against push, but must not be called concurrently to other pop
+     * calls
+     */
+    std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE>> pop() override
+    {
+        // the item reported by getFrontTime is popped even if a newer one has arrived meanwhile
+        const auto front = _peeked_front ? _peeked_front : getFront();
+        _peeked_front = nullptr;
+        if (!front) {
+            return {};
+        }
+        std::unique_ptr<Mail> mail(front->exchange(nullptr, std::memory_order_relaxed));
+        auto item = std::make_tuple(mail->_item.getSample(), mail->_item.getStreamType());
+        recycle(std::move(mail));
+        this->notifyPop();
+        return item;
+    }
+
+    size_t capacity() const override
+    {
+        return 1;
+    }
+
+    size_t size() const override
+    {
+        // a mail held by the consumer is replaced by a newer mail of the same kind
+        return getItemCount(_front_sample, _sample_slot) +
+               getItemCount(_front_stream_type, _stream_type_slot);
+    }
+
+    void clear() override
+    {
+        _peeked_front = nullptr;
+        for (auto slot: {&_front_sample, &_front_stream_type, &_sample_slot, &_stream_type_slot}) {
+            std::unique_ptr<Mail> mail(slot->exchange(nullptr, std::memory_order_acq_rel));
+            if (mail) {
+                recycle(std::move(mail));
+            }
+        }
+        this->notifyPop();
+    }
+
+    QueueType getQueueType() const override
+    {
+        return QueueType::fixed;
+    }
+
+private:
+    template <typename ITEM_TYPE>
+    std::unique_ptr<Mail> createMail(const ITEM_TYPE& item)
+    {
+        std::unique_ptr<Mail> mail(_spare.exchange(nullptr, std::memory_order_acquire));
+        if (!mail) {
+            mail = std::make_unique<Mail>();
+        }
+        mail->_item.set(item);
+        mail->_sequence = _next_sequence.fetch_add(1, std::memory_order_relaxed);
+        return mail;
+    }
+
+    void recycle(std::unique_ptr<Mail> mail)
+    {
+        // release the item right away, it might be a pooled sample the writer waits for
+        mail->_item = DataItem();
+        // a spare which is already there is deleted, there is never more than one spare needed
+        std::unique_ptr<Mail>(_spare.exchange(mail.release(), std::memory_order_acq_rel));
+    }
+
+    template <typename ITEM_TYPE>
+    void pushItem(const ITEM_TYPE& item, std::atomic<Mail*>& slot)
+    {
+        std::unique_ptr<Mail> dropped(
+            slot.exchange(createMail(item).release(), std::memory_order_acq_rel));
+        if (dropped) {
+            this->countDrop();
+            recycle(std::move(dropped));
+        }
+        this->countPush(item, size());
+    }
+
+    template <typename ITEM_TYPE>
+    bool tryPushItem(const ITEM_TYPE& item,
+                     const std::atomic<Mail*>& front,
+                     std::atomic<Mail*>& slot)
+    {
+        // the slot is checked first, see takeFromSlot
+        if (slot.load(std::memory_order_seq_cst) || front.load(std::memory_order_seq_cst)) {
+            return false;
+        }
+        auto mail = createMail(item);
+        Mail* empty = nullptr;
+        if (!slot.compare_exchange_strong(
+                empty, mail.get(), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            // another producer filled the slot meanwhile
+            recycle(std::move(mail));
+            return false;
+        }
+        mail.release();
+        this->countPush(item, size());
+        this->notify();
+        return true;
+    }
+
+    /**
+     * Takes the sample and the stream type out of their slots, replacing the ones the consumer
+     * already holds, and selects the one pushed first.
+     *
+     * @return the consumer side slot holding the front item, nullptr if the mailbox is empty
+     */
+    std::atomic<Mail*>* getFront()
+    {
+        const auto sample = takeFromSlot(_front_sample, _sample_slot);
+        const auto stream_type = takeFromSlot(_front_stream_type, _stream_type_slot);
+        if (sample && (!stream_type || sample->_sequence < stream_type->_sequence)) {
+            return &_front_sample;
+        }
+        else if (stream_type) {
+            return &_front_stream_type;
+        }
+        return nullptr;
+    }
+
+    Mail* takeFromSlot(std::atomic<Mail*>& front, std::atomic<Mail*>& slot)
+    {
+        auto held = front.load(std::memory_order_relaxed);
+        if (!slot.load(std::memory_order_acquire)) {
+            return held;
+        }
+        if (held) {
+            std::unique_ptr<Mail> newer(slot.exchange(nullptr, std::memory_order_acq_rel));
+            this->countDrop();
+            recycle(std::unique_ptr<Mail>(held));
+            front.store(newer.get(), std::memory_order_relaxed);
+            return newer.release();
+        }
+        // the front is marked before the slot is emptied, so tryPush does not see both empty while
+        // the mail is moved
+        front.store(&_taking, std::memory_order_seq_cst);
+        const auto mail = slot.exchange(nullptr, std::memory_order_seq_cst);
+        front.store(mail, std::memory_order_relaxed);
+        return mail;
+    }
+
+    static size_t getItemCount(const std::atomic<Mail*>& front, const std::atomic<Mail*>& slot)
+    {
+        const bool occupied =
+            front.load(std::memory_order_acquire) || slot.load(std::memory_order_acquire);
+        return occupied ? 1 : 0;
+    }
+
+    alignas(64) std::atomic<Mail*> _sample_slot{nullptr};
+    std::atomic<Mail*> _stream_type_slot{nullptr};
+    std::atomic<Mail*> _spare{nullptr};
+    std::atomic<uint64_t> _next_sequence{0};
+    // written by the consumer only, atomic to let size() be called from any thread
+    alignas(64) std::atomic<Mail*> _front_sample{nullptr};
+    std::atomic<Mail*> _front_stream_type{nullptr};
+    /// marks a front slot while the consumer moves a mail to it, never holds an item
+    Mail _taking;
+    /// front slot selected by the last getFrontTime until the next pop, used by the consumer only
+    std::atomic<Mail*>* _peeked_front{nullptr};
+};
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,79 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/components/simulation_bus/simulation_bus_filter_intf.h>
+
+#include <atomic>
+#include <limits>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Applies the @ref SampleFilter of a reader to the samples transmitted to the reader.
+ * The state of the decimation and of the min interval is kept in atomics, so samples of one
+ * signal may be filtered by several transmitting writers at a time.
+ */
+class ReceiverSampleFilter {
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] filter the filter of the reader
+     */
+    explicit ReceiverSampleFilter(SampleFilter filter) : _filter(std::move(filter))
+    {
+    }
+
+    /**
+     * @brief Checks whether a sample passes the filter and updates the filter state if so
+     *
+     * @param[in] sample the sample to check
+     * @return @c true if the sample is to be pushed to the reader queue, @c false otherwise
+     */
+    bool pass(const IDataSample& sample)
+    {
+        if (_filter._predicate && !_filter._predicate(sample)) {
+            return false;
+        }
+        if (_filter._decimation_factor > 1 &&
+            _decimation_count.fetch_add(1, std::memory_order_relaxed) %
+                    _filter._decimation_factor !=
+                0) {
+            return false;
+        }
+        if (_filter._min_interval.count() > 0) {
+            const auto time = sample.getTime().count();
+            auto last_time = _last_time.load(std::memory_order_relaxed);
+            do {
+                if (last_time != no_time && time - last_time < _filter._min_interval.count()) {
+                    return false;
+                }
+            } while (!_last_time.compare_exchange_weak(
+                last_time, time, std::memory_order_relaxed));
+        }
+        return true;
+    }
+
+private:
+    static constexpr int64_t no_time = std::numeric_limits<int64_t>::min();
+
+    const SampleFilter _filter;
+    std::atomic<uint64_t> _decimation_count{0};
+    // time of the last sample passing the min interval
+    std::atomic<int64_t> _last_time{no_time};
+};
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,91 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Wakeup signal shared between the reader queues and the data triggered reception thread.
+ * Every push into a reader queue notifies the reception thread, which sleeps in @ref wait until
+ * either data arrived or a stop was requested.
+ */
+class ReceptionNotification {
+public:
+    ReceptionNotification() = default;
+    ReceptionNotification(const ReceptionNotification&) = delete;
+    ReceptionNotification(ReceptionNotification&&) = delete;
+    ReceptionNotification& operator=(const ReceptionNotification&) = delete;
+    ReceptionNotification& operator=(ReceptionNotification&&) = delete;
+    ~ReceptionNotification() = default;
+
+    /**
+     * @brief Signals that new data is available
+     * @remark this is threadsafe and may be called from any writer thread
+     */
+    void notify()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _data_pending = true;
+        }
+        _condition.notify_one();
+    }
+
+    /**
+     * @brief Blocks until data is pending or a stop was requested and consumes the pending flag
+     *
+     * @return @c false if a stop was requested, @c true otherwise
+     */
+    bool wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _data_pending || _stop_requested; });
+        _data_pending = false;
+        return !_stop_requested;
+    }
+
+    /**
+     * @brief Wakes up the waiting thread and lets every subsequent @ref wait return @c false
+     * until @ref reset is called
+     */
+    void requestStop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop_requested = true;
+        }
+        _condition.notify_all();
+    }
+
+    /**
+     * @brief Resets a previously requested stop
+     */
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop_requested = false;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    bool _data_pending{false};
+    bool _stop_requested{false};
+};
+
+} // namespace native
+} // namespace fep3
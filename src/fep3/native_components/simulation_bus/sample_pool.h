@@ -0,0 +1,253 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Allocation statistics of a @ref SamplePool
+ */
+struct SamplePoolStatistics {
+    /// number of heap allocations (samples and their bookkeeping) which have been done by the pool
+    uint64_t _allocations{0};
+    /// number of samples which have been handed out again after being returned to the pool
+    uint64_t _recycles{0};
+};
+
+/**
+ * @brief Pool of recycled samples.
+ * Samples are handed out as shared pointers whose deleter returns the sample to the pool once the
+ * last reference (e.g. of a reader queue) is dropped. Returned samples keep their memory, so in
+ * steady state acquiring a sample does not allocate at all.
+ * Samples in use keep the pool alive.
+ *
+ * @tparam SAMPLE_TYPE type of the pooled samples, has to provide a "capacity" in bytes as
+ *                     reported by the capacity getter
+ */
+template <typename SAMPLE_TYPE>
+class SamplePool : public std::enable_shared_from_this<SamplePool<SAMPLE_TYPE>> {
+public:
+    /// creates a new sample with the given capacity in bytes
+    using SampleFactory = std::function<SAMPLE_TYPE*(size_t capacity)>;
+    /// gets the capacity in bytes of a sample
+    using CapacityGetter = std::function<size_t(const SAMPLE_TYPE& sample)>;
+
+private:
+    struct PrivateTag {
+    };
+
+public:
+    /**
+     * @brief Creates a sample pool
+     *
+     * @param[in] sample_factory factory to create new samples
+     * @param[in] capacity_getter getter for the capacity of a sample
+     * @param[in] min_capacity minimum capacity in bytes of newly allocated samples, e.g. the max
+     *                         size of the stream type (0 to use the requested size)
+     * @return the sample pool
+     */
+    static std::shared_ptr<SamplePool> create(SampleFactory sample_factory,
+                                              CapacityGetter capacity_getter,
+                                              size_t min_capacity = 0)
+    {
+        return std::make_shared<SamplePool>(
+            PrivateTag{}, std::move(sample_factory), std::move(capacity_getter), min_capacity);
+    }
+
+    /// CTOR, use @ref create
+    SamplePool(PrivateTag,
+               SampleFactory sample_factory,
+               CapacityGetter capacity_getter,
+               size_t min_capacity)
+        : _sample_factory(std::move(sample_factory)),
+          _capacity_getter(std::move(capacity_getter)),
+          _min_capacity(min_capacity)
+    {
+    }
+
+    SamplePool(const SamplePool&) = delete;
+    SamplePool(SamplePool&&) = delete;
+    SamplePool& operator=(const SamplePool&) = delete;
+    SamplePool& operator=(SamplePool&&) = delete;
+
+    ~SamplePool()
+    {
+        for (auto sample: _free_samples) {
+            delete sample;
+        }
+        for (auto block: _free_blocks) {
+            ::operator delete(block);
+        }
+    }
+
+    /**
+     * @brief Acquires a sample with a capacity of at least @p size bytes.
+     * A free sample of the pool is reused if available, a new one is allocated otherwise.
+     * The first observed size is used as minimum capacity for all subsequent allocations
+     * if no minimum capacity has been given on creation.
+     *
+     * @param[in] size the size in bytes the sample has to be able to hold
+     * @return the sample, which returns to the pool once released
+     * @remark this is threadsafe against the release of samples from other threads
+     */
+    std::shared_ptr<SAMPLE_TYPE> acquire(size_t size)
+    {
+        SAMPLE_TYPE* sample = nullptr;
+        size_t min_capacity = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (0 == _min_capacity) {
+                _min_capacity = size;
+            }
+            min_capacity = _min_capacity;
+            if (!_free_samples.empty()) {
+                sample = _free_samples.back();
+                _free_samples.pop_back();
+            }
+        }
+
+        if (sample && _capacity_getter(*sample) < size) {
+            // the observed size grew beyond the pooled capacity, so the sample is replaced
+            delete sample;
+            sample = nullptr;
+        }
+
+        if (sample) {
+            _recycles.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            sample = _sample_factory(std::max(size, min_capacity));
+            _allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // the control block of the shared pointer is recycled as well, so handing out a sample
+        // does not allocate in steady state
+        const auto pool = this->shared_from_this();
+        return std::shared_ptr<SAMPLE_TYPE>(
+            sample,
+            [pool](SAMPLE_TYPE* released_sample) { pool->release(released_sample); },
+            ControlBlockAllocator<SAMPLE_TYPE>(pool));
+    }
+
+    /**
+     * @brief Gets the allocation statistics of the pool
+     *
+     * @return the statistics
+     */
+    SamplePoolStatistics getStatistics() const
+    {
+        return {_allocations.load(std::memory_order_relaxed),
+                _recycles.load(std::memory_order_relaxed)};
+    }
+
+private:
+    /**
+     * Allocator for the control blocks of the handed out shared pointers, which keeps the pool
+     * alive as long as any of its samples is in use
+     */
+    template <typename T>
+    struct ControlBlockAllocator {
+        using value_type = T;
+
+        explicit ControlBlockAllocator(std::shared_ptr<SamplePool> pool) : _pool(std::move(pool))
+        {
+        }
+
+        template <typename U>
+        ControlBlockAllocator(const ControlBlockAllocator<U>& other) : _pool(other._pool)
+        {
+        }
+
+        T* allocate(size_t count)
+        {
+            return static_cast<T*>(_pool->allocateBlock(count * sizeof(T)));
+        }
+
+        void deallocate(T* block, size_t count)
+        {
+            _pool->deallocateBlock(block, count * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator==(const ControlBlockAllocator<U>& other) const
+        {
+            return _pool == other._pool;
+        }
+
+        template <typename U>
+        bool operator!=(const ControlBlockAllocator<U>& other) const
+        {
+            return _pool != other._pool;
+        }
+
+        std::shared_ptr<SamplePool> _pool;
+    };
+
+    void release(SAMPLE_TYPE* sample)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _free_samples.push_back(sample);
+    }
+
+    void* allocateBlock(size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (0 == _block_size) {
+                _block_size = size;
+            }
+            if (size == _block_size && !_free_blocks.empty()) {
+                auto block = _free_blocks.back();
+                _free_blocks.pop_back();
+                return block;
+            }
+        }
+        _allocations.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    void deallocateBlock(void* block, size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (size == _block_size) {
+                _free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    const SampleFactory _sample_factory;
+    const CapacityGetter _capacity_getter;
+    size_t _min_capacity;
+
+    std::mutex _mutex;
+    std::vector<SAMPLE_TYPE*> _free_samples;
+    size_t _block_size{0};
+    std::vector<void*> _free_blocks;
+
+    std::atomic<uint64_t> _allocations{0};
+    std::atomic<uint64_t> _recycles{0};
+};
+
+} // namespace native
+} // namespace fep3
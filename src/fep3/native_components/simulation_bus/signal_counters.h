@@ -0,0 +1,166 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Snapshot of the counters of a reader queue or of the transmit buffer of a writer
+ */
+struct SignalStatistics {
+    /// name of the signal
+    std::string _signal_name;
+    /// capacity of the queue
+    size_t _queue_capacity{0};
+    /// number of samples pushed to the queue
+    uint64_t _samples{0};
+    /// number of stream types pushed to the queue
+    uint64_t _stream_types{0};
+    /// number of sample bytes pushed to the queue
+    uint64_t _bytes{0};
+    /// number of items dropped because the capacity of the queue was reached
+    uint64_t _drops{0};
+    /// max number of items the queue held at once
+    uint64_t _high_water_mark{0};
+    /// number of lossless transmissions which had to wait for a full reader queue
+    uint64_t _stalls{0};
+    /// number of lossless transmissions which failed because a reader queue stayed full
+    uint64_t _rejections{0};
+    /// time since the counters have been created
+    std::chrono::nanoseconds _lifetime{0};
+};
+
+/**
+ * @brief Counters of a reader queue or of the transmit buffer of a writer.
+ * The counters are updated on the data path with relaxed atomics only, so they do not order any
+ * memory access and a snapshot taken while data is transmitted is not necessarily consistent
+ * across the single counters.
+ */
+class SignalCounters {
+public:
+    SignalCounters() = default;
+    SignalCounters(const SignalCounters&) = delete;
+    SignalCounters(SignalCounters&&) = delete;
+    SignalCounters& operator=(const SignalCounters&) = delete;
+    SignalCounters& operator=(SignalCounters&&) = delete;
+    ~SignalCounters() = default;
+
+    /**
+     * @brief Counts a pushed sample
+     *
+     * @param[in] bytes size of the sample in bytes
+     * @param[in] queue_size number of items in the queue after the push
+     */
+    void countSample(size_t bytes, size_t queue_size)
+    {
+        _samples.fetch_add(1, std::memory_order_relaxed);
+        _bytes.fetch_add(bytes, std::memory_order_relaxed);
+        updateHighWaterMark(queue_size);
+    }
+
+    /**
+     * @brief Counts a pushed stream type
+     *
+     * @param[in] queue_size number of items in the queue after the push
+     */
+    void countStreamType(size_t queue_size)
+    {
+        _stream_types.fetch_add(1, std::memory_order_relaxed);
+        updateHighWaterMark(queue_size);
+    }
+
+    /**
+     * @brief Counts an item dropped because the capacity of the queue was reached
+     */
+    void countDrop()
+    {
+        _drops.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts a lossless transmission which had to wait for a full reader queue
+     */
+    void countStall()
+    {
+        _stalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Counts a lossless transmission which failed because a reader queue stayed full
+     */
+    void countRejection()
+    {
+        _rejections.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of dropped items
+     *
+     * @return the number of dropped items
+     */
+    uint64_t getDrops() const
+    {
+        return _drops.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Takes a snapshot of the counters
+     *
+     * @param[in] signal_name name of the signal to be set in the snapshot
+     * @param[in] queue_capacity capacity of the queue to be set in the snapshot
+     * @return the snapshot
+     */
+    SignalStatistics getStatistics(const std::string& signal_name, size_t queue_capacity) const
+    {
+        SignalStatistics statistics;
+        statistics._signal_name = signal_name;
+        statistics._queue_capacity = queue_capacity;
+        statistics._samples = _samples.load(std::memory_order_relaxed);
+        statistics._stream_types = _stream_types.load(std::memory_order_relaxed);
+        statistics._bytes = _bytes.load(std::memory_order_relaxed);
+        statistics._drops = _drops.load(std::memory_order_relaxed);
+        statistics._high_water_mark = _high_water_mark.load(std::memory_order_relaxed);
+        statistics._stalls = _stalls.load(std::memory_order_relaxed);
+        statistics._rejections = _rejections.load(std::memory_order_relaxed);
+        statistics._lifetime = std::chrono::steady_clock::now() - _creation_time;
+        return statistics;
+    }
+
+private:
+    void updateHighWaterMark(size_t queue_size)
+    {
+        auto high_water_mark = _high_water_mark.load(std::memory_order_relaxed);
+        while (high_water_mark < queue_size &&
+               !_high_water_mark.compare_exchange_weak(
+                   high_water_mark, queue_size, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::atomic<uint64_t> _samples{0};
+    std::atomic<uint64_t> _stream_types{0};
+    std::atomic<uint64_t> _bytes{0};
+    std::atomic<uint64_t> _drops{0};
+    std::atomic<uint64_t> _high_water_mark{0};
+    std::atomic<uint64_t> _stalls{0};
+    std::atomic<uint64_t> _rejections{0};
+    const std::chrono::steady_clock::time_point _creation_time{std::chrono::steady_clock::now()};
+};
+
+} // namespace native
+} // namespace fep3
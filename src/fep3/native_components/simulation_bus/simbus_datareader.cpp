@@ -11,6 +11,7 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
 #include "simbus_datareader.h"
+#include "simbus_datawriter.h"
 
 namespace fep3 {
 namespace native {
@@ -21,10 +22,13 @@ size_t SimulationBus::DataReader::size() const
 }
 
 SimulationBus::DataReader::DataReader(
-    const std::shared_ptr<DataItemQueue<>>& item_queue,
-    const std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueue<>>>&
-        data_access_collection)
-    : _item_queue{item_queue}, _data_access_collection{data_access_collection}
+    const std::shared_ptr<DataItemQueueBase<>>& item_queue,
+    const std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueueBase<>>>&
+        data_access_collection,
+    const std::weak_ptr<Transmitter>& transmitter)
+    : _item_queue{item_queue},
+      _data_access_collection{data_access_collection},
+      _transmitter{transmitter}
 {
 }
 
@@ -32,6 +36,10 @@ SimulationBus::DataReader::~DataReader()
 {
     // remove sink from data sink collection (if any)
     reset();
+    // a lossless writer must not wait for the queue of a reader which does not exist anymore
+    if (const auto transmitter = _transmitter.lock()) {
+        transmitter->remove(_item_queue);
+    }
 }
 
 size_t SimulationBus::DataReader::capacity() const
@@ -76,5 +84,24 @@ Optional<Timestamp> SimulationBus::DataReader::getFrontTime() const
     return _item_queue->getFrontTime();
 }
 
+size_t SimulationBus::DataReader::popUntil(
+    Timestamp time,
+    const std::function<bool(Timestamp, Timestamp)>& time_comparator,
+    ISimulationBus::IDataReceiver& receiver)
+{
+    return _item_queue->popUntil(
+        time,
+        time_comparator,
+        [&receiver](const data_read_ptr<const IDataSample>& sample,
+                    const data_read_ptr<const IStreamType>& stream_type) {
+            if (sample) {
+                receiver(sample);
+            }
+            if (stream_type) {
+                receiver(stream_type);
+            }
+        });
+}
+
 } // namespace native
 } // namespace fep3
@@ -15,12 +15,14 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include "data_item_queue.h"
 #include "simulation_bus.h"
 
+#include <fep3/components/simulation_bus/simulation_bus_batch_intf.h>
 #include <fep3/components/simulation_bus/simulation_data_access.h>
 
 namespace fep3 {
 namespace native {
 
-class SimulationBus::DataReader : public arya::ISimulationBus::IDataReader {
+class SimulationBus::DataReader : public arya::ISimulationBus::IDataReader,
+                                  public arya::ISimulationBusBatchReader {
 public:
     /**
      * CTOR for a data reader
@@ -29,10 +31,13 @@ public:
      * @param data_access_collection Weak pointer to the collection of data access.
      *                               Calls to @ref DataReader::reset will add data access
      *                               to this collection.
+     * @param transmitter Weak pointer to the transmitter the @p item_queue has been added to.
+     *                    The item queue is removed from the transmitter on destruction.
      */
-    DataReader(const std::shared_ptr<DataItemQueue<>>& item_queue,
-               const std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueue<>>>&
-                   data_access_collection);
+    DataReader(const std::shared_ptr<DataItemQueueBase<>>& item_queue,
+               const std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueueBase<>>>&
+                   data_access_collection,
+               const std::weak_ptr<Transmitter>& transmitter);
     ~DataReader() override;
     DataReader(const DataReader&) = delete;
     DataReader(DataReader&&) = delete;
@@ -50,6 +55,10 @@ public:
 
     virtual Optional<Timestamp> getFrontTime() const override;
 
+    size_t popUntil(Timestamp time,
+                    const std::function<bool(Timestamp, Timestamp)>& time_comparator,
+                    arya::ISimulationBus::IDataReceiver& receiver) override;
+
     template <typename tuple_type>
     static void dispatch(tuple_type& data, fep3::arya::ISimulationBus::IDataReceiver& receiver)
     {
@@ -66,11 +75,14 @@ public:
 
 private:
     // the reader takes ownership of the item queue -> shared_ptr
-    std::shared_ptr<DataItemQueue<>> _item_queue{nullptr};
+    std::shared_ptr<DataItemQueueBase<>> _item_queue{nullptr};
     // the reader does not take (permanent) ownership of the data access collection -> weak_ptr
-    std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueue<>>> _data_access_collection;
-    Optional<base::SimulationDataAccessCollection<DataItemQueue<>>::const_iterator>
+    std::weak_ptr<base::SimulationDataAccessCollection<DataItemQueueBase<>>>
+        _data_access_collection;
+    Optional<base::SimulationDataAccessCollection<DataItemQueueBase<>>::const_iterator>
         _data_access_iterator;
+    // the transmitter is released on reset of the simulation bus -> weak_ptr
+    std::weak_ptr<Transmitter> _transmitter;
 };
 
 } // namespace native
@@ -12,40 +12,132 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "simbus_datawriter.h"
 
-#include <fep3/base/sample/data_sample.h>
+#include <algorithm>
 
 namespace fep3 {
 namespace native {
 
 template <class TYPE>
-void SimulationBus::Transmitter::transmit(const std::string& name,
-                                          const data_read_ptr<const TYPE>& sample)
+void SimulationBus::Transmitter::transmit(const data_read_ptr<const TYPE>& sample)
 {
-    for (auto elem: _receiver_queues) {
-        if (elem.first == name) {
-            elem.second->push(sample);
+    const auto receivers = std::atomic_load(&_receivers);
+    for (const auto& receiver: *receivers) {
+        if (pass(receiver, sample)) {
+            receiver._queue->push(sample);
         }
     }
 }
 
-void SimulationBus::Transmitter::add(const std::string& name, DataItemQueuePtr receive_queue)
+template void SimulationBus::Transmitter::transmit(const data_read_ptr<const IDataSample>&);
+template void SimulationBus::Transmitter::transmit(const data_read_ptr<const IStreamType>&);
+
+template <class TYPE>
+SimulationBus::Transmitter::ReceiverQueues SimulationBus::Transmitter::getReceiverQueues(
+    const data_read_ptr<const TYPE>& item)
 {
-    _receiver_queues.emplace(std::make_pair(name, receive_queue));
+    const auto receivers = std::atomic_load(&_receivers);
+    ReceiverQueues receiver_queues;
+    receiver_queues.reserve(receivers->size());
+    for (const auto& receiver: *receivers) {
+        if (pass(receiver, item)) {
+            receiver_queues.push_back(receiver._queue);
+        }
+    }
+    return receiver_queues;
+}
+
+void SimulationBus::Transmitter::add(DataItemQueuePtr receive_queue,
+                                     std::shared_ptr<ReceiverSampleFilter> filter)
+{
+    std::lock_guard<std::mutex> lock(_registration_mutex);
+    auto receivers = std::make_shared<Receivers>(*_receivers);
+    receivers->push_back({std::move(receive_queue), std::move(filter)});
+    std::atomic_store(&_receivers, std::shared_ptr<const Receivers>(std::move(receivers)));
+}
+
+bool SimulationBus::Transmitter::addSingleProducer(DataItemQueuePtr receive_queue,
+                                                   std::shared_ptr<ReceiverSampleFilter> filter)
+{
+    std::lock_guard<std::mutex> lock(_registration_mutex);
+    if (_writer_count > 1) {
+        return false;
+    }
+    auto receivers = std::make_shared<Receivers>(*_receivers);
+    receivers->push_back({std::move(receive_queue), std::move(filter), true});
+    std::atomic_store(&_receivers, std::shared_ptr<const Receivers>(std::move(receivers)));
+    return true;
+}
+
+bool SimulationBus::Transmitter::addWriter()
+{
+    std::lock_guard<std::mutex> lock(_registration_mutex);
+    if (_writer_count > 0 &&
+        std::any_of(_receivers->cbegin(), _receivers->cend(), [](const Receiver& receiver) {
+            return receiver._single_producer;
+        })) {
+        return false;
+    }
+    ++_writer_count;
+    return true;
+}
+
+void SimulationBus::Transmitter::removeWriter()
+{
+    std::lock_guard<std::mutex> lock(_registration_mutex);
+    --_writer_count;
+}
+
+void SimulationBus::Transmitter::remove(const DataItemQueuePtr& receive_queue)
+{
+    std::lock_guard<std::mutex> lock(_registration_mutex);
+    auto receivers = std::make_shared<Receivers>(*_receivers);
+    receivers->erase(std::remove_if(receivers->begin(),
+                                    receivers->end(),
+                                    [&receive_queue](const Receiver& receiver) {
+                                        return receiver._queue == receive_queue;
+                                    }),
+                     receivers->end());
+    std::atomic_store(&_receivers, std::shared_ptr<const Receivers>(std::move(receivers)));
+}
+
+bool SimulationBus::Transmitter::pass(const Receiver& receiver,
+                                      const data_read_ptr<const IDataSample>& sample)
+{
+    return !receiver._filter || receiver._filter->pass(*sample);
+}
+
+bool SimulationBus::Transmitter::pass(const Receiver&, const data_read_ptr<const IStreamType>&)
+{
+    // stream types are never filtered
+    return true;
 }
 
 SimulationBus::DataWriter::DataWriter(
     const std::string& name,
     size_t transmit_buffer_capacity,
-    const std::shared_ptr<SimulationBus::Transmitter>& transmitter)
+    const std::shared_ptr<SimulationBus::Transmitter>& transmitter,
+    size_t sample_size_hint)
 {
     _name = name;
     _transmit_buffer = std::make_unique<DataItemQueue<>>(transmit_buffer_capacity);
     _transmitter = transmitter;
+    _sample_pool = SamplePool<base::DataSample>::create(
+        [](size_t capacity) { return new base::DataSample(capacity, false); },
+        [](const base::DataSample& sample) { return sample.capacity(); },
+        sample_size_hint);
+    _loaned_sample_pool = SamplePool<LoanedDataSample>::create(
+        [this](size_t capacity) { return new LoanedDataSample(capacity, this); },
+        [](const LoanedDataSample& sample) { return sample.getCapacity(); },
+        sample_size_hint);
 }
 
 fep3::Result SimulationBus::DataWriter::write(const IDataSample& data_sample)
 {
-    auto current = std::make_shared<base::DataSample>(data_sample);
+    if (_lossless && _transmit_buffer->size() >= _transmit_buffer->capacity()) {
+        FEP3_RETURN_IF_FAILED(transmit());
+    }
+    auto current = _sample_pool->acquire(data_sample.getSize());
+    *current = data_sample;
 
     _transmit_buffer->push(current);
 
@@ -54,6 +146,9 @@ fep3::Result SimulationBus::DataWriter::write(const IDataSample& data_sample)
 
 fep3::Result SimulationBus::DataWriter::write(const IStreamType& stream_type)
 {
+    if (_lossless && _transmit_buffer->size() >= _transmit_buffer->capacity()) {
+        FEP3_RETURN_IF_FAILED(transmit());
+    }
     auto current = std::make_shared<base::StreamType>(stream_type);
 
     _transmit_buffer->push(current);
@@ -61,22 +156,154 @@ fep3::Result SimulationBus::DataWriter::write(const IStreamType& stream_type)
     return {};
 }
 
+std::shared_ptr<arya::ILoanedDataSample> SimulationBus::DataWriter::loanSample(size_t size)
+{
+    auto loaned_sample = _loaned_sample_pool->acquire(size);
+    loaned_sample->setSize(size);
+    loaned_sample->setTime(Timestamp(0));
+    loaned_sample->setCounter(0);
+    return loaned_sample;
+}
+
+fep3::Result SimulationBus::DataWriter::commit(
+    const std::shared_ptr<arya::ILoanedDataSample>& loaned_sample)
+{
+    if (!loaned_sample) {
+        RETURN_ERROR_DESCRIPTION(ERR_POINTER,
+                                 "Committing a loaned sample to writer '%s' failed. Sample is null",
+                                 _name.c_str());
+    }
+    const auto native_loaned_sample = std::dynamic_pointer_cast<LoanedDataSample>(loaned_sample);
+    if (!native_loaned_sample || !native_loaned_sample->isLoanedFrom(this)) {
+        RETURN_ERROR_DESCRIPTION(
+            ERR_INVALID_ARG,
+            "Committing a loaned sample to writer '%s' failed. Sample was not loaned from this "
+            "writer",
+            _name.c_str());
+    }
+
+    if (_lossless && _transmit_buffer->size() >= _transmit_buffer->capacity()) {
+        FEP3_RETURN_IF_FAILED(transmit());
+    }
+
+    // the loaned memory is shared with the readers, no copy is necessary
+    _transmit_buffer->push(data_read_ptr<const IDataSample>(loaned_sample));
+
+    return {};
+}
+
+SamplePoolStatistics SimulationBus::DataWriter::getSamplePoolStatistics() const
+{
+    const auto sample_pool_statistics = _sample_pool->getStatistics();
+    const auto loaned_sample_pool_statistics = _loaned_sample_pool->getStatistics();
+    return {sample_pool_statistics._allocations + loaned_sample_pool_statistics._allocations,
+            sample_pool_statistics._recycles + loaned_sample_pool_statistics._recycles};
+}
+
+void SimulationBus::DataWriter::setLossless(std::chrono::nanoseconds timeout)
+{
+    _lossless = true;
+    _lossless_timeout = timeout;
+}
+
+const std::shared_ptr<SignalCounters>& SimulationBus::DataWriter::getCounters() const
+{
+    return _transmit_buffer->getCounters();
+}
+
+size_t SimulationBus::DataWriter::getTransmitBufferCapacity() const
+{
+    return _transmit_buffer->capacity();
+}
+
 fep3::Result SimulationBus::DataWriter::transmit()
 {
+    if (_lossless) {
+        return transmitLossless();
+    }
+
     for (auto items = _transmit_buffer->pop();
          std::get<0>(items) != nullptr || std::get<1>(items) != nullptr;
          items = _transmit_buffer->pop()) {
         if (std::get<0>(items) != nullptr) {
-            _transmitter->transmit(_name, std::get<0>(items));
+            _transmitter->transmit(std::get<0>(items));
         }
 
         if (std::get<1>(items) != nullptr) {
-            _transmitter->transmit(_name, std::get<1>(items));
+            _transmitter->transmit(std::get<1>(items));
         }
     }
 
     return {};
 }
 
+fep3::Result SimulationBus::DataWriter::transmitLossless()
+{
+    const auto deadline = std::chrono::steady_clock::now() + _lossless_timeout;
+    bool stalled = false;
+
+    for (;;) {
+        if (_pending_queues.empty()) {
+            _pending_item = _transmit_buffer->pop();
+            if (std::get<0>(_pending_item) == nullptr && std::get<1>(_pending_item) == nullptr) {
+                return {};
+            }
+            const auto receiver_queues =
+                std::get<0>(_pending_item) ?
+                    _transmitter->getReceiverQueues(std::get<0>(_pending_item)) :
+                    _transmitter->getReceiverQueues(std::get<1>(_pending_item));
+            _pending_queues.assign(receiver_queues.cbegin(), receiver_queues.cend());
+        }
+
+        const auto& sample = std::get<0>(_pending_item);
+        const auto& stream_type = std::get<1>(_pending_item);
+        // the pop count is retrieved before the push, so a pop in between is not missed
+        Transmitter::DataItemQueuePtr full_queue;
+        uint64_t full_queue_pop_count = 0;
+        _pending_queues.erase(
+            std::remove_if(_pending_queues.begin(),
+                           _pending_queues.end(),
+                           [&](const std::weak_ptr<DataItemQueueBase<>>& pending_queue) {
+                               // the queue of a destroyed reader is not waited for anymore
+                               const auto queue = pending_queue.lock();
+                               if (!queue) {
+                                   return true;
+                               }
+                               const auto pop_count = queue->getPopCount();
+                               if (sample ? queue->tryPush(sample) : queue->tryPush(stream_type)) {
+                                   return true;
+                               }
+                               if (!full_queue) {
+                                   full_queue = queue;
+                                   full_queue_pop_count = pop_count;
+                               }
+                               return false;
+                           }),
+            _pending_queues.end());
+
+        if (full_queue) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                getCounters()->countRejection();
+                if (_lossless_timeout.count() == 0) {
+                    RETURN_ERROR_DESCRIPTION(ERR_RESOURCE_IN_USE,
+                                             "Transmitting an item of lossless writer '%s' "
+                                             "failed. A reader queue is full",
+                                             _name.c_str());
+                }
+                RETURN_ERROR_DESCRIPTION(ERR_TIMEOUT,
+                                         "Transmitting an item of lossless writer '%s' timed out. "
+                                         "A reader queue is still full",
+                                         _name.c_str());
+            }
+            if (!stalled) {
+                stalled = true;
+                getCounters()->countStall();
+            }
+            // the reader frees space by popping, every queue still pending is retried afterwards
+            full_queue->waitForPop(full_queue_pop_count, deadline);
+        }
+    }
+}
+
 } // namespace native
 } // namespace fep3
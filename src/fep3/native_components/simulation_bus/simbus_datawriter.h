@@ -13,42 +13,137 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #pragma once
 
 #include "data_item_queue.h"
+#include "loaned_data_sample.h"
+#include "receiver_sample_filter.h"
+#include "sample_pool.h"
 #include "simulation_bus.h"
 
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/components/simulation_bus/simulation_bus_loan_intf.h>
+
+#include <chrono>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
 namespace fep3 {
 namespace native {
 
 /**
- * Transmitter which supports SIMO (Single Input Multiple Output) broadcasting of samples to several
- * queues
+ * Transmitter which supports SIMO (Single Input Multiple Output) broadcasting of samples of one
+ * signal to several queues.
+ * The receivers are kept in an immutable flat array, which is replaced on registration and removal
+ * (copy on write). A transmit therefore iterates a snapshot of the array without any lookup and
+ * is not blocked by registrations. Samples are checked against the filter of a receiver before
+ * they are pushed, so filtered samples are neither pushed nor is their pointer copied.
+ * The transmitters are shared by all simulation bus instances of a process, so the writers of a
+ * signal are registered here to enforce the single producer of receiver queues requiring one.
  */
 class SimulationBus::Transmitter {
 public:
-    using DataItemQueuePtr = std::shared_ptr<DataItemQueue<>>;
+    using DataItemQueuePtr = std::shared_ptr<DataItemQueueBase<>>;
+    using ReceiverQueues = std::vector<DataItemQueuePtr>;
+
+    /// Queue of a reader and the optional filter of its samples
+    struct Receiver {
+        DataItemQueuePtr _queue;
+        std::shared_ptr<ReceiverSampleFilter> _filter;
+        /// the queue must not be pushed to by more than one writer
+        bool _single_producer{false};
+    };
+    using Receivers = std::vector<Receiver>;
 
     template <class TYPE>
-    void transmit(const std::string& name, const data_read_ptr<const TYPE>& sample);
+    void transmit(const data_read_ptr<const TYPE>& sample);
+
+    /**
+     * Gets the receiver queues an item is to be pushed to, which are the queues of a snapshot of
+     * the receivers whose filter passes the item
+     *
+     * @param[in] item the item to be pushed
+     * @return the receiver queues
+     * @remark this is threadsafe against transmit and add calls
+     * @remark the filters count the item as passed, so call this once per item
+     */
+    template <class TYPE>
+    ReceiverQueues getReceiverQueues(const data_read_ptr<const TYPE>& item);
 
     /**
      * Add a receiver queue to which samples will be added on transmit
      *
-     * @param[in] name signal name does not have to be unique
-     * @param[in] receive_queue Queue to push name samples
+     * @param[in] receive_queue Queue to push the samples of the signal to
+     * @param[in] filter Filter of the samples to be pushed to the queue, nullptr for all samples
+     * @remark this is threadsafe against transmit and other add calls
+     */
+    void add(DataItemQueuePtr receive_queue, std::shared_ptr<ReceiverSampleFilter> filter = {});
+
+    /**
+     * Add a receiver queue which must not be pushed to by more than one writer, like a
+     * @ref LockFreeDataItemQueue
+     *
+     * @param[in] receive_queue Queue to push the samples of the signal to
+     * @param[in] filter Filter of the samples to be pushed to the queue, nullptr for all samples
+     * @return @c false if more than one writer is registered, the queue is not added then
+     * @remark this is threadsafe against transmit and other add calls
      */
-    void add(const std::string& name, DataItemQueuePtr receive_queue);
+    bool addSingleProducer(DataItemQueuePtr receive_queue,
+                           std::shared_ptr<ReceiverSampleFilter> filter = {});
+
+    /**
+     * Registers a writer transmitting with this transmitter
+     *
+     * @return @c false if a writer is registered already and a receiver queue added by
+     *         @ref addSingleProducer is present, the writer is not registered then
+     * @remark this is threadsafe against transmit, add and other addWriter calls
+     */
+    bool addWriter();
+
+    /**
+     * Unregisters a writer registered by @ref addWriter
+     */
+    void removeWriter();
+
+    /**
+     * Remove a receiver queue, so samples are not added to it anymore
+     *
+     * @param[in] receive_queue Queue previously added by @ref add
+     * @remark this is threadsafe against transmit, add and other remove calls. A transmit
+     * iterating a snapshot taken before the removal might still push to the queue.
+     */
+    void remove(const DataItemQueuePtr& receive_queue);
 
 private:
-    std::unordered_multimap<std::string, DataItemQueuePtr> _receiver_queues;
+    static bool pass(const Receiver& receiver, const data_read_ptr<const IDataSample>& sample);
+    static bool pass(const Receiver& receiver, const data_read_ptr<const IStreamType>& type);
+
+    std::mutex _registration_mutex;
+    std::shared_ptr<const Receivers> _receivers{std::make_shared<Receivers>()};
+    // guarded by the registration mutex
+    size_t _writer_count{0};
 };
 
-class SimulationBus::DataWriter : public arya::ISimulationBus::IDataWriter {
+class SimulationBus::DataWriter : public arya::ISimulationBus::IDataWriter,
+                                  public arya::ILoaningDataWriter {
 public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] name the signal name
+     * @param[in] transmit_buffer_capacity the capacity of the transmit buffer
+     * @param[in] transmitter the transmitter to transmit the samples with, the writer must have
+     *                        been registered by @ref Transmitter::addWriter and is unregistered on
+     *                        destruction
+     * @param[in] sample_size_hint the max size of samples of the signal in bytes used to
+     *                             preallocate pooled samples (0 to use the first written size)
+     */
     DataWriter(const std::string& name,
                size_t transmit_buffer_capacity,
-               const std::shared_ptr<SimulationBus::Transmitter>& transmitter);
+               const std::shared_ptr<SimulationBus::Transmitter>& transmitter,
+               size_t sample_size_hint = 0);
 
     virtual ~DataWriter()
     {
+        _transmitter->removeWriter();
     }
     DataWriter(const DataWriter&) = delete;
     DataWriter(DataWriter&&) = delete;
@@ -60,12 +155,64 @@ public:
 
     fep3::Result transmit() override final;
 
+    std::shared_ptr<arya::ILoanedDataSample> loanSample(size_t size) override final;
+    fep3::Result commit(
+        const std::shared_ptr<arya::ILoanedDataSample>& loaned_sample) override final;
+
+    /**
+     * @brief Gets the accumulated allocation statistics of the sample pools of this writer.
+     * In steady state the number of allocations does not increase anymore.
+     *
+     * @return the sample pool statistics
+     */
+    SamplePoolStatistics getSamplePoolStatistics() const;
+
+    /**
+     * @brief Switches the writer to lossless mode.
+     * A lossless writer does not drop any item if its transmit buffer or a reader queue is full:
+     * @ref transmit waits up to @p timeout for free space in the reader queues and fails with
+     * ERR_TIMEOUT afterwards (or ERR_RESOURCE_IN_USE right away if @p timeout is 0). Items which
+     * have not been transmitted remain in the transmit buffer and are transmitted first on the
+     * next call. A write to a full transmit buffer transmits the buffered items before.
+     * Stalled and rejected transmissions are counted in @ref getCounters.
+     *
+     * @param[in] timeout max time to wait for free space in the reader queues per transmission
+     */
+    void setLossless(std::chrono::nanoseconds timeout);
+
+    /**
+     * @brief Gets the counters of the transmit buffer of this writer, which also count the
+     * stalled and rejected transmissions of the lossless mode
+     *
+     * @return the counters
+     */
+    const std::shared_ptr<SignalCounters>& getCounters() const;
+
+    /**
+     * @brief Gets the capacity of the transmit buffer of this writer
+     *
+     * @return the capacity
+     */
+    size_t getTransmitBufferCapacity() const;
+
 private:
-    using DataItemQueuePtr = std::shared_ptr<DataItemQueue<>>;
+    fep3::Result transmitLossless();
+
     std::unique_ptr<DataItemQueue<>> _transmit_buffer{nullptr};
 
     std::string _name;
     std::shared_ptr<SimulationBus::Transmitter> _transmitter{nullptr};
+
+    std::shared_ptr<SamplePool<base::DataSample>> _sample_pool;
+    std::shared_ptr<SamplePool<LoanedDataSample>> _loaned_sample_pool;
+
+    bool _lossless{false};
+    std::chrono::nanoseconds _lossless_timeout{0};
+    /// item of the transmit buffer which has not been pushed to all receiver queues yet
+    std::tuple<data_read_ptr<const IDataSample>, data_read_ptr<const IStreamType>> _pending_item;
+    /// receiver queues which did not accept the pending item yet, not keeping the queues of
+    /// destroyed readers alive
+    std::vector<std::weak_ptr<DataItemQueueBase<>>> _pending_queues;
 };
 
 } // namespace native
@@ -10,13 +10,42 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 @endverbatim
  */
 
+#include "lock_free_data_item_queue.h"
+#include "mailbox_data_item_queue.h"
 #include "simbus_datareader.h"
 #include "simbus_datawriter.h"
+#include "simulation_bus_player.h"
+#include "simulation_bus_recorder.h"
+#include "simulation_bus_statistics_service.h"
 
 #include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/components/clock/clock_service_intf.h>
+#include <fep3/components/configuration/configuration_service_intf.h>
+#include <fep3/components/service_bus/service_bus_intf.h>
 
+#include <algorithm>
+#include <exception>
 #include <future>
 #include <set>
+#include <thread>
+
+namespace {
+
+size_t getMaxByteSize(const fep3::IStreamType& stream_type)
+{
+    const auto max_byte_size_prop =
+        stream_type.getProperty(fep3::base::arya::meta_type_prop_name_max_byte_size);
+    if (!max_byte_size_prop.empty()) {
+        try {
+            return std::stoul(max_byte_size_prop);
+        }
+        catch (const std::exception&) {
+        }
+    }
+    return 0;
+}
+
+} // namespace
 
 namespace fep3 {
 namespace native {
@@ -29,7 +58,37 @@ class SimulationBus::Impl {
     // We need a sub object for collection data access (data triggered behavior)
     // because the simulation bus cannot be passed to the reader, as lifetime of simulation bus
     // cannot be controlled.
-    std::shared_ptr<base::SimulationDataAccessCollection<DataItemQueue<>>> _data_access_collection;
+    std::shared_ptr<base::SimulationDataAccessCollection<DataItemQueueBase<>>>
+        _data_access_collection;
+    // Signaled by the reader queues on push, so the event driven reception can sleep until
+    // data arrives. There is one notification per dispatch thread, every reader queue signals the
+    // notification of the thread dispatching it.
+    std::vector<std::shared_ptr<ReceptionNotification>> _reception_notifications;
+    size_t _reader_count{0};
+    // guards the notifications and the reader count, readers may be created while receiving
+    std::mutex _reception_notifications_mutex;
+    SimulationBusConfiguration& _configuration;
+
+    /// Counters of a reader queue or of the transmit buffer of a writer created by this bus
+    struct CountedSignal {
+        std::string _signal_name;
+        size_t _queue_capacity;
+        std::weak_ptr<const SignalCounters> _counters;
+    };
+    // counters of the readers and writers created by this bus, which are read by the statistics
+    // RPC service concurrently to the creation of readers and writers
+    mutable std::mutex _statistics_mutex;
+    std::vector<CountedSignal> _counted_readers;
+    std::vector<CountedSignal> _counted_writers;
+
+    // records the transmitted items if a recording file is configured
+    std::unique_ptr<SimulationBusRecorder> _recorder;
+    std::vector<std::string> _recording_signals;
+    std::set<std::string> _recorded_signals;
+
+    // replays a capture file following the clock if a replay file is configured
+    std::shared_ptr<SimulationBusPlayer> _player;
+    fep3::arya::IClockService* _replay_clock_service{nullptr};
 
     using Transmitters = std::unordered_map<std::string, std::shared_ptr<Transmitter>>;
     static Transmitters& getTransmitters()
@@ -44,9 +103,11 @@ class SimulationBus::Impl {
     } _exitSignal;
 
 public:
-    Impl()
+    Impl(SimulationBusConfiguration& configuration)
         : _data_access_collection(
-              std::make_shared<base::SimulationDataAccessCollection<DataItemQueue<>>>())
+              std::make_shared<base::SimulationDataAccessCollection<DataItemQueueBase<>>>()),
+          _reception_notifications{std::make_shared<ReceptionNotification>()},
+          _configuration(configuration)
     {
         using namespace fep3::base::arya;
         _supported_meta_types.emplace_back(meta_type_plain);
@@ -76,28 +137,77 @@ public:
         return getReader(name, queue_capacity);
     }
 
-    std::unique_ptr<IDataReader> getReader(const std::string& name, size_t queue_capacity)
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           size_t queue_capacity,
+                                           std::shared_ptr<ReceiverSampleFilter> filter = {})
     {
         if (registerAndCheckIfExists(_registered_readers, name)) {
             return nullptr;
         }
+        recordSignal(name);
+
+        // the configuration is read once for the queue type and its dispatch thread
+        _configuration.updatePropertyVariables();
+        const auto& transmitter = getTransmitters()[name];
+        std::shared_ptr<DataItemQueueBase<>> receive_queue;
+        if (queue_capacity == 1) {
+            // readers only interested in the newest item do not need a circular buffer
+            receive_queue = std::make_shared<MailboxDataItemQueue<>>(getDispatchNotification());
+            transmitter->add(receive_queue, std::move(filter));
+        }
+        else if (useLockFreeReader(name)) {
+            receive_queue = std::make_shared<LockFreeDataItemQueue<>>(queue_capacity,
+                                                                      getDispatchNotification());
+            // the writers of another simulation bus instance of the process share the transmitter
+            if (!transmitter->addSingleProducer(receive_queue, std::move(filter))) {
+                _registered_readers.erase(name);
+                return nullptr;
+            }
+        }
+        else {
+            receive_queue =
+                std::make_shared<DataItemQueue<>>(queue_capacity, getDispatchNotification());
+            transmitter->add(receive_queue, std::move(filter));
+        }
+        addCountedSignal(_counted_readers, name, queue_capacity, receive_queue->getCounters());
 
-        auto receive_queue = std::make_shared<DataItemQueue<>>(queue_capacity);
-
-        getTransmitters()[name]->add(name, receive_queue);
-
-        auto reader = std::make_unique<DataReader>(receive_queue, _data_access_collection);
+        auto reader =
+            std::make_unique<DataReader>(receive_queue, _data_access_collection, transmitter);
 
         return reader;
     }
 
-    std::unique_ptr<IDataWriter> getWriter(const std::string& name, size_t queue_capacity)
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           const IStreamType& stream_type,
+                                           size_t queue_capacity)
+    {
+        // samples of the writer are preallocated with the max size of the stream type if given
+        return getWriter(name, queue_capacity, getMaxByteSize(stream_type));
+    }
+
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           size_t queue_capacity,
+                                           size_t sample_size_hint = 0)
     {
         if (registerAndCheckIfExists(_registered_writers, name)) {
             return nullptr;
         }
+        recordSignal(name);
 
-        auto writer = std::make_unique<DataWriter>(name, queue_capacity, getTransmitters()[name]);
+        // a lock-free reader queue of the signal supports a single writer only
+        const auto& transmitter = getTransmitters()[name];
+        if (!transmitter->addWriter()) {
+            _registered_writers.erase(name);
+            return nullptr;
+        }
+        auto writer =
+            std::make_unique<DataWriter>(name, queue_capacity, transmitter, sample_size_hint);
+        if (useLosslessWriter(name)) {
+            writer->setLossless(std::chrono::nanoseconds(
+                static_cast<int64_t>(_configuration._lossless_write_timeout)));
+        }
+        addCountedSignal(
+            _counted_writers, name, writer->getTransmitBufferCapacity(), writer->getCounters());
         return writer;
     }
 
@@ -115,30 +225,14 @@ public:
         }
 
         if (_data_access_collection) {
-            const auto& data_access_collection = *_data_access_collection.get();
-            {
-                // start polling the item queues only if there are any data access entries in the
-                // collection
-                if (0 < _data_access_collection->size()) {
-                    std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
-                    std::future<void> futureObj = _exitSignal.trigger.get_future();
-
-                    // the Simulation Bus is now prepared for the reception of data and for a call
-                    // to stopBlockingReception
-                    reception_preparation_done_callback_caller.reset();
-
-                    while (futureObj.wait_for(std::chrono::milliseconds(1)) ==
-                           std::future_status::timeout) {
-                        for (auto data_access_iterator = data_access_collection.cbegin();
-                             data_access_iterator != data_access_collection.cend();
-                             ++data_access_iterator) {
-                            auto res = data_access_iterator->_item_queue->pop();
-                            DataReader::dispatch<decltype(res)>(
-                                res, *data_access_iterator->_receiver.get());
-                        }
-                    }
-
-                    return;
+            // start the reception only if there are any data access entries in the collection
+            if (0 < _data_access_collection->size()) {
+                _configuration.updatePropertyVariables();
+                if (_configuration._use_polling_reception) {
+                    runPollingReception(std::move(reception_preparation_done_callback_caller));
+                }
+                else {
+                    runEventDrivenReception(std::move(reception_preparation_done_callback_caller));
                 }
             }
         }
@@ -147,41 +241,345 @@ public:
     void stopBlockingReception()
     {
         _exitSignal.trigger.set_value();
+        requestStopOfDispatchThreads();
 
         {
             std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
             _exitSignal.trigger = std::promise<void>{};
+            resetDispatchNotifications();
         }
     }
 
     fep3::Result reset()
     {
+        if (_replay_clock_service) {
+            _replay_clock_service->unregisterEventSink(_player);
+            _replay_clock_service = nullptr;
+        }
+        _player.reset();
         _registered_readers.clear();
         _registered_writers.clear();
         _data_access_collection->clear();
         getTransmitters().clear();
+        // the recorder records the remaining items and completes the file
+        _recorder.reset();
+        _recorded_signals.clear();
+        {
+            std::lock_guard<std::mutex> lock(_reception_notifications_mutex);
+            _reader_count = 0;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_statistics_mutex);
+            _counted_readers.clear();
+            _counted_writers.clear();
+        }
+
+        return {};
+    }
+
+    fep3::Result startRecording()
+    {
+        _configuration.updatePropertyVariables();
+        const std::string recording_file = _configuration._recording_file;
+        if (recording_file.empty()) {
+            return {};
+        }
+
+        const int64_t recording_file_size = _configuration._recording_file_size;
+        auto capture_file = CaptureFileWriter::create(
+            recording_file, static_cast<size_t>(std::max<int64_t>(recording_file_size, 0)));
+        if (!capture_file) {
+            RETURN_ERROR_DESCRIPTION(ERR_FAILED,
+                                     "Creating the recording file '%s' of size %lld failed",
+                                     recording_file.c_str(),
+                                     static_cast<long long>(recording_file_size));
+        }
+        _recording_signals = _configuration._recording_signals;
+        _recorder = std::make_unique<SimulationBusRecorder>(std::move(capture_file));
+        return {};
+    }
 
+    fep3::Result startReplay(const IComponents* components)
+    {
+        _configuration.updatePropertyVariables();
+        const std::string replay_file = _configuration._replay_file;
+        if (replay_file.empty()) {
+            return {};
+        }
+        // the player transmits from the clock thread in addition to the writers, but the
+        // lock-free reader queues only support a single writer
+        const std::vector<std::string> lock_free_reader_signals =
+            _configuration._lock_free_reader_signals;
+        if (std::any_of(lock_free_reader_signals.cbegin(),
+                        lock_free_reader_signals.cend(),
+                        [](const std::string& name) { return !name.empty(); })) {
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED,
+                                     "Replaying the file '%s' is not supported in combination "
+                                     "with lock-free reader signals",
+                                     replay_file.c_str());
+        }
+
+        const auto clock_service =
+            components ? components->getComponent<fep3::arya::IClockService>() : nullptr;
+        if (!clock_service) {
+            RETURN_ERROR_DESCRIPTION(
+                ERR_NOT_FOUND,
+                "%s is not part of the given component registry, but required for replay",
+                fep3::arya::getComponentIID<fep3::arya::IClockService>().c_str());
+        }
+        std::shared_ptr<const CaptureFileReader> capture_file =
+            CaptureFileReader::open(replay_file);
+        if (!capture_file) {
+            RETURN_ERROR_DESCRIPTION(
+                ERR_FAILED, "Opening the replay file '%s' failed", replay_file.c_str());
+        }
+        _player = std::make_shared<SimulationBusPlayer>(
+            std::move(capture_file), [](const std::string& name) { return getTransmitter(name); });
+        FEP3_RETURN_IF_FAILED(clock_service->registerEventSink(_player));
+        _replay_clock_service = clock_service;
         return {};
     }
 
+    std::vector<SignalStatistics> getReaderStatistics() const
+    {
+        return getStatistics(_counted_readers);
+    }
+
+    std::vector<SignalStatistics> getWriterStatistics() const
+    {
+        return getStatistics(_counted_writers);
+    }
+
 private:
+    using ReceptionPreparationDoneCallbackCaller =
+        std::unique_ptr<bool, std::function<void(bool*)>>;
+
+    /// Readers dispatched by one thread, all of them signal the same notification
+    struct DispatchGroup {
+        std::shared_ptr<ReceptionNotification> _notification;
+        std::vector<base::SimulationDataAccessCollection<DataItemQueueBase<>>::const_iterator>
+            _data_accesses;
+    };
+
+    void runPollingReception(ReceptionPreparationDoneCallbackCaller on_prepared_callback)
+    {
+        const auto& data_access_collection = *_data_access_collection.get();
+
+        std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
+        std::future<void> futureObj = _exitSignal.trigger.get_future();
+
+        // the Simulation Bus is now prepared for the reception of data and for a call
+        // to stopBlockingReception
+        on_prepared_callback.reset();
+
+        while (futureObj.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout) {
+            for (auto data_access_iterator = data_access_collection.cbegin();
+                 data_access_iterator != data_access_collection.cend();
+                 ++data_access_iterator) {
+                auto res = data_access_iterator->_item_queue->pop();
+                DataReader::dispatch<decltype(res)>(res, *data_access_iterator->_receiver.get());
+            }
+        }
+    }
+
+    void runEventDrivenReception(ReceptionPreparationDoneCallbackCaller on_prepared_callback)
+    {
+        const auto& data_access_collection = *_data_access_collection.get();
+
+        std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
+
+        // every reader is dispatched by the thread waiting for the notification of its queue,
+        // so the items of a reader are dispatched in order
+        std::vector<DispatchGroup> dispatch_groups;
+        for (auto data_access_iterator = data_access_collection.cbegin();
+             data_access_iterator != data_access_collection.cend();
+             ++data_access_iterator) {
+            const auto& notification =
+                data_access_iterator->_item_queue->getReceptionNotification();
+            auto dispatch_group = std::find_if(
+                dispatch_groups.begin(),
+                dispatch_groups.end(),
+                [&notification](const DispatchGroup& group) {
+                    return group._notification == notification;
+                });
+            if (dispatch_group == dispatch_groups.end()) {
+                dispatch_group =
+                    dispatch_groups.insert(dispatch_groups.end(), DispatchGroup{notification, {}});
+            }
+            dispatch_group->_data_accesses.push_back(data_access_iterator);
+        }
+
+        // the first exception thrown while dispatching stops all groups and is rethrown on the
+        // calling thread once every dispatch thread has finished
+        std::mutex dispatch_exception_mutex;
+        std::exception_ptr dispatch_exception;
+        const auto run_dispatch_group = [this, &dispatch_exception_mutex, &dispatch_exception](
+                                            const DispatchGroup& dispatch_group) {
+            try {
+                runDispatchGroup(dispatch_group);
+            }
+            catch (...) {
+                {
+                    std::lock_guard<std::mutex> exception_lock(dispatch_exception_mutex);
+                    if (!dispatch_exception) {
+                        dispatch_exception = std::current_exception();
+                    }
+                }
+                requestStopOfDispatchThreads();
+            }
+        };
+
+        // the first group is dispatched by the calling thread
+        std::vector<std::thread> dispatch_threads;
+        for (auto dispatch_group = std::next(dispatch_groups.cbegin());
+             dispatch_group != dispatch_groups.cend();
+             ++dispatch_group) {
+            dispatch_threads.emplace_back(
+                [&run_dispatch_group, dispatch_group]() { run_dispatch_group(*dispatch_group); });
+        }
+
+        // the Simulation Bus is now prepared for the reception of data and for a call
+        // to stopBlockingReception
+        on_prepared_callback.reset();
+
+        run_dispatch_group(dispatch_groups.front());
+        for (auto& dispatch_thread: dispatch_threads) {
+            dispatch_thread.join();
+        }
+        if (dispatch_exception) {
+            // the stop requested by the failing group must not end the next reception at once
+            resetDispatchNotifications();
+            std::rethrow_exception(dispatch_exception);
+        }
+    }
+
+    static void runDispatchGroup(const DispatchGroup& dispatch_group)
+    {
+        // items might have been pushed before the reception was started, so drain once upfront
+        do {
+            for (const auto& data_access_iterator: dispatch_group._data_accesses) {
+                auto& item_queue = *data_access_iterator->_item_queue;
+                while (0 < item_queue.size()) {
+                    auto res = item_queue.pop();
+                    DataReader::dispatch<decltype(res)>(res,
+                                                        *data_access_iterator->_receiver.get());
+                }
+            }
+        } while (dispatch_group._notification->wait());
+    }
+
+    void requestStopOfDispatchThreads()
+    {
+        std::lock_guard<std::mutex> lock(_reception_notifications_mutex);
+        for (const auto& reception_notification: _reception_notifications) {
+            reception_notification->requestStop();
+        }
+    }
+
+    void resetDispatchNotifications()
+    {
+        std::lock_guard<std::mutex> lock(_reception_notifications_mutex);
+        for (const auto& reception_notification: _reception_notifications) {
+            reception_notification->reset();
+        }
+    }
+
+    /// must be called with the configuration updated
+    std::shared_ptr<ReceptionNotification> getDispatchNotification()
+    {
+        std::lock_guard<std::mutex> lock(_reception_notifications_mutex);
+        const auto dispatch_thread_count =
+            static_cast<size_t>(std::max<int32_t>(_configuration._dispatch_threads, 1));
+        while (_reception_notifications.size() < dispatch_thread_count) {
+            _reception_notifications.push_back(std::make_shared<ReceptionNotification>());
+        }
+        // the readers are distributed round robin over the dispatch threads
+        return _reception_notifications[_reader_count++ % dispatch_thread_count];
+    }
+
+    void addCountedSignal(std::vector<CountedSignal>& counted_signals,
+                          const std::string& name,
+                          size_t queue_capacity,
+                          const std::shared_ptr<const SignalCounters>& counters)
+    {
+        std::lock_guard<std::mutex> lock(_statistics_mutex);
+        // counters of destroyed writers are removed lazily
+        counted_signals.erase(std::remove_if(counted_signals.begin(),
+                                             counted_signals.end(),
+                                             [](const CountedSignal& counted_signal) {
+                                                 return counted_signal._counters.expired();
+                                             }),
+                              counted_signals.end());
+        counted_signals.push_back({name, queue_capacity, counters});
+    }
+
+    std::vector<SignalStatistics> getStatistics(
+        const std::vector<CountedSignal>& counted_signals) const
+    {
+        std::lock_guard<std::mutex> lock(_statistics_mutex);
+        std::vector<SignalStatistics> statistics;
+        for (const auto& counted_signal: counted_signals) {
+            if (const auto counters = counted_signal._counters.lock()) {
+                statistics.push_back(counters->getStatistics(counted_signal._signal_name,
+                                                              counted_signal._queue_capacity));
+            }
+        }
+        return statistics;
+    }
+
+    void recordSignal(const std::string& name)
+    {
+        if (_recorder && isSignalListed(_recording_signals, name) &&
+            _recorded_signals.emplace(name).second) {
+            getTransmitters()[name]->add(_recorder->createSignalQueue(name));
+        }
+    }
+
+    /// must be called with the configuration updated
+    bool useLockFreeReader(const std::string& name) const
+    {
+        return isSignalListed(_configuration._lock_free_reader_signals, name);
+    }
+
+    bool useLosslessWriter(const std::string& name)
+    {
+        _configuration.updatePropertyVariables();
+        return isSignalListed(_configuration._lossless_writer_signals, name);
+    }
+
+    static bool isSignalListed(const std::vector<std::string>& signals, const std::string& name)
+    {
+        if (signals.size() == 1u && signals.front() == "*") {
+            return true;
+        }
+        return std::find(signals.cbegin(), signals.cend(), name) != signals.cend();
+    }
+
     bool registerAndCheckIfExists(std::set<std::string>& registry, const std::string& name)
     {
         if (registry.find(name) != registry.end()) {
             return true;
         }
 
-        if (getTransmitters().find(name) == getTransmitters().end()) {
-            getTransmitters()[name] = std::make_shared<Transmitter>();
-        }
+        getTransmitter(name);
 
         registry.emplace(name);
 
         return false;
     }
+
+    static std::shared_ptr<Transmitter> getTransmitter(const std::string& name)
+    {
+        auto& transmitter = getTransmitters()[name];
+        if (!transmitter) {
+            transmitter = std::make_shared<Transmitter>();
+        }
+        return transmitter;
+    }
 };
 
-SimulationBus::SimulationBus() : _impl(std::make_unique<SimulationBus::Impl>())
+SimulationBus::SimulationBus()
+    : _impl(std::make_unique<SimulationBus::Impl>(_simulation_bus_configuration))
 {
 }
 
@@ -189,9 +587,49 @@ SimulationBus::~SimulationBus()
 {
 }
 
+fep3::Result SimulationBus::create()
+{
+    const auto components = _components.lock();
+    if (components) {
+        const auto configuration_service = components->getComponent<IConfigurationService>();
+        if (configuration_service) {
+            FEP3_RETURN_IF_FAILED(
+                _simulation_bus_configuration.initConfiguration(*configuration_service));
+        }
+
+        // the statistics are optional, so a missing service bus is no error
+        const auto service_bus = components->getComponent<IServiceBus>();
+        const auto rpc_server = service_bus ? service_bus->getServer() : nullptr;
+        if (rpc_server && !_rpc_service) {
+            _rpc_service = std::make_shared<RPCSimulationBusStatisticsService>(*this);
+            FEP3_RETURN_IF_FAILED(rpc_server->registerService(
+                ::fep3::rpc::IRPCSimulationBusStatisticsDef::getRPCDefaultName(), _rpc_service));
+        }
+    }
+    return {};
+}
+
+fep3::Result SimulationBus::destroy()
+{
+    _simulation_bus_configuration.deinitConfiguration();
+    const auto components = _components.lock();
+    if (components && _rpc_service) {
+        const auto service_bus = components->getComponent<IServiceBus>();
+        const auto rpc_server = service_bus ? service_bus->getServer() : nullptr;
+        if (rpc_server) {
+            FEP3_RETURN_IF_FAILED(rpc_server->unregisterService(
+                ::fep3::rpc::IRPCSimulationBusStatisticsDef::getRPCDefaultName()));
+        }
+        _rpc_service.reset();
+    }
+    return {};
+}
+
 fep3::Result SimulationBus::initialize()
 {
-    return _impl->reset();
+    FEP3_RETURN_IF_FAILED(_impl->reset());
+    FEP3_RETURN_IF_FAILED(_impl->startRecording());
+    return _impl->startReplay(_components.lock().get());
 }
 
 fep3::Result SimulationBus::deinitialize()
@@ -228,16 +666,22 @@ std::unique_ptr<fep3::arya::ISimulationBus::IDataReader> SimulationBus::getReade
     return _impl->getReader(name, queue_capacity);
 }
 
+std::unique_ptr<fep3::arya::ISimulationBus::IDataReader> SimulationBus::getReader(
+    const std::string& name, size_t queue_capacity, const SampleFilter& filter)
+{
+    return _impl->getReader(name, queue_capacity, std::make_shared<ReceiverSampleFilter>(filter));
+}
+
 std::unique_ptr<fep3::arya::ISimulationBus::IDataWriter> SimulationBus::getWriter(
-    const std::string& name, const IStreamType&)
+    const std::string& name, const IStreamType& stream_type)
 {
-    return _impl->getWriter(name, 1);
+    return _impl->getWriter(name, stream_type, 1);
 }
 
 std::unique_ptr<fep3::arya::ISimulationBus::IDataWriter> SimulationBus::getWriter(
-    const std::string& name, const IStreamType&, size_t queue_capacity)
+    const std::string& name, const IStreamType& stream_type, size_t queue_capacity)
 {
-    return _impl->getWriter(name, queue_capacity);
+    return _impl->getWriter(name, stream_type, queue_capacity);
 }
 
 std::unique_ptr<fep3::arya::ISimulationBus::IDataWriter> SimulationBus::getWriter(
@@ -263,5 +707,66 @@ void SimulationBus::stopBlockingReception()
     _impl->stopBlockingReception();
 }
 
+std::vector<SignalStatistics> SimulationBus::getReaderStatistics() const
+{
+    return _impl->getReaderStatistics();
+}
+
+std::vector<SignalStatistics> SimulationBus::getWriterStatistics() const
+{
+    return _impl->getWriterStatistics();
+}
+
+SimulationBus::SimulationBusConfiguration::SimulationBusConfiguration()
+    : Configuration(FEP3_NATIVE_SIMBUS_CONFIG)
+{
+}
+
+fep3::Result SimulationBus::SimulationBusConfiguration::registerPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _use_polling_reception, FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _lock_free_reader_signals, FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_dispatch_threads, FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _lossless_writer_signals, FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _lossless_write_timeout, FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_recording_file, FEP3_NATIVE_SIMBUS_RECORDING_FILE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _recording_file_size, FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(
+        _recording_signals, FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_replay_file, FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY));
+    return {};
+}
+
+fep3::Result SimulationBus::SimulationBusConfiguration::unregisterPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _use_polling_reception, FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _lock_free_reader_signals, FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_dispatch_threads,
+                                                     FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _lossless_writer_signals, FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _lossless_write_timeout, FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_recording_file, FEP3_NATIVE_SIMBUS_RECORDING_FILE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _recording_file_size, FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(
+        _recording_signals, FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_replay_file, FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY));
+    return {};
+}
+
 } // namespace native
 } // namespace fep3
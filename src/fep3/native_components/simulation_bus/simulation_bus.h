@@ -12,14 +12,22 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include "signal_counters.h"
+
+#include <fep3/base/properties/propertynode.h>
 #include <fep3/components/base/component.h>
+#include <fep3/components/service_bus/rpc/rpc_intf.h>
+#include <fep3/components/simulation_bus/simulation_bus_filter_intf.h>
 #include <fep3/components/simulation_bus/simulation_bus_intf.h>
 
+#include <vector>
+
 namespace fep3 {
 namespace native {
 
 // simulation bus implementation supporting the arya service bus
-class SimulationBus : public fep3::base::Component<fep3::arya::ISimulationBus> {
+class SimulationBus : public fep3::base::Component<fep3::arya::ISimulationBus>,
+                      public fep3::arya::IFilteringSimulationBus {
 public:
     SimulationBus();
     virtual ~SimulationBus();
@@ -29,6 +37,8 @@ public:
     SimulationBus& operator=(SimulationBus&&) = delete;
 
 public: // inherited via base::Component
+    fep3::Result create() override;
+    fep3::Result destroy() override;
     fep3::Result initialize() override;
     fep3::Result deinitialize() override;
 
@@ -47,6 +57,10 @@ public:
     std::unique_ptr<IDataReader> getReader(const std::string& name,
                                            size_t queue_capacity) override final;
 
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           size_t queue_capacity,
+                                           const SampleFilter& filter) override final;
+
     std::unique_ptr<IDataWriter> getWriter(const std::string& name,
                                            const IStreamType& stream_type) override final;
 
@@ -63,13 +77,64 @@ public:
         const std::function<void()>& reception_preparation_done_callback) override final;
     void stopBlockingReception() override final;
 
+    /**
+     * @brief Gets the counters of all readers created by this simulation bus
+     *
+     * @return the statistics per reader
+     * @remark this is threadsafe against the creation of readers and the transmission of data
+     */
+    std::vector<SignalStatistics> getReaderStatistics() const;
+
+    /**
+     * @brief Gets the counters of all writers created by this simulation bus
+     *
+     * @return the statistics per writer
+     * @remark this is threadsafe against the creation of writers and the transmission of data
+     */
+    std::vector<SignalStatistics> getWriterStatistics() const;
+
     class Transmitter;
     class DataReader;
     class DataWriter;
 
 private:
+    class SimulationBusConfiguration : public fep3::base::Configuration {
+    public:
+        SimulationBusConfiguration();
+        ~SimulationBusConfiguration() = default;
+
+    public:
+        fep3::Result registerPropertyVariables() override;
+        fep3::Result unregisterPropertyVariables() override;
+
+    public:
+        fep3::base::PropertyVariable<bool> _use_polling_reception{
+            FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<std::vector<std::string>> _lock_free_reader_signals{
+            FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<int32_t> _dispatch_threads{
+            FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<std::vector<std::string>> _lossless_writer_signals{
+            FEP3_NATIVE_SIMBUS_LOSSLESS_WRITER_SIGNALS_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<int64_t> _lossless_write_timeout{
+            FEP3_NATIVE_SIMBUS_LOSSLESS_WRITE_TIMEOUT_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<std::string> _recording_file{
+            FEP3_NATIVE_SIMBUS_RECORDING_FILE_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<int64_t> _recording_file_size{
+            FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<std::vector<std::string>> _recording_signals{
+            {FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_DEFAULT_VALUE}};
+        fep3::base::PropertyVariable<std::string> _replay_file{
+            FEP3_NATIVE_SIMBUS_REPLAY_FILE_DEFAULT_VALUE};
+    };
+
+    // declared before _impl, which refers to the configuration during its whole lifetime
+    SimulationBusConfiguration _simulation_bus_configuration;
+
     class Impl;
     std::unique_ptr<Impl> _impl;
+
+    std::shared_ptr<IRPCServer::IRPCService> _rpc_service{nullptr};
 };
 
 } // namespace native
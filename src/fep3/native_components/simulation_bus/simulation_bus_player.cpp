@@ -0,0 +1,195 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "simulation_bus_player.h"
+
+#include <cstring>
+#include <map>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * Read-only sample whose payload is the payload of a sample record within the mapping of the
+ * capture file. It keeps the capture file open, so it may outlive the player.
+ */
+class SimulationBusPlayer::CapturedDataSample : public IDataSample {
+public:
+    CapturedDataSample(const std::shared_ptr<const CaptureFileReader>& file,
+                       const CaptureRecord& record)
+        : _file(file),
+          _data(record._data),
+          _size(record._size),
+          _time(record._time),
+          _counter(record._counter)
+    {
+    }
+
+    Timestamp getTime() const override
+    {
+        return _time;
+    }
+
+    size_t getSize() const override
+    {
+        return _size;
+    }
+
+    uint32_t getCounter() const override
+    {
+        return _counter;
+    }
+
+    size_t read(arya::IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(_data, _size);
+    }
+
+    void setTime(const Timestamp& time) override
+    {
+        _time = time;
+    }
+
+    // the payload is read-only memory of the capture file
+    size_t write(const arya::IRawMemory&) override
+    {
+        return 0;
+    }
+
+    void setCounter(uint32_t counter) override
+    {
+        _counter = counter;
+    }
+
+private:
+    const std::shared_ptr<const CaptureFileReader> _file;
+    const uint8_t* const _data;
+    const size_t _size;
+    Timestamp _time;
+    uint32_t _counter;
+};
+
+SimulationBusPlayer::SimulationBusPlayer(std::shared_ptr<const CaptureFileReader> file,
+                                         const TransmitterResolver& resolve_transmitter)
+    : _file(std::move(file)), _meta_record_offsets(_file->getMetaRecordOffsets())
+{
+    // the recorder assigns the signal ids densely in the order of the signal records, so ids
+    // beyond the number of signal records are ignored in case the file is corrupt
+    std::vector<CaptureRecord> signal_records;
+    for (auto offset: _meta_record_offsets) {
+        CaptureRecord record;
+        if (_file->read(offset, record) && record._type == CaptureRecordType::signal) {
+            signal_records.push_back(record);
+        }
+    }
+    _transmitters.resize(signal_records.size());
+    for (const auto& record: signal_records) {
+        if (record._signal_id < _transmitters.size()) {
+            // the payload of signal records is the zero terminated signal name, which is not
+            // read beyond the record in case the file is corrupt
+            const auto name = reinterpret_cast<const char*>(record._data);
+            _transmitters[record._signal_id] =
+                resolve_transmitter(std::string(name, strnlen(name, record._size)));
+        }
+    }
+}
+
+void SimulationBusPlayer::seek(Timestamp time)
+{
+    std::lock_guard<std::mutex> lock(_replay_mutex);
+    seekToOffset(_file->findSample(time));
+}
+
+size_t SimulationBusPlayer::replayUntil(Timestamp time)
+{
+    std::lock_guard<std::mutex> lock(_replay_mutex);
+    size_t sample_count = 0;
+    CaptureRecord record;
+    for (auto next_offset = _offset; _file->read(next_offset, record); _offset = next_offset) {
+        if (record._type == CaptureRecordType::sample) {
+            if (record._time > time) {
+                break;
+            }
+            ++sample_count;
+        }
+        transmit(record);
+    }
+    return sample_count;
+}
+
+void SimulationBusPlayer::timeUpdateBegin(Timestamp, Timestamp new_time)
+{
+    // the samples are transmitted before the jobs of the new time are triggered
+    replayUntil(new_time);
+}
+
+void SimulationBusPlayer::timeUpdating(Timestamp)
+{
+}
+
+void SimulationBusPlayer::timeUpdateEnd(Timestamp)
+{
+}
+
+void SimulationBusPlayer::timeResetBegin(Timestamp, Timestamp new_time)
+{
+    seek(new_time);
+    replayUntil(new_time);
+}
+
+void SimulationBusPlayer::timeResetEnd(Timestamp)
+{
+}
+
+void SimulationBusPlayer::seekToOffset(uint64_t offset)
+{
+    // the stream types recorded before the offset are still valid at the offset
+    std::map<uint32_t, CaptureRecord> stream_types;
+    for (auto meta_record_offset: _meta_record_offsets) {
+        CaptureRecord record;
+        if (meta_record_offset >= offset || !_file->read(meta_record_offset, record)) {
+            break;
+        }
+        if (record._type == CaptureRecordType::stream_type) {
+            stream_types[record._signal_id] = record;
+        }
+    }
+    for (const auto& stream_type: stream_types) {
+        transmit(stream_type.second);
+    }
+    _offset = offset;
+}
+
+void SimulationBusPlayer::transmit(const CaptureRecord& record)
+{
+    const auto transmitter = getTransmitter(record._signal_id);
+    if (!transmitter) {
+        return;
+    }
+    if (record._type == CaptureRecordType::sample) {
+        transmitter->transmit(
+            data_read_ptr<const IDataSample>(std::make_shared<CapturedDataSample>(_file, record)));
+    }
+    else if (record._type == CaptureRecordType::stream_type) {
+        if (const auto stream_type = toStreamType(record)) {
+            transmitter->transmit(stream_type);
+        }
+    }
+}
+
+SimulationBus::Transmitter* SimulationBusPlayer::getTransmitter(uint32_t signal_id) const
+{
+    return signal_id < _transmitters.size() ? _transmitters[signal_id].get() : nullptr;
+}
+
+} // namespace native
+} // namespace fep3
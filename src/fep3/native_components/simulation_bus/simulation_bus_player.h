@@ -0,0 +1,105 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "capture_file.h"
+#include "simbus_datawriter.h"
+
+#include <fep3/components/clock/clock_intf.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Replays a capture file recorded by the @ref SimulationBusRecorder into the transmitters of
+ * the native simulation bus following the events of a discrete clock.
+ * Before the clock updates its time, all samples up to the new time are transmitted, so the jobs
+ * triggered by the time update receive them. As the player does not wait for anything but the
+ * clock, replay runs as fast as the clock steps, which is as fast as possible for a simulation
+ * clock with time factor @ref FEP3_CLOCK_SIM_TIME_TIME_FACTOR_AFAP_VALUE.
+ * The transmitted samples do not copy the payload but refer to the mapping of the capture file,
+ * which is kept alive as long as any sample is in use. A time reset of the clock seeks the
+ * replay to the new time by means of the time index of the capture file.
+ *
+ * @remark The events of continuous clocks do not contain time updates, so the player only seeks
+ * on their time resets but does not replay.
+ */
+class SimulationBusPlayer : public arya::IClock::IEventSink {
+public:
+    /// Gets the transmitter of a signal by name, creating it if necessary
+    using TransmitterResolver =
+        std::function<std::shared_ptr<SimulationBus::Transmitter>(const std::string&)>;
+
+    /**
+     * @brief CTOR, resolves the transmitters of all signals of the capture file and seeks to the
+     * first sample
+     *
+     * @param[in] file the capture file to replay
+     * @param[in] resolve_transmitter resolver of the transmitters of the recorded signals
+     */
+    SimulationBusPlayer(std::shared_ptr<const CaptureFileReader> file,
+                        const TransmitterResolver& resolve_transmitter);
+    ~SimulationBusPlayer() = default;
+    SimulationBusPlayer(const SimulationBusPlayer&) = delete;
+    SimulationBusPlayer(SimulationBusPlayer&&) = delete;
+    SimulationBusPlayer& operator=(const SimulationBusPlayer&) = delete;
+    SimulationBusPlayer& operator=(SimulationBusPlayer&&) = delete;
+
+    /**
+     * @brief Seeks the replay to the first sample of the given time or later.
+     * The stream types of the signals valid at that sample are transmitted again.
+     *
+     * @param[in] time the time to seek to
+     */
+    void seek(Timestamp time);
+
+    /**
+     * @brief Transmits all records up to the samples of the given time
+     *
+     * @param[in] time the time to replay until (inclusive)
+     * @return the number of transmitted samples
+     */
+    size_t replayUntil(Timestamp time);
+
+public: // arya::IClock::IEventSink
+    void timeUpdateBegin(Timestamp old_time, Timestamp new_time) override;
+    void timeUpdating(Timestamp new_time) override;
+    void timeUpdateEnd(Timestamp new_time) override;
+    void timeResetBegin(Timestamp old_time, Timestamp new_time) override;
+    void timeResetEnd(Timestamp new_time) override;
+
+private:
+    class CapturedDataSample;
+
+    void seekToOffset(uint64_t offset);
+    void transmit(const CaptureRecord& record);
+    SimulationBus::Transmitter* getTransmitter(uint32_t signal_id) const;
+
+    const std::shared_ptr<const CaptureFileReader> _file;
+    // signal and stream type records, read from the chain once
+    const std::vector<uint64_t> _meta_record_offsets;
+    // transmitters by signal id, nullptr for ids without a signal record
+    std::vector<std::shared_ptr<SimulationBus::Transmitter>> _transmitters;
+
+    std::mutex _replay_mutex;
+    uint64_t _offset{0};
+};
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,297 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "simulation_bus_recorder.h"
+
+#include <chrono>
+
+namespace {
+
+constexpr std::chrono::milliseconds idle_recording_period{1};
+
+size_t toPowerOfTwo(size_t value)
+{
+    size_t power_of_two = 1;
+    while (power_of_two < value) {
+        power_of_two <<= 1;
+    }
+    return power_of_two;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace native {
+
+/**
+ * Bounded ring of items for any number of producers and one consumer.
+ * A producer claims a position by compare and swap of the write position and publishes the item
+ * by the sequence of the slot. If the slot of the claimed position has not been read yet, the ring
+ * is full and the producer gives up right away instead of waiting for the consumer.
+ */
+class SimulationBusRecorder::Ring {
+    /**
+     * The sequence tells which position the slot is ready for:
+     * sequence == position means the slot is free to be written for this position,
+     * sequence == position + 1 means the slot holds the item of this position.
+     */
+    struct Slot {
+        std::atomic<size_t> _sequence{0};
+        uint32_t _signal_id{0};
+        data_read_ptr<const IDataSample> _sample;
+        data_read_ptr<const IStreamType> _stream_type;
+    };
+
+public:
+    explicit Ring(size_t capacity) : _slots(toPowerOfTwo(capacity)), _mask(_slots.size() - 1)
+    {
+        for (size_t position = 0; position < _slots.size(); ++position) {
+            _slots[position]._sequence.store(position, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename ITEM_TYPE>
+    void push(uint32_t signal_id, const ITEM_TYPE& item)
+    {
+        auto write_position = _write_position.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& slot = _slots[write_position & _mask];
+            const auto sequence = slot._sequence.load(std::memory_order_acquire);
+            if (sequence == write_position) {
+                if (_write_position.compare_exchange_weak(
+                        write_position, write_position + 1, std::memory_order_relaxed)) {
+                    set(slot, item);
+                    slot._signal_id = signal_id;
+                    slot._sequence.store(write_position + 1, std::memory_order_release);
+                    return;
+                }
+                // on failure another producer claimed the position, the new one is retried
+            }
+            else if (sequence < write_position + 1) {
+                // the slot still holds the item of the previous round
+                _overflow_count.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else {
+                write_position = _write_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(uint32_t& signal_id,
+             data_read_ptr<const IDataSample>& sample,
+             data_read_ptr<const IStreamType>& stream_type)
+    {
+        auto& slot = _slots[_read_position & _mask];
+        if (slot._sequence.load(std::memory_order_acquire) != _read_position + 1) {
+            return false;
+        }
+        signal_id = slot._signal_id;
+        sample = std::move(slot._sample);
+        stream_type = std::move(slot._stream_type);
+        slot._sample.reset();
+        slot._stream_type.reset();
+        slot._sequence.store(_read_position + _slots.size(), std::memory_order_release);
+        ++_read_position;
+        return true;
+    }
+
+    size_t getWritePosition() const
+    {
+        return _write_position.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const
+    {
+        return _slots.size();
+    }
+
+    uint64_t getOverflowCount() const
+    {
+        return _overflow_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    static void set(Slot& slot, const data_read_ptr<const IDataSample>& sample)
+    {
+        slot._sample = sample;
+    }
+
+    static void set(Slot& slot, const data_read_ptr<const IStreamType>& stream_type)
+    {
+        slot._stream_type = stream_type;
+    }
+
+    std::vector<Slot> _slots;
+    const size_t _mask;
+    alignas(64) std::atomic<size_t> _write_position{0};
+    alignas(64) std::atomic<uint64_t> _overflow_count{0};
+    // consumer side only
+    alignas(64) size_t _read_position{0};
+};
+
+/**
+ * Queue of one recorded signal within the transmitter of the signal. It does not hold any item,
+ * but hands all items over to the ring of the recorder. It is never popped.
+ */
+class SimulationBusRecorder::SignalQueue : public DataItemQueueBase<> {
+public:
+    SignalQueue(const std::shared_ptr<Ring>& ring, uint32_t signal_id)
+        : _ring(ring), _signal_id(signal_id)
+    {
+    }
+
+    void push(const data_read_ptr<const IDataSample>& sample) override
+    {
+        _ring->push(_signal_id, sample);
+    }
+
+    void push(const data_read_ptr<const IStreamType>& type) override
+    {
+        _ring->push(_signal_id, type);
+    }
+
+    // the recorder never stalls a lossless writer, items which do not fit are counted as overflow
+    bool tryPush(const data_read_ptr<const IDataSample>& sample) override
+    {
+        push(sample);
+        return true;
+    }
+
+    bool tryPush(const data_read_ptr<const IStreamType>& type) override
+    {
+        push(type);
+        return true;
+    }
+
+    Optional<Timestamp> getFrontTime() override
+    {
+        return {};
+    }
+
+    std::tuple<data_read_ptr<const IDataSample>, data_read_ptr<const IStreamType>> pop() override
+    {
+        return {};
+    }
+
+    size_t capacity() const override
+    {
+        return _ring->capacity();
+    }
+
+    size_t size() const override
+    {
+        return 0;
+    }
+
+    void clear() override
+    {
+    }
+
+    QueueType getQueueType() const override
+    {
+        return QueueType::fixed;
+    }
+
+private:
+    const std::shared_ptr<Ring> _ring;
+    const uint32_t _signal_id;
+};
+
+SimulationBusRecorder::SimulationBusRecorder(std::unique_ptr<CaptureFileWriter> file,
+                                             size_t ring_capacity)
+    : _file(std::move(file)), _ring(std::make_shared<Ring>(ring_capacity))
+{
+    _recording_thread = std::thread([this]() { runRecording(); });
+}
+
+SimulationBusRecorder::~SimulationBusRecorder()
+{
+    _stop = true;
+    if (_recording_thread.joinable()) {
+        _recording_thread.join();
+    }
+    _file->flush();
+}
+
+std::shared_ptr<DataItemQueueBase<>> SimulationBusRecorder::createSignalQueue(
+    const std::string& signal_name)
+{
+    std::lock_guard<std::mutex> lock(_signals_mutex);
+    _signal_names.push_back(signal_name);
+    return std::make_shared<SignalQueue>(_ring, static_cast<uint32_t>(_signal_names.size() - 1));
+}
+
+uint64_t SimulationBusRecorder::getOverflowCount() const
+{
+    return _ring->getOverflowCount() + _file_overflow_count.load(std::memory_order_relaxed);
+}
+
+void SimulationBusRecorder::sync()
+{
+    const auto write_position = _ring->getWritePosition();
+    while (_recorded_count.load(std::memory_order_acquire) < write_position) {
+        std::this_thread::sleep_for(idle_recording_period);
+    }
+}
+
+bool SimulationBusRecorder::record()
+{
+    uint32_t signal_id = 0;
+    data_read_ptr<const IDataSample> sample;
+    data_read_ptr<const IStreamType> stream_type;
+    if (!_ring->pop(signal_id, sample, stream_type)) {
+        return false;
+    }
+
+    // the name of a signal is recorded right before its first item
+    if (signal_id >= _recorded_signal_count) {
+        std::lock_guard<std::mutex> lock(_signals_mutex);
+        while (_recorded_signal_count <= signal_id &&
+               _file->appendSignal(_recorded_signal_count, _signal_names[_recorded_signal_count])) {
+            ++_recorded_signal_count;
+        }
+    }
+
+    const bool recorded = (signal_id < _recorded_signal_count) &&
+                          (sample ? _file->append(signal_id, *sample) :
+                                    _file->append(signal_id, *stream_type));
+    if (!recorded) {
+        _file_overflow_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    _recorded_count.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+void SimulationBusRecorder::runRecording()
+{
+    uint64_t recorded_ring_overflow_count = 0;
+    for (;;) {
+        const bool stop = _stop;
+        if (record()) {
+            continue;
+        }
+
+        // the overflow of the ring is added to the file as well
+        const auto ring_overflow_count = _ring->getOverflowCount();
+        _file->countOverflow(ring_overflow_count - recorded_ring_overflow_count);
+        recorded_ring_overflow_count = ring_overflow_count;
+
+        if (stop) {
+            break;
+        }
+        std::this_thread::sleep_for(idle_recording_period);
+    }
+}
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,101 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "capture_file.h"
+#include "data_item_queue_base.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief Records the traffic of the native simulation bus to a @ref CaptureFileWriter.
+ * The recorder provides a queue per recorded signal, which is added to the transmitter of the
+ * signal like a reader queue. Pushing to such a queue moves the sample (not its data) into a
+ * bounded lock-free ring shared by all signals, which never blocks the transmitting writer: if the
+ * ring is full the item is counted as overflow and dropped. A recording thread drains the ring
+ * and copies the items into the capture file.
+ */
+class SimulationBusRecorder {
+public:
+    /// default number of items the ring between the writers and the recording thread can hold
+    static constexpr size_t default_ring_capacity = 4096;
+
+    /**
+     * @brief CTOR, starts the recording thread
+     *
+     * @param[in] file the capture file to record to
+     * @param[in] ring_capacity number of items the ring can hold (rounded up to a power of two)
+     */
+    explicit SimulationBusRecorder(std::unique_ptr<CaptureFileWriter> file,
+                                   size_t ring_capacity = default_ring_capacity);
+
+    /// DTOR, records all items of the ring, stops the recording thread and flushes the file
+    ~SimulationBusRecorder();
+    SimulationBusRecorder(const SimulationBusRecorder&) = delete;
+    SimulationBusRecorder(SimulationBusRecorder&&) = delete;
+    SimulationBusRecorder& operator=(const SimulationBusRecorder&) = delete;
+    SimulationBusRecorder& operator=(SimulationBusRecorder&&) = delete;
+
+    /**
+     * @brief Creates the queue recording the items of a signal
+     *
+     * @param[in] signal_name name of the signal
+     * @return the queue to be added to the transmitter of the signal
+     */
+    std::shared_ptr<DataItemQueueBase<>> createSignalQueue(const std::string& signal_name);
+
+    /**
+     * @brief Gets the number of items which could not be recorded, either because the ring was
+     * full or because the capture file was full
+     *
+     * @return the overflow count
+     */
+    uint64_t getOverflowCount() const;
+
+    /**
+     * @brief Waits until all items pushed before have been written to the capture file
+     */
+    void sync();
+
+private:
+    class Ring;
+    class SignalQueue;
+
+    bool record();
+    void runRecording();
+
+    std::unique_ptr<CaptureFileWriter> _file;
+    // shared with the signal queues, which may outlive the recorder within a transmitter
+    const std::shared_ptr<Ring> _ring;
+    // written by the recording thread only
+    std::atomic<size_t> _recorded_count{0};
+    std::atomic<uint64_t> _file_overflow_count{0};
+    uint32_t _recorded_signal_count{0};
+
+    std::mutex _signals_mutex;
+    std::vector<std::string> _signal_names;
+
+    std::atomic<bool> _stop{false};
+    std::thread _recording_thread;
+};
+
+} // namespace native
+} // namespace fep3
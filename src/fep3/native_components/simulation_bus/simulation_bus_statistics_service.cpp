@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "simulation_bus_statistics_service.h"
+
+namespace {
+
+Json::Value toJson(const fep3::native::SignalStatistics& statistics)
+{
+    // the rates are averaged over the lifetime of the reader or writer
+    const auto seconds = std::chrono::duration<double>(statistics._lifetime).count();
+
+    Json::Value value;
+    value["signal_name"] = statistics._signal_name;
+    value["queue_capacity"] = static_cast<Json::UInt64>(statistics._queue_capacity);
+    value["samples"] = static_cast<Json::UInt64>(statistics._samples);
+    value["stream_types"] = static_cast<Json::UInt64>(statistics._stream_types);
+    value["bytes"] = static_cast<Json::UInt64>(statistics._bytes);
+    value["drops"] = static_cast<Json::UInt64>(statistics._drops);
+    value["high_water_mark"] = static_cast<Json::UInt64>(statistics._high_water_mark);
+    value["samples_per_second"] =
+        seconds > 0.0 ? static_cast<double>(statistics._samples) / seconds : 0.0;
+    value["bytes_per_second"] =
+        seconds > 0.0 ? static_cast<double>(statistics._bytes) / seconds : 0.0;
+    return value;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace native {
+
+Json::Value RPCSimulationBusStatisticsService::getReaderStatistics()
+{
+    Json::Value readers(Json::arrayValue);
+    for (const auto& statistics: _simulation_bus.getReaderStatistics()) {
+        readers.append(toJson(statistics));
+    }
+    return readers;
+}
+
+Json::Value RPCSimulationBusStatisticsService::getWriterStatistics()
+{
+    Json::Value writers(Json::arrayValue);
+    for (const auto& statistics: _simulation_bus.getWriterStatistics()) {
+        auto writer = toJson(statistics);
+        writer["stalls"] = static_cast<Json::UInt64>(statistics._stalls);
+        writer["rejections"] = static_cast<Json::UInt64>(statistics._rejections);
+        writers.append(writer);
+    }
+    return writers;
+}
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,45 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "simulation_bus.h"
+
+#include <fep3/components/service_bus/rpc/fep_rpc_stubs_service.h>
+#include <fep3/rpc_services/simulation_bus/simulation_bus_statistics_rpc_intf_def.h>
+#include <fep3/rpc_services/simulation_bus/simulation_bus_statistics_service_stub.h>
+
+namespace fep3 {
+namespace native {
+
+/**
+ * @brief RPC service providing the reader and writer counters of a native simulation bus
+ */
+class RPCSimulationBusStatisticsService
+    : public rpc::RPCService<fep3::rpc_stubs::RPCSimulationBusStatisticsServiceStub,
+                             fep3::rpc::IRPCSimulationBusStatisticsDef> {
+public:
+    explicit RPCSimulationBusStatisticsService(const SimulationBus& simulation_bus)
+        : _simulation_bus(simulation_bus)
+    {
+    }
+
+public:
+    Json::Value getReaderStatistics() override;
+    Json::Value getWriterStatistics() override;
+
+private:
+    const SimulationBus& _simulation_bus;
+};
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,165 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "ring_item_converter.h"
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/stream_type.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/// Writes into a std::vector<uint8_t> reusing its memory
+struct VectorRawMemory : public fep3::arya::IRawMemory {
+public:
+    VectorRawMemory(std::vector<uint8_t>& value) : _value(value)
+    {
+    }
+
+    size_t capacity() const override
+    {
+        return _value.capacity();
+    }
+
+    const void* cdata() const override
+    {
+        return _value.data();
+    }
+
+    size_t size() const override
+    {
+        return _value.size();
+    }
+
+    size_t set(const void* data, size_t data_size) override
+    {
+        _value.resize(data_size);
+        if (0 < data_size) {
+            std::memcpy(_value.data(), data, data_size);
+        }
+        return size();
+    }
+
+    size_t resize(size_t data_size) override
+    {
+        _value.resize(data_size);
+        return size();
+    }
+
+private:
+    std::vector<uint8_t>& _value;
+};
+
+/// Sample owning the memory read from the ring, so the payload is not copied again
+class RingItemDataSample : public fep3::base::arya::DataSampleBase {
+public:
+    explicit RingItemDataSample(fep3::shared_memory::RingItem&& item)
+        : DataSampleBase(fep3::Timestamp(item._time), item._counter), _data(std::move(item._data))
+    {
+    }
+
+    size_t getSize() const override
+    {
+        return _data.size();
+    }
+
+    size_t read(fep3::arya::IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(_data.data(), _data.size());
+    }
+
+    size_t write(const fep3::arya::IRawMemory& from_memory) override
+    {
+        const auto data = static_cast<const uint8_t*>(from_memory.cdata());
+        _data.assign(data, data + from_memory.size());
+        return _data.size();
+    }
+
+private:
+    std::vector<uint8_t> _data;
+};
+
+void appendString(std::vector<uint8_t>& data, const std::string& value)
+{
+    data.insert(data.end(), value.begin(), value.end());
+    data.push_back(0);
+}
+
+bool readString(const std::vector<uint8_t>& data, size_t& position, std::string& value)
+{
+    const auto begin = data.begin() + static_cast<std::ptrdiff_t>(position);
+    const auto end = std::find(begin, data.end(), 0);
+    if (end == data.end()) {
+        return false;
+    }
+    value.assign(begin, end);
+    position = static_cast<size_t>(end - data.begin()) + 1;
+    return true;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace shared_memory {
+
+void toRingItem(const IDataSample& sample, RingItem& item)
+{
+    item._type = RingItem::Type::sample;
+    item._time = sample.getTime().count();
+    item._counter = sample.getCounter();
+    VectorRawMemory memory(item._data);
+    sample.read(memory);
+}
+
+void toRingItem(const IStreamType& stream_type, RingItem& item)
+{
+    item._type = RingItem::Type::stream_type;
+    item._time = 0;
+    item._counter = 0;
+    item._data.clear();
+    appendString(item._data, stream_type.getMetaTypeName());
+    for (const auto& property_name: stream_type.getPropertyNames()) {
+        appendString(item._data, property_name);
+        appendString(item._data, stream_type.getProperty(property_name));
+        appendString(item._data, stream_type.getPropertyType(property_name));
+    }
+}
+
+data_read_ptr<const IDataSample> toDataSample(RingItem&& item)
+{
+    return std::make_shared<RingItemDataSample>(std::move(item));
+}
+
+data_read_ptr<const IStreamType> toStreamType(const RingItem& item)
+{
+    size_t position = 0;
+    std::string meta_type_name;
+    if (!readString(item._data, position, meta_type_name)) {
+        return nullptr;
+    }
+
+    auto stream_type = std::make_shared<base::StreamType>(base::StreamMetaType(meta_type_name));
+    std::string name, value, type;
+    while (position < item._data.size()) {
+        if (!readString(item._data, position, name) || !readString(item._data, position, value) ||
+            !readString(item._data, position, type)) {
+            return nullptr;
+        }
+        stream_type->setProperty(name, value, type);
+    }
+    return stream_type;
+}
+
+} // namespace shared_memory
+} // namespace fep3
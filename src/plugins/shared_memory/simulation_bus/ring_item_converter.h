@@ -0,0 +1,59 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "shared_memory_ring.h"
+
+#include <fep3/base/sample/data_sample_intf.h>
+#include <fep3/base/stream_type/stream_type_intf.h>
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * @brief Copies a sample into a ring item
+ *
+ * @param[in] sample the sample to copy
+ * @param[out] item the item to copy to, its memory is reused
+ */
+void toRingItem(const IDataSample& sample, RingItem& item);
+
+/**
+ * @brief Serializes a stream type into a ring item.
+ * The meta type name and the name, value and type of each property are stored as zero
+ * terminated strings.
+ *
+ * @param[in] stream_type the stream type to serialize
+ * @param[out] item the item to serialize to, its memory is reused
+ */
+void toRingItem(const IStreamType& stream_type, RingItem& item);
+
+/**
+ * @brief Creates a sample taking over the memory of a ring item of type sample
+ *
+ * @param[in] item the item to take the memory from
+ * @return the sample
+ */
+data_read_ptr<const IDataSample> toDataSample(RingItem&& item);
+
+/**
+ * @brief Deserializes the stream type of a ring item of type stream type
+ *
+ * @param[in] item the item to deserialize
+ * @return the stream type, nullptr if the item is malformed
+ */
+data_read_ptr<const IStreamType> toStreamType(const RingItem& item);
+
+} // namespace shared_memory
+} // namespace fep3
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "shared_memory_datareader.h"
+
+#include "ring_item_converter.h"
+
+#include <algorithm>
+
+namespace fep3 {
+namespace shared_memory {
+
+ReaderQueue::ReaderQueue(const std::shared_ptr<SharedMemoryRing>& ring, size_t capacity)
+    : _ring(ring), _capacity(capacity > 0 ? capacity : 1), _sequence(ring->getWriteSequence())
+{
+}
+
+size_t ReaderQueue::size() const
+{
+    const auto available_items = _ring->getWriteSequence() - _sequence;
+    const size_t front_item_count = (_front_item._type != RingItem::Type::none) ? 1 : 0;
+    return static_cast<size_t>(std::min<uint64_t>(available_items, _capacity)) + front_item_count;
+}
+
+size_t ReaderQueue::capacity() const
+{
+    return _capacity;
+}
+
+Optional<Timestamp> ReaderQueue::getFrontTime()
+{
+    if (_front_item._type == RingItem::Type::none) {
+        fetchFront();
+    }
+    if (_front_item._type == RingItem::Type::sample) {
+        return Timestamp(_front_item._time);
+    }
+    return {};
+}
+
+std::tuple<data_read_ptr<const IDataSample>, data_read_ptr<const IStreamType>> ReaderQueue::pop()
+{
+    if (_front_item._type == RingItem::Type::none && !fetchFront()) {
+        return {};
+    }
+
+    std::tuple<data_read_ptr<const IDataSample>, data_read_ptr<const IStreamType>> result;
+    if (_front_item._type == RingItem::Type::sample) {
+        std::get<0>(result) = toDataSample(std::move(_front_item));
+    }
+    else if (_front_item._type == RingItem::Type::stream_type) {
+        std::get<1>(result) = toStreamType(_front_item);
+    }
+    _front_item._type = RingItem::Type::none;
+    return result;
+}
+
+bool ReaderQueue::fetchFront()
+{
+    // like a reader queue of the native simulation bus the oldest items exceeding the capacity
+    // are dropped
+    const auto write_sequence = _ring->getWriteSequence();
+    if (write_sequence - _sequence > _capacity) {
+        _sequence = write_sequence - _capacity;
+    }
+    return _ring->read(_sequence, _front_item);
+}
+
+DataReader::DataReader(
+    const std::shared_ptr<ReaderQueue>& reader_queue,
+    const std::weak_ptr<base::SimulationDataAccessCollection<ReaderQueue>>& data_access_collection)
+    : _reader_queue{reader_queue}, _data_access_collection{data_access_collection}
+{
+}
+
+DataReader::~DataReader()
+{
+    // remove sink from data sink collection (if any)
+    reset();
+}
+
+size_t DataReader::size() const
+{
+    return _reader_queue->size();
+}
+
+size_t DataReader::capacity() const
+{
+    return _reader_queue->capacity();
+}
+
+bool DataReader::pop(ISimulationBus::IDataReceiver& onReceive)
+{
+    auto res = _reader_queue->pop();
+    if (!std::get<0>(res) && !std::get<1>(res)) {
+        return false;
+    }
+
+    dispatch<decltype(res)>(res, onReceive);
+
+    return true;
+}
+
+void DataReader::reset(const std::shared_ptr<arya::ISimulationBus::IDataReceiver>& receiver)
+{
+    const auto& data_access_collection = _data_access_collection.lock();
+    // remove the previous receiver (if any)
+    if (_data_access_iterator) {
+        if (data_access_collection) {
+            data_access_collection->remove(_data_access_iterator.value());
+        }
+        _data_access_iterator.reset();
+    }
+
+    if (data_access_collection && receiver) {
+        _data_access_iterator = data_access_collection->add(receiver, _reader_queue);
+    }
+}
+
+Optional<Timestamp> DataReader::getFrontTime() const
+{
+    return _reader_queue->getFrontTime();
+}
+
+} // namespace shared_memory
+} // namespace fep3
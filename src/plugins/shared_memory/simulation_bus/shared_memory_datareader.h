@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "shared_memory_ring.h"
+
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+#include <fep3/components/simulation_bus/simulation_data_access.h>
+
+#include <tuple>
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * @brief Queue view of a reader onto the shared memory ring of a signal.
+ * The reader only receives items written after its creation. If the reader falls behind by more
+ * than its capacity, the oldest items are skipped.
+ * @remark Not threadsafe, the queue must be used from one thread at a time.
+ */
+class ReaderQueue {
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] ring the ring of the signal
+     * @param[in] capacity the max number of items the reader lags behind the writers
+     */
+    ReaderQueue(const std::shared_ptr<SharedMemoryRing>& ring, size_t capacity);
+
+    /**
+     * @brief Gets the number of items which are available to the reader
+     *
+     * @return the number of items
+     */
+    size_t size() const;
+
+    /**
+     * @brief Gets the capacity of the reader
+     *
+     * @return the capacity
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Gets the time of the front item if it is a sample
+     *
+     * @return the time of the front sample, no value if there is no item or it is a stream type
+     */
+    Optional<Timestamp> getFrontTime();
+
+    /**
+     * @brief Pops the front item
+     *
+     * @return {nullptr, nullptr} if there is no item
+     */
+    std::tuple<data_read_ptr<const IDataSample>, data_read_ptr<const IStreamType>> pop();
+
+private:
+    bool fetchFront();
+
+    std::shared_ptr<SharedMemoryRing> _ring;
+    const size_t _capacity;
+    uint64_t _sequence;
+    RingItem _front_item;
+};
+
+/**
+ * @brief Data reader of the shared memory simulation bus
+ */
+class DataReader : public arya::ISimulationBus::IDataReader {
+public:
+    /**
+     * CTOR for a data reader
+     * @param reader_queue The reader queue this data reader shall work on.
+     * @param data_access_collection Weak pointer to the collection of data access.
+     *                               Calls to @ref DataReader::reset will add data access
+     *                               to this collection.
+     */
+    DataReader(const std::shared_ptr<ReaderQueue>& reader_queue,
+               const std::weak_ptr<base::SimulationDataAccessCollection<ReaderQueue>>&
+                   data_access_collection);
+    ~DataReader() override;
+    DataReader(const DataReader&) = delete;
+    DataReader(DataReader&&) = delete;
+    DataReader& operator=(const DataReader&) = delete;
+    DataReader& operator=(DataReader&&) = delete;
+
+    size_t size() const override;
+
+    size_t capacity() const override;
+
+    bool pop(arya::ISimulationBus::IDataReceiver& onReceive) override;
+
+    void reset(const std::shared_ptr<arya::ISimulationBus::IDataReceiver>& receiver = {}) override;
+
+    Optional<Timestamp> getFrontTime() const override;
+
+    template <typename tuple_type>
+    static void dispatch(tuple_type& data, fep3::arya::ISimulationBus::IDataReceiver& receiver)
+    {
+        auto data_sample = std::get<0>(data);
+        if (data_sample) {
+            receiver(data_sample);
+        }
+
+        auto stream_type = std::get<1>(data);
+        if (stream_type) {
+            receiver(stream_type);
+        }
+    }
+
+private:
+    std::shared_ptr<ReaderQueue> _reader_queue;
+    std::weak_ptr<base::SimulationDataAccessCollection<ReaderQueue>> _data_access_collection;
+    Optional<base::SimulationDataAccessCollection<ReaderQueue>::const_iterator>
+        _data_access_iterator;
+};
+
+} // namespace shared_memory
+} // namespace fep3
@@ -0,0 +1,90 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "shared_memory_datawriter.h"
+
+#include "ring_item_converter.h"
+
+namespace fep3 {
+namespace shared_memory {
+
+DataWriter::DataWriter(const std::string& name,
+                       const std::shared_ptr<SharedMemoryRing>& ring,
+                       const std::shared_ptr<SharedMemoryNotification>& notification,
+                       size_t transmit_buffer_capacity)
+    : _name(name),
+      _ring(ring),
+      _notification(notification),
+      _transmit_buffer(transmit_buffer_capacity > 0 ? transmit_buffer_capacity : 1)
+{
+    for (auto& item: _transmit_buffer) {
+        item._data.reserve(_ring->getSlotSize());
+    }
+}
+
+fep3::Result DataWriter::write(const IDataSample& data_sample)
+{
+    if (data_sample.getSize() > _ring->getSlotSize()) {
+        RETURN_ERROR_DESCRIPTION(ERR_OUT_OF_RANGE,
+                                 "Writing a sample of %zu bytes to writer '%s' failed. The shared "
+                                 "memory slot size is %zu bytes",
+                                 data_sample.getSize(),
+                                 _name.c_str(),
+                                 _ring->getSlotSize());
+    }
+    toRingItem(data_sample, pushItem());
+    return {};
+}
+
+fep3::Result DataWriter::write(const IStreamType& stream_type)
+{
+    RingItem item;
+    toRingItem(stream_type, item);
+    if (item._data.size() > _ring->getSlotSize()) {
+        RETURN_ERROR_DESCRIPTION(ERR_OUT_OF_RANGE,
+                                 "Writing a stream type of %zu bytes to writer '%s' failed. The "
+                                 "shared memory slot size is %zu bytes",
+                                 item._data.size(),
+                                 _name.c_str(),
+                                 _ring->getSlotSize());
+    }
+    std::swap(pushItem(), item);
+    return {};
+}
+
+fep3::Result DataWriter::transmit()
+{
+    if (0 == _item_count) {
+        return {};
+    }
+    _ring->write(_transmit_buffer, _first_item, _item_count);
+    _first_item = 0;
+    _item_count = 0;
+    _notification->notify();
+    return {};
+}
+
+RingItem& DataWriter::pushItem()
+{
+    const auto index = (_first_item + _item_count) % _transmit_buffer.size();
+    if (_item_count == _transmit_buffer.size()) {
+        // drop the oldest item
+        _first_item = (_first_item + 1) % _transmit_buffer.size();
+    }
+    else {
+        ++_item_count;
+    }
+    return _transmit_buffer[index];
+}
+
+} // namespace shared_memory
+} // namespace fep3
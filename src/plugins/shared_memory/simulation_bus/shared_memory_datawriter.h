@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include "shared_memory_ring.h"
+
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * @brief Data writer of the shared memory simulation bus.
+ * Written items are buffered in preallocated ring items until @ref transmit copies them into the
+ * shared memory ring of the signal at once and wakes up the readers of all processes.
+ */
+class DataWriter : public arya::ISimulationBus::IDataWriter {
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param[in] name the signal name
+     * @param[in] ring the ring of the signal
+     * @param[in] notification the notification of the domain
+     * @param[in] transmit_buffer_capacity the capacity of the transmit buffer
+     */
+    DataWriter(const std::string& name,
+               const std::shared_ptr<SharedMemoryRing>& ring,
+               const std::shared_ptr<SharedMemoryNotification>& notification,
+               size_t transmit_buffer_capacity);
+    ~DataWriter() override = default;
+    DataWriter(const DataWriter&) = delete;
+    DataWriter(DataWriter&&) = delete;
+    DataWriter& operator=(const DataWriter&) = delete;
+    DataWriter& operator=(DataWriter&&) = delete;
+
+    fep3::Result write(const IDataSample& data_sample) override;
+    fep3::Result write(const IStreamType& stream_type) override;
+    fep3::Result transmit() override;
+
+private:
+    RingItem& pushItem();
+
+    const std::string _name;
+    std::shared_ptr<SharedMemoryRing> _ring;
+    std::shared_ptr<SharedMemoryNotification> _notification;
+    // circular transmit buffer dropping the oldest item if full
+    std::vector<RingItem> _transmit_buffer;
+    size_t _first_item{0};
+    size_t _item_count{0};
+};
+
+} // namespace shared_memory
+} // namespace fep3
@@ -0,0 +1,519 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "shared_memory_ring.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <thread>
+
+namespace {
+
+constexpr uint32_t segment_magic = 0x46455033; // "FEP3"
+constexpr uint32_t segment_version = 2;
+constexpr size_t cache_line_size = 64;
+
+constexpr uint32_t state_initialized = 1;
+// set by the instance unlinking the segment, attaching instances have to create a new one then
+constexpr uint32_t state_unlinked = 2;
+
+constexpr size_t alignToCacheLine(size_t size)
+{
+    return (size + cache_line_size - 1) & ~(cache_line_size - 1);
+}
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory requires address free 64 bit atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "shared memory requires address free 32 bit atomics");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "the futex word has to be a plain 32 bit integer");
+
+/// Process shared mutex which recovers if the owning process died
+class RobustMutexLock {
+public:
+    explicit RobustMutexLock(pthread_mutex_t& mutex) : _mutex(mutex)
+    {
+        if (EOWNERDEAD == ::pthread_mutex_lock(&_mutex)) {
+            // the state guarded by the mutex is repaired by its users, e.g. the slot the dead
+            // writer was writing to keeps an odd lock and is skipped by readers
+            ::pthread_mutex_consistent(&_mutex);
+        }
+    }
+    ~RobustMutexLock()
+    {
+        ::pthread_mutex_unlock(&_mutex);
+    }
+    RobustMutexLock(const RobustMutexLock&) = delete;
+    RobustMutexLock& operator=(const RobustMutexLock&) = delete;
+
+private:
+    pthread_mutex_t& _mutex;
+};
+
+void initializeRobustMutex(pthread_mutex_t& mutex)
+{
+    pthread_mutexattr_t attributes;
+    ::pthread_mutexattr_init(&attributes);
+    ::pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    ::pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+    ::pthread_mutex_init(&mutex, &attributes);
+    ::pthread_mutexattr_destroy(&attributes);
+}
+
+bool isProcessAlive(pid_t pid)
+{
+    return 0 == ::kill(pid, 0) || EPERM == errno;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * Header of a segment. The attached instances are counted per process, so the entries of crashed
+ * processes can be removed by the next process attaching or detaching.
+ */
+struct SharedMemorySegment::Header {
+    struct Attacher {
+        pid_t _pid;
+        uint32_t _count;
+    };
+
+    std::atomic<uint32_t> _state;
+    uint32_t _magic;
+    uint32_t _version;
+    uint64_t _payload_size;
+    pthread_mutex_t _attach_mutex;
+    // guarded by the attach mutex, an entry with pid 0 is free
+    Attacher _attachers[max_attached_processes];
+
+    bool attach(pid_t pid)
+    {
+        Attacher* free_attacher = nullptr;
+        for (auto& attacher: _attachers) {
+            if (attacher._pid == pid) {
+                ++attacher._count;
+                return true;
+            }
+            if (0 == attacher._pid && !free_attacher) {
+                free_attacher = &attacher;
+            }
+        }
+        if (!free_attacher) {
+            return false;
+        }
+        *free_attacher = {pid, 1};
+        return true;
+    }
+
+    void detach(pid_t pid)
+    {
+        for (auto& attacher: _attachers) {
+            if (attacher._pid == pid && 0 == --attacher._count) {
+                attacher = {0, 0};
+            }
+        }
+    }
+
+    /// removes the processes which terminated without detaching, @return whether any is left
+    bool removeDeadAttachers()
+    {
+        bool any_attached = false;
+        for (auto& attacher: _attachers) {
+            if (0 != attacher._pid && !isProcessAlive(attacher._pid)) {
+                attacher = {0, 0};
+            }
+            any_attached = any_attached || 0 != attacher._pid;
+        }
+        return any_attached;
+    }
+};
+
+size_t SharedMemorySegment::getHeaderSize()
+{
+    return alignToCacheLine(sizeof(Header));
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::open(const std::string& name,
+                                                               size_t payload_size,
+                                                               const Initializer& initializer,
+                                                               std::chrono::milliseconds timeout)
+{
+    const std::string shm_name = "/" + name;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    do {
+        // try to create the segment first, the winner initializes it
+        int fd = ::shm_open(shm_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (-1 != fd) {
+            const size_t mapping_size = getHeaderSize() + payload_size;
+            if (0 != ::ftruncate(fd, static_cast<off_t>(mapping_size))) {
+                ::close(fd);
+                ::shm_unlink(shm_name.c_str());
+                return nullptr;
+            }
+            void* mapping =
+                ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (MAP_FAILED == mapping) {
+                ::shm_unlink(shm_name.c_str());
+                return nullptr;
+            }
+
+            // ftruncate zero fills the segment, so the header is in its initial state
+            auto header = new (mapping) Header();
+            header->_magic = segment_magic;
+            header->_version = segment_version;
+            header->_payload_size = payload_size;
+            initializeRobustMutex(header->_attach_mutex);
+            header->attach(::getpid());
+            if (initializer) {
+                initializer(static_cast<uint8_t*>(mapping) + getHeaderSize());
+            }
+            header->_state.store(state_initialized, std::memory_order_release);
+
+            return std::unique_ptr<SharedMemorySegment>(
+                new SharedMemorySegment(name, mapping, mapping_size));
+        }
+        if (EEXIST != errno) {
+            return nullptr;
+        }
+
+        // the segment exists, so attach to it once the creator has sized it
+        fd = ::shm_open(shm_name.c_str(), O_RDWR, 0600);
+        if (-1 == fd) {
+            // the segment has been unlinked meanwhile, retry to create it
+            continue;
+        }
+        struct stat segment_stat;
+        if (0 != ::fstat(fd, &segment_stat) ||
+            static_cast<size_t>(segment_stat.st_size) < getHeaderSize()) {
+            ::close(fd);
+            std::this_thread::yield();
+            continue;
+        }
+        const auto mapping_size = static_cast<size_t>(segment_stat.st_size);
+        void* mapping = ::mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (MAP_FAILED == mapping) {
+            return nullptr;
+        }
+
+        auto header = static_cast<Header*>(mapping);
+        while (header->_state.load(std::memory_order_acquire) != state_initialized &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        if (header->_state.load(std::memory_order_acquire) != state_initialized ||
+            header->_magic != segment_magic || header->_version != segment_version ||
+            getHeaderSize() + header->_payload_size > mapping_size) {
+            ::munmap(mapping, mapping_size);
+            return nullptr;
+        }
+
+        bool attached = false;
+        bool unlinked = false;
+        {
+            RobustMutexLock lock(header->_attach_mutex);
+            if (header->_state.load(std::memory_order_acquire) != state_initialized) {
+                // the last detaching instance has just unlinked the segment
+                unlinked = true;
+            }
+            else if (!header->removeDeadAttachers()) {
+                // all processes attached to the segment crashed, so it is stale and recreated,
+                // as its content and dimensions are not reliable anymore
+                header->_state.store(state_unlinked, std::memory_order_release);
+                ::shm_unlink(shm_name.c_str());
+                unlinked = true;
+            }
+            else {
+                attached = header->attach(::getpid());
+            }
+        }
+        if (attached) {
+            return std::unique_ptr<SharedMemorySegment>(
+                new SharedMemorySegment(name, mapping, mapping_size));
+        }
+        ::munmap(mapping, mapping_size);
+        if (!unlinked) {
+            return nullptr;
+        }
+        // retry to create the segment
+        std::this_thread::yield();
+    } while (std::chrono::steady_clock::now() < deadline);
+
+    return nullptr;
+}
+
+SharedMemorySegment::SharedMemorySegment(std::string name, void* mapping, size_t mapping_size)
+    : _name(std::move(name)), _mapping(mapping), _mapping_size(mapping_size)
+{
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    auto header = static_cast<Header*>(_mapping);
+    {
+        RobustMutexLock lock(header->_attach_mutex);
+        header->detach(::getpid());
+        if (!header->removeDeadAttachers()) {
+            header->_state.store(state_unlinked, std::memory_order_release);
+            ::shm_unlink(("/" + _name).c_str());
+        }
+    }
+    ::munmap(_mapping, _mapping_size);
+}
+
+void* SharedMemorySegment::getPayload() const
+{
+    return static_cast<uint8_t*>(_mapping) + getHeaderSize();
+}
+
+size_t SharedMemorySegment::getPayloadSize() const
+{
+    return static_cast<const Header*>(_mapping)->_payload_size;
+}
+
+struct SharedMemoryRing::Header {
+    uint64_t _slot_count;
+    uint64_t _slot_size;
+    pthread_mutex_t _writer_mutex;
+    alignas(cache_line_size) std::atomic<uint64_t> _write_sequence;
+};
+
+/**
+ * Slot of the ring. The lock is 2 * sequence + 1 while the item of the sequence is written and
+ * 2 * sequence + 2 once it has been written. All members are accessed atomically, as readers
+ * access them concurrently to writers and validate them afterwards by the lock.
+ */
+struct SharedMemoryRing::Slot {
+    std::atomic<uint64_t> _lock;
+    std::atomic<uint32_t> _type;
+    std::atomic<uint32_t> _counter;
+    std::atomic<int64_t> _time;
+    std::atomic<uint64_t> _size;
+};
+
+size_t SharedMemoryRing::getHeaderSize()
+{
+    return alignToCacheLine(sizeof(Header));
+}
+
+size_t SharedMemoryRing::getSlotStride(size_t slot_size)
+{
+    return alignToCacheLine(sizeof(Slot) + slot_size);
+}
+
+size_t SharedMemoryRing::getPayloadSize(size_t slot_count, size_t slot_size)
+{
+    return getHeaderSize() + slot_count * getSlotStride(slot_size);
+}
+
+void SharedMemoryRing::initialize(void* payload, size_t slot_count, size_t slot_size)
+{
+    auto header = new (payload) Header();
+    header->_slot_count = slot_count;
+    header->_slot_size = slot_size;
+    header->_write_sequence.store(0, std::memory_order_relaxed);
+    initializeRobustMutex(header->_writer_mutex);
+
+    auto slots = static_cast<uint8_t*>(payload) + getHeaderSize();
+    for (size_t index = 0; index < slot_count; ++index) {
+        new (slots + index * getSlotStride(slot_size)) Slot();
+    }
+}
+
+SharedMemoryRing::SharedMemoryRing(std::unique_ptr<SharedMemorySegment> segment)
+    : _segment(std::move(segment)),
+      _header(static_cast<Header*>(_segment->getPayload())),
+      _slots(static_cast<uint8_t*>(_segment->getPayload()) + getHeaderSize()),
+      _slot_stride(getSlotStride(_header->_slot_size))
+{
+}
+
+bool SharedMemoryRing::isValid() const
+{
+    return 0 < _header->_slot_count &&
+           getPayloadSize(_header->_slot_count, _header->_slot_size) <=
+               _segment->getPayloadSize();
+}
+
+size_t SharedMemoryRing::getSlotCount() const
+{
+    return _header->_slot_count;
+}
+
+size_t SharedMemoryRing::getSlotSize() const
+{
+    return _header->_slot_size;
+}
+
+uint64_t SharedMemoryRing::getWriteSequence() const
+{
+    return _header->_write_sequence.load(std::memory_order_acquire);
+}
+
+SharedMemoryRing::Slot& SharedMemoryRing::getSlot(uint64_t sequence) const
+{
+    return *reinterpret_cast<Slot*>(_slots + (sequence % _header->_slot_count) * _slot_stride);
+}
+
+size_t SharedMemoryRing::write(const std::vector<RingItem>& items, size_t first, size_t count)
+{
+    size_t written_items = 0;
+    RobustMutexLock lock(_header->_writer_mutex);
+    auto sequence = _header->_write_sequence.load(std::memory_order_relaxed);
+    for (size_t index = 0; index < count; ++index) {
+        const auto& item = items[(first + index) % items.size()];
+        if (item._data.size() > _header->_slot_size) {
+            continue;
+        }
+
+        auto& slot = getSlot(sequence);
+        slot._lock.store(2 * sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot._type.store(static_cast<uint32_t>(item._type), std::memory_order_relaxed);
+        slot._counter.store(item._counter, std::memory_order_relaxed);
+        slot._time.store(item._time, std::memory_order_relaxed);
+        slot._size.store(item._data.size(), std::memory_order_relaxed);
+        if (!item._data.empty()) {
+            std::memcpy(reinterpret_cast<uint8_t*>(&slot) + sizeof(Slot),
+                        item._data.data(),
+                        item._data.size());
+        }
+
+        slot._lock.store(2 * sequence + 2, std::memory_order_release);
+        ++sequence;
+        _header->_write_sequence.store(sequence, std::memory_order_release);
+        ++written_items;
+    }
+    return written_items;
+}
+
+bool SharedMemoryRing::read(uint64_t& sequence, RingItem& item) const
+{
+    // the slot is copied into a local item which is handed out only after the sequence lock has
+    // been validated, so the caller never gets a torn item; the caller's buffer is reused
+    RingItem read_item;
+    read_item._data.swap(item._data);
+    item._type = RingItem::Type::none;
+
+    const uint64_t slot_count = _header->_slot_count;
+    for (;;) {
+        const auto write_sequence = _header->_write_sequence.load(std::memory_order_acquire);
+        if (sequence >= write_sequence) {
+            item._data.swap(read_item._data);
+            item._data.clear();
+            return false;
+        }
+        if (write_sequence - sequence > slot_count) {
+            // the items up to here have already been overwritten
+            sequence = write_sequence - slot_count;
+        }
+
+        const auto& slot = getSlot(sequence);
+        const uint64_t expected_lock = 2 * sequence + 2;
+        if (slot._lock.load(std::memory_order_acquire) != expected_lock) {
+            // the item is just being overwritten
+            ++sequence;
+            continue;
+        }
+
+        read_item._type = static_cast<RingItem::Type>(slot._type.load(std::memory_order_relaxed));
+        read_item._counter = slot._counter.load(std::memory_order_relaxed);
+        read_item._time = slot._time.load(std::memory_order_relaxed);
+        const auto size = slot._size.load(std::memory_order_relaxed);
+        const auto payload = reinterpret_cast<const uint8_t*>(&slot) + sizeof(Slot);
+        read_item._data.assign(payload, payload + std::min<uint64_t>(size, _header->_slot_size));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot._lock.load(std::memory_order_relaxed) != expected_lock) {
+            // the item has been overwritten while being copied
+            ++sequence;
+            continue;
+        }
+        ++sequence;
+        item = std::move(read_item);
+        return true;
+    }
+}
+
+struct SharedMemoryNotification::Header {
+    std::atomic<uint32_t> _count;
+    std::atomic<uint32_t> _waiters;
+};
+
+size_t SharedMemoryNotification::getPayloadSize()
+{
+    return sizeof(Header);
+}
+
+void SharedMemoryNotification::initialize(void* payload)
+{
+    new (payload) Header();
+}
+
+SharedMemoryNotification::SharedMemoryNotification(std::unique_ptr<SharedMemorySegment> segment)
+    : _segment(std::move(segment)), _header(static_cast<Header*>(_segment->getPayload()))
+{
+}
+
+uint32_t SharedMemoryNotification::getCount() const
+{
+    return _header->_count.load(std::memory_order_seq_cst);
+}
+
+void SharedMemoryNotification::notify()
+{
+    _header->_count.fetch_add(1, std::memory_order_seq_cst);
+    // the syscall is only done if any thread of any process is receiving
+    if (0 < _header->_waiters.load(std::memory_order_seq_cst)) {
+        ::syscall(SYS_futex, &_header->_count, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+}
+
+void SharedMemoryNotification::addWaiter()
+{
+    _header->_waiters.fetch_add(1, std::memory_order_seq_cst);
+}
+
+void SharedMemoryNotification::removeWaiter()
+{
+    _header->_waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+void SharedMemoryNotification::wait(uint32_t count, std::chrono::nanoseconds timeout) const
+{
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    struct timespec relative_timeout;
+    relative_timeout.tv_sec = static_cast<time_t>(seconds.count());
+    relative_timeout.tv_nsec = static_cast<long>((timeout - seconds).count());
+    // returns immediately if the count has changed since it has been observed
+    ::syscall(SYS_futex, &_header->_count, FUTEX_WAIT, count, &relative_timeout, nullptr, 0);
+}
+
+} // namespace shared_memory
+} // namespace fep3
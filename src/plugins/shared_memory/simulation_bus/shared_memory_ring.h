@@ -0,0 +1,276 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * @brief Named POSIX shared memory segment which is shared by all processes opening the same name.
+ * The first process creates and initializes the segment, all others attach to it. The segment is
+ * unlinked when the last process detaches.
+ * The attached processes are registered by their pid within the segment, so processes which
+ * crashed without detaching are removed by the next process attaching or detaching. A segment
+ * whose attached processes all crashed is unlinked and recreated on the next open.
+ *
+ * @remark Processes are considered alive as long as their pid exists, so all processes sharing a
+ * segment have to run within the same pid namespace. A segment left behind by a crash without any
+ * process opening it again may be removed manually from /dev/shm.
+ */
+class SharedMemorySegment {
+public:
+    /// max number of processes attached to a segment at the same time
+    static constexpr size_t max_attached_processes = 64;
+
+    /// initializes the payload of a newly created segment before it is visible to other processes
+    using Initializer = std::function<void(void* payload)>;
+
+    /**
+     * @brief Creates the segment or attaches to an existing one with the same name
+     *
+     * @param[in] name name of the segment (without leading slash)
+     * @param[in] payload_size size of the payload in bytes if the segment is created
+     * @param[in] initializer initializer of the payload if the segment is created
+     * @param[in] timeout time to wait for a concurrently created segment to be initialized
+     * @return the segment, nullptr if the segment could neither be created nor attached to or
+     *         @ref max_attached_processes are attached already
+     */
+    static std::unique_ptr<SharedMemorySegment> open(const std::string& name,
+                                                     size_t payload_size,
+                                                     const Initializer& initializer,
+                                                     std::chrono::milliseconds timeout);
+
+    /// DTOR, detaches from the segment and unlinks it if this was the last attached instance
+    ~SharedMemorySegment();
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment(SharedMemorySegment&&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(SharedMemorySegment&&) = delete;
+
+    /**
+     * @brief Gets the payload of the segment
+     *
+     * @return pointer to the payload
+     */
+    void* getPayload() const;
+
+    /**
+     * @brief Gets the payload size of the segment as set by the creating process
+     *
+     * @return the payload size in bytes
+     */
+    size_t getPayloadSize() const;
+
+private:
+    struct Header;
+    static size_t getHeaderSize();
+    SharedMemorySegment(std::string name, void* mapping, size_t mapping_size);
+
+    const std::string _name;
+    void* const _mapping;
+    const size_t _mapping_size;
+};
+
+/**
+ * @brief Item stored in a slot of a @ref SharedMemoryRing
+ */
+struct RingItem {
+    /// type of the item
+    enum class Type : uint32_t {
+        none = 0,
+        sample = 1,
+        stream_type = 2
+    };
+
+    /// type of the item
+    Type _type{Type::none};
+    /// time of the sample
+    int64_t _time{0};
+    /// counter of the sample
+    uint32_t _counter{0};
+    /// payload, i.e. the sample data or the serialized stream type
+    std::vector<uint8_t> _data;
+};
+
+/**
+ * @brief Ring buffer of items within a @ref SharedMemorySegment for one signal.
+ * Any number of writers (of any process) serialize on a process shared mutex and overwrite the
+ * oldest slot. Readers do not take any lock and do not hold any state within the segment: each
+ * reader keeps its own read sequence and copies the items out of the slots, guarded by a
+ * per slot sequence lock. Items overwritten before they have been copied are skipped, so a slow
+ * reader loses the oldest items like a reader queue of the native simulation bus.
+ */
+class SharedMemoryRing {
+public:
+    /**
+     * @brief Gets the payload size a segment needs for a ring of the given dimensions
+     *
+     * @param[in] slot_count number of slots
+     * @param[in] slot_size max size of an item in bytes
+     * @return the payload size in bytes
+     */
+    static size_t getPayloadSize(size_t slot_count, size_t slot_size);
+
+    /**
+     * @brief Initializes a ring within the payload of a newly created segment
+     *
+     * @param[in] payload the payload of the segment
+     * @param[in] slot_count number of slots
+     * @param[in] slot_size max size of an item in bytes
+     */
+    static void initialize(void* payload, size_t slot_count, size_t slot_size);
+
+    /**
+     * @brief CTOR
+     *
+     * @param[in] segment the segment holding a ring created by @ref initialize
+     */
+    explicit SharedMemoryRing(std::unique_ptr<SharedMemorySegment> segment);
+
+    /**
+     * @brief Checks whether the segment holds a valid ring
+     *
+     * @return @c true if valid, @c false otherwise
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Gets the number of slots
+     *
+     * @return the number of slots
+     */
+    size_t getSlotCount() const;
+
+    /**
+     * @brief Gets the max size of an item
+     *
+     * @return the max size of an item in bytes
+     */
+    size_t getSlotSize() const;
+
+    /**
+     * @brief Gets the sequence the next item will be written with
+     *
+     * @return the write sequence
+     */
+    uint64_t getWriteSequence() const;
+
+    /**
+     * @brief Writes items to the ring under the writer lock
+     *
+     * @param[in] items the items to be written
+     * @param[in] first index of the first item to be written (items are read circularly)
+     * @param[in] count number of items to be written
+     * @return number of items written, items larger than the slot size are skipped
+     */
+    size_t write(const std::vector<RingItem>& items, size_t first, size_t count);
+
+    /**
+     * @brief Reads the item at @p sequence and advances @p sequence behind it.
+     * Items which have been overwritten meanwhile are skipped.
+     *
+     * @param[in,out] sequence the sequence of the item to read
+     * @param[out] item the read item, of type @ref RingItem::Type::none if no item has been read
+     * @return @c true if an item has been read, @c false if there is no item at @p sequence yet
+     */
+    bool read(uint64_t& sequence, RingItem& item) const;
+
+private:
+    struct Header;
+    struct Slot;
+    static size_t getHeaderSize();
+    static size_t getSlotStride(size_t slot_size);
+    Slot& getSlot(uint64_t sequence) const;
+
+    std::unique_ptr<SharedMemorySegment> _segment;
+    Header* _header;
+    uint8_t* _slots;
+    size_t _slot_stride;
+};
+
+/**
+ * @brief Futex based notification within a @ref SharedMemorySegment shared by all writers and
+ * readers of one domain. Every transmission increments the futex word, waiting reception threads
+ * of all processes are woken up.
+ */
+class SharedMemoryNotification {
+public:
+    /**
+     * @brief Gets the payload size a segment needs for the notification
+     *
+     * @return the payload size in bytes
+     */
+    static size_t getPayloadSize();
+
+    /**
+     * @brief Initializes a notification within the payload of a newly created segment
+     *
+     * @param[in] payload the payload of the segment
+     */
+    static void initialize(void* payload);
+
+    /**
+     * @brief CTOR
+     *
+     * @param[in] segment the segment holding a notification created by @ref initialize
+     */
+    explicit SharedMemoryNotification(std::unique_ptr<SharedMemorySegment> segment);
+
+    /**
+     * @brief Gets the current notification count, to be passed to @ref wait
+     *
+     * @return the current notification count
+     */
+    uint32_t getCount() const;
+
+    /**
+     * @brief Wakes up all waiting threads if there are any
+     */
+    void notify();
+
+    /**
+     * @brief Registers the calling thread as waiter, must be called once before calling @ref wait
+     */
+    void addWaiter();
+
+    /**
+     * @brief Unregisters the calling thread as waiter
+     */
+    void removeWaiter();
+
+    /**
+     * @brief Waits until the notification count differs from @p count or the timeout expires
+     *
+     * @param[in] count the notification count observed before checking for data
+     * @param[in] timeout the max time to wait
+     */
+    void wait(uint32_t count, std::chrono::nanoseconds timeout) const;
+
+private:
+    struct Header;
+    std::unique_ptr<SharedMemorySegment> _segment;
+    Header* _header;
+};
+
+} // namespace shared_memory
+} // namespace fep3
@@ -0,0 +1,473 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include "shared_memory_simulation_bus.h"
+
+#include "ring_item_converter.h"
+#include "shared_memory_datareader.h"
+#include "shared_memory_datawriter.h"
+
+#include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/components/configuration/configuration_service_intf.h>
+#include <fep3/components/logging/logging_service_intf.h>
+
+#include <a_util/strings.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace {
+
+constexpr std::chrono::milliseconds segment_open_timeout{1000};
+constexpr std::chrono::milliseconds reception_wait_timeout{100};
+
+/// Gets the name of the segment shared by all participants of the domain
+std::string getDomainSegmentName(int32_t domain)
+{
+    return "fep3_simbus_" + std::to_string(domain);
+}
+
+/// Gets the name of the segment of a signal, characters not allowed in a name are escaped
+std::string getSignalSegmentName(int32_t domain, const std::string& signal_name)
+{
+    std::string segment_name = getDomainSegmentName(domain) + ".";
+    for (const auto character: signal_name) {
+        if (std::isalnum(static_cast<unsigned char>(character)) || '_' == character) {
+            segment_name.push_back(character);
+        }
+        else {
+            segment_name +=
+                a_util::strings::format("-%02x", static_cast<unsigned char>(character));
+        }
+    }
+    return segment_name;
+}
+
+size_t getMaxByteSize(const fep3::IStreamType& stream_type)
+{
+    const auto max_byte_size_prop =
+        stream_type.getProperty(fep3::base::arya::meta_type_prop_name_max_byte_size);
+    if (!max_byte_size_prop.empty()) {
+        try {
+            return std::stoul(max_byte_size_prop);
+        }
+        catch (const std::exception&) {
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+namespace fep3 {
+namespace shared_memory {
+
+class SharedMemorySimulationBus::Impl {
+public:
+    Impl(SharedMemorySimulationBusConfiguration& configuration)
+        : _data_access_collection(
+              std::make_shared<base::SimulationDataAccessCollection<ReaderQueue>>()),
+          _configuration(configuration)
+    {
+        using namespace fep3::base::arya;
+        _supported_meta_types.emplace_back(meta_type_plain);
+        _supported_meta_types.emplace_back(meta_type_plain_array);
+        _supported_meta_types.emplace_back(meta_type_string);
+        _supported_meta_types.emplace_back(meta_type_video);
+        _supported_meta_types.emplace_back(meta_type_audio);
+        _supported_meta_types.emplace_back(meta_type_raw);
+        _supported_meta_types.emplace_back(meta_type_ddl);
+    }
+
+    bool isSupported(const IStreamType& stream_type) const
+    {
+        return std::find(_supported_meta_types.begin(), _supported_meta_types.end(), stream_type) !=
+               _supported_meta_types.end();
+    }
+
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           const IStreamType& stream_type,
+                                           size_t queue_capacity)
+    {
+        return getReader(name, queue_capacity, getRequiredSlotSize(stream_type));
+    }
+
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           size_t queue_capacity,
+                                           size_t required_slot_size = 0)
+    {
+        if (_registered_readers.find(name) != _registered_readers.end()) {
+            return nullptr;
+        }
+        const auto ring = getRing(name, required_slot_size);
+        if (!ring) {
+            return nullptr;
+        }
+        _registered_readers.emplace(name);
+
+        return std::make_unique<DataReader>(std::make_shared<ReaderQueue>(ring, queue_capacity),
+                                            _data_access_collection);
+    }
+
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           const IStreamType& stream_type,
+                                           size_t queue_capacity)
+    {
+        return getWriter(name, queue_capacity, getRequiredSlotSize(stream_type));
+    }
+
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           size_t queue_capacity,
+                                           size_t required_slot_size = 0)
+    {
+        if (_registered_writers.find(name) != _registered_writers.end()) {
+            return nullptr;
+        }
+        const auto notification = getNotification();
+        const auto ring = getRing(name, required_slot_size);
+        if (!notification || !ring) {
+            return nullptr;
+        }
+        _registered_writers.emplace(name);
+
+        return std::make_unique<DataWriter>(name, ring, notification, queue_capacity);
+    }
+
+    void startBlockingReception(const std::function<void()>& reception_preparation_done_callback)
+    {
+        // RAII ensuring invocation of callback exactly once (even in case exception is thrown)
+        std::unique_ptr<bool, std::function<void(bool*)>>
+            reception_preparation_done_callback_caller(
+                nullptr, [reception_preparation_done_callback](bool* p) {
+                    reception_preparation_done_callback();
+                    delete p;
+                });
+        if (reception_preparation_done_callback) {
+            reception_preparation_done_callback_caller.reset(new bool);
+        }
+
+        // start the reception only if there are any data access entries in the collection
+        if (0 == _data_access_collection->size()) {
+            return;
+        }
+        const auto notification = getNotification();
+        if (!notification) {
+            return;
+        }
+
+        const auto& data_access_collection = *_data_access_collection.get();
+        std::unique_lock<std::mutex> lock(_reception_mutex);
+        notification->addWaiter();
+
+        // the Simulation Bus is now prepared for the reception of data and for a call
+        // to stopBlockingReception
+        reception_preparation_done_callback_caller.reset();
+
+        while (!_stop_reception) {
+            // the count is observed before draining, so a transmit during the draining lets the
+            // wait return immediately
+            const auto notification_count = notification->getCount();
+            for (auto data_access_iterator = data_access_collection.cbegin();
+                 data_access_iterator != data_access_collection.cend();
+                 ++data_access_iterator) {
+                auto& reader_queue = *data_access_iterator->_item_queue;
+                while (0 < reader_queue.size()) {
+                    auto res = reader_queue.pop();
+                    DataReader::dispatch<decltype(res)>(res,
+                                                        *data_access_iterator->_receiver.get());
+                }
+            }
+            if (!_stop_reception) {
+                notification->wait(notification_count, reception_wait_timeout);
+            }
+        }
+        notification->removeWaiter();
+    }
+
+    void stopBlockingReception()
+    {
+        _stop_reception = true;
+        if (_notification) {
+            _notification->notify();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(_reception_mutex);
+            _stop_reception = false;
+        }
+    }
+
+    fep3::Result reset()
+    {
+        _registered_readers.clear();
+        _registered_writers.clear();
+        _data_access_collection->clear();
+        _rings.clear();
+        _notification.reset();
+
+        return {};
+    }
+
+    std::shared_ptr<ILogger> _logger;
+
+private:
+    size_t getRequiredSlotSize(const IStreamType& stream_type) const
+    {
+        // the slot has to be able to hold the stream type itself
+        RingItem stream_type_item;
+        toRingItem(stream_type, stream_type_item);
+        return std::max(getMaxByteSize(stream_type), stream_type_item._data.size());
+    }
+
+    std::shared_ptr<SharedMemoryNotification> getNotification()
+    {
+        if (!_notification) {
+            _configuration.updatePropertyVariables();
+            const auto segment_name = getDomainSegmentName(_configuration._participant_domain);
+            auto segment = SharedMemorySegment::open(segment_name,
+                                                     SharedMemoryNotification::getPayloadSize(),
+                                                     SharedMemoryNotification::initialize,
+                                                     segment_open_timeout);
+            if (!segment) {
+                logError(a_util::strings::format(
+                    "Opening shared memory segment '%s' failed", segment_name.c_str()));
+                return nullptr;
+            }
+            _notification = std::make_shared<SharedMemoryNotification>(std::move(segment));
+        }
+        return _notification;
+    }
+
+    std::shared_ptr<SharedMemoryRing> getRing(const std::string& name, size_t required_slot_size)
+    {
+        const auto ring_iterator = _rings.find(name);
+        if (ring_iterator != _rings.end()) {
+            return ring_iterator->second;
+        }
+
+        _configuration.updatePropertyVariables();
+        const auto slot_count = static_cast<size_t>(
+            std::max<int32_t>(static_cast<int32_t>(_configuration._slot_count), 1));
+        // the configured slot size is a minimum, stream types may require larger slots
+        const auto slot_size = std::max(
+            required_slot_size,
+            static_cast<size_t>(
+                std::max<int32_t>(static_cast<int32_t>(_configuration._slot_size), 0)));
+        const auto segment_name =
+            getSignalSegmentName(_configuration._participant_domain, name);
+
+        // the dimensions only apply if this participant creates the segment
+        auto segment = SharedMemorySegment::open(
+            segment_name,
+            SharedMemoryRing::getPayloadSize(slot_count, slot_size),
+            [slot_count, slot_size](void* payload) {
+                SharedMemoryRing::initialize(payload, slot_count, slot_size);
+            },
+            segment_open_timeout);
+        if (!segment) {
+            logError(
+                a_util::strings::format("Opening shared memory segment '%s' of signal '%s' failed",
+                                        segment_name.c_str(),
+                                        name.c_str()));
+            return nullptr;
+        }
+
+        auto ring = std::make_shared<SharedMemoryRing>(std::move(segment));
+        if (!ring->isValid()) {
+            logError(a_util::strings::format(
+                "Shared memory segment '%s' of signal '%s' does not contain a valid ring buffer",
+                segment_name.c_str(),
+                name.c_str()));
+            return nullptr;
+        }
+        if (ring->getSlotSize() < required_slot_size) {
+            logError(a_util::strings::format(
+                "Shared memory segment '%s' of signal '%s' has been created with a slot size of "
+                "%zu bytes, larger samples are not transmitted",
+                segment_name.c_str(),
+                name.c_str(),
+                ring->getSlotSize()));
+        }
+        _rings[name] = ring;
+        return ring;
+    }
+
+    void logError(const std::string& message) const
+    {
+        if (_logger && _logger->isErrorEnabled()) {
+            _logger->logError(message);
+        }
+    }
+
+    std::vector<base::StreamMetaType> _supported_meta_types;
+    std::set<std::string> _registered_readers;
+    std::set<std::string> _registered_writers;
+    // readers and writers of a signal within this participant share the ring
+    std::map<std::string, std::shared_ptr<SharedMemoryRing>> _rings;
+    std::shared_ptr<SharedMemoryNotification> _notification;
+
+    std::shared_ptr<base::SimulationDataAccessCollection<ReaderQueue>> _data_access_collection;
+    std::mutex _reception_mutex;
+    std::atomic<bool> _stop_reception{false};
+
+    SharedMemorySimulationBusConfiguration& _configuration;
+};
+
+SharedMemorySimulationBus::SharedMemorySimulationBus()
+    : _impl(std::make_unique<Impl>(_simulation_bus_configuration))
+{
+}
+
+SharedMemorySimulationBus::~SharedMemorySimulationBus()
+{
+}
+
+fep3::Result SharedMemorySimulationBus::create()
+{
+    const auto components = _components.lock();
+    if (components) {
+        const auto logging_service = components->getComponent<ILoggingService>();
+        if (logging_service) {
+            _impl->_logger =
+                logging_service->createLogger("shared_memory_simulation_bus.component");
+        }
+
+        const auto configuration_service = components->getComponent<IConfigurationService>();
+        if (configuration_service) {
+            FEP3_RETURN_IF_FAILED(
+                _simulation_bus_configuration.initConfiguration(*configuration_service));
+        }
+        else {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_STATE,
+                                     "Can not get configuration service interface");
+        }
+    }
+    return {};
+}
+
+fep3::Result SharedMemorySimulationBus::destroy()
+{
+    _simulation_bus_configuration.deinitConfiguration();
+    _impl->_logger.reset();
+    return {};
+}
+
+fep3::Result SharedMemorySimulationBus::initialize()
+{
+    return _impl->reset();
+}
+
+fep3::Result SharedMemorySimulationBus::deinitialize()
+{
+    return _impl->reset();
+}
+
+bool SharedMemorySimulationBus::isSupported(const IStreamType& stream_type) const
+{
+    return _impl->isSupported(stream_type);
+}
+
+std::unique_ptr<ISimulationBus::IDataReader> SharedMemorySimulationBus::getReader(
+    const std::string& name, const IStreamType& stream_type)
+{
+    return _impl->getReader(name, stream_type, 1);
+}
+
+std::unique_ptr<ISimulationBus::IDataReader> SharedMemorySimulationBus::getReader(
+    const std::string& name, const IStreamType& stream_type, size_t queue_capacity)
+{
+    return _impl->getReader(name, stream_type, queue_capacity);
+}
+
+std::unique_ptr<ISimulationBus::IDataReader> SharedMemorySimulationBus::getReader(
+    const std::string& name)
+{
+    return _impl->getReader(name, 1);
+}
+
+std::unique_ptr<ISimulationBus::IDataReader> SharedMemorySimulationBus::getReader(
+    const std::string& name, size_t queue_capacity)
+{
+    return _impl->getReader(name, queue_capacity);
+}
+
+std::unique_ptr<ISimulationBus::IDataWriter> SharedMemorySimulationBus::getWriter(
+    const std::string& name, const IStreamType& stream_type)
+{
+    return _impl->getWriter(name, stream_type, 1);
+}
+
+std::unique_ptr<ISimulationBus::IDataWriter> SharedMemorySimulationBus::getWriter(
+    const std::string& name, const IStreamType& stream_type, size_t queue_capacity)
+{
+    return _impl->getWriter(name, stream_type, queue_capacity);
+}
+
+std::unique_ptr<ISimulationBus::IDataWriter> SharedMemorySimulationBus::getWriter(
+    const std::string& name)
+{
+    return _impl->getWriter(name, 1);
+}
+
+std::unique_ptr<ISimulationBus::IDataWriter> SharedMemorySimulationBus::getWriter(
+    const std::string& name, size_t queue_capacity)
+{
+    return _impl->getWriter(name, queue_capacity);
+}
+
+void SharedMemorySimulationBus::startBlockingReception(
+    const std::function<void()>& reception_preparation_done_callback)
+{
+    _impl->startBlockingReception(reception_preparation_done_callback);
+}
+
+void SharedMemorySimulationBus::stopBlockingReception()
+{
+    _impl->stopBlockingReception();
+}
+
+SharedMemorySimulationBus::SharedMemorySimulationBusConfiguration::
+    SharedMemorySimulationBusConfiguration()
+    : Configuration(FEP3_SHARED_MEMORY_SIMBUS_CONFIG)
+{
+}
+
+fep3::Result SharedMemorySimulationBus::SharedMemorySimulationBusConfiguration::
+    registerPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_participant_domain, FEP3_SIMBUS_PARTICIPANT_DOMAIN_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_slot_count, FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        registerPropertyVariable(_slot_size, FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_PROPERTY));
+    return {};
+}
+
+fep3::Result SharedMemorySimulationBus::SharedMemorySimulationBusConfiguration::
+    unregisterPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_participant_domain, FEP3_SIMBUS_PARTICIPANT_DOMAIN_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_slot_count, FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(
+        unregisterPropertyVariable(_slot_size, FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_PROPERTY));
+    return {};
+}
+
+} // namespace shared_memory
+} // namespace fep3
@@ -0,0 +1,98 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#pragma once
+
+#include <fep3/base/properties/propertynode.h>
+#include <fep3/components/base/component.h>
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+
+namespace fep3 {
+namespace shared_memory {
+
+/**
+ * Implements a simulation bus exchanging data between participants on the same host via POSIX
+ * shared memory.
+ *
+ * Every signal of a participant domain is mapped to a ring buffer within a shared memory segment,
+ * which is created by the first participant using the signal and unlinked when the last one
+ * releases it. Writers copy their samples into the ring buffer on transmit, readers copy them
+ * out without taking any lock. The data triggered reception sleeps on a futex shared by all
+ * participants of the domain, which is woken on every transmit.
+ */
+class SharedMemorySimulationBus : public fep3::base::Component<fep3::arya::ISimulationBus> {
+public:
+    SharedMemorySimulationBus();
+    ~SharedMemorySimulationBus();
+    SharedMemorySimulationBus(const SharedMemorySimulationBus&) = delete;
+    SharedMemorySimulationBus(SharedMemorySimulationBus&&) = delete;
+    SharedMemorySimulationBus& operator=(const SharedMemorySimulationBus&) = delete;
+    SharedMemorySimulationBus& operator=(SharedMemorySimulationBus&&) = delete;
+
+public: // the base::Component statemachine
+    fep3::Result create() override;
+    fep3::Result destroy() override;
+    fep3::Result initialize() override;
+    fep3::Result deinitialize() override;
+
+public: // the arya SimulationBus interface
+    bool isSupported(const IStreamType& stream_type) const override;
+
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           const IStreamType& stream_type) override;
+
+    std::unique_ptr<IDataReader> getReader(const std::string& name,
+                                           const IStreamType& stream_type,
+                                           size_t queue_capacity) override;
+
+    std::unique_ptr<IDataReader> getReader(const std::string& name) override;
+    std::unique_ptr<IDataReader> getReader(const std::string& name, size_t queue_capacity) override;
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           const IStreamType& stream_type) override;
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name,
+                                           const IStreamType& stream_type,
+                                           size_t queue_capacity) override;
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name) override;
+    std::unique_ptr<IDataWriter> getWriter(const std::string& name, size_t queue_capacity) override;
+
+    void startBlockingReception(
+        const std::function<void()>& reception_preparation_done_callback) override;
+    void stopBlockingReception() override;
+
+private:
+    class SharedMemorySimulationBusConfiguration : public fep3::base::Configuration {
+    public:
+        SharedMemorySimulationBusConfiguration();
+        ~SharedMemorySimulationBusConfiguration() = default;
+
+    public:
+        fep3::Result registerPropertyVariables() override;
+        fep3::Result unregisterPropertyVariables() override;
+
+    public:
+        fep3::base::PropertyVariable<int32_t> _participant_domain{
+            FEP3_SIMBUS_PARTICIPANT_DOMAIN_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<int32_t> _slot_count{
+            FEP3_SHARED_MEMORY_SIMBUS_SLOT_COUNT_DEFAULT_VALUE};
+        fep3::base::PropertyVariable<int32_t> _slot_size{
+            FEP3_SHARED_MEMORY_SIMBUS_SLOT_SIZE_DEFAULT_VALUE};
+    };
+
+    // declared before _impl, which refers to the configuration during its whole lifetime
+    SharedMemorySimulationBusConfiguration _simulation_bus_configuration;
+
+    class Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace shared_memory
+} // namespace fep3
@@ -15,11 +15,15 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/base/sample/data_sample.h>
 #include <fep3/base/stream_type/default_stream_type.h>
 #include <fep3/base/stream_type/mock/mock_stream_type.h>
+#include <fep3/components/data_registry/data_registry_loan_intf.h>
+#include <fep3/native_components/data_registry/data_reader_queue.hpp>
 #include <fep3/native_components/simulation_bus/simulation_bus.h>
 #include <fep3/rpc_services/data_registry/data_registry_client_stub.h>
 
 #include <helper/gmock_destruction_helper.h>
 
+#include <future>
+
 bool containsVector(const std::vector<std::string>& source_vec,
                     const std::vector<std::string>& contain_vec)
 {
@@ -73,6 +77,133 @@ TEST(DataRegistry, testReturnDDLMergeErrorInfo)
         ".*is not a valid DDL string. See problem list!.*xml - header.*Major version 0 invalid");
 }
 
+/**
+ * @detail Test that signals stay addressable by their alias name while other signals are
+ * unregistered and registered again
+ */
+TEST(DataRegistry, testReregisterSignals)
+{
+    fep3::native::DataRegistry data_registry;
+    const fep3::base::StreamTypeRaw stream_type_raw;
+    const fep3::base::StreamTypePlain<int32_t> stream_type_int32;
+    constexpr size_t signal_count = 2500;
+
+    for (size_t i = 0; i < signal_count; ++i) {
+        ASSERT_FEP3_NOERROR(
+            data_registry.registerDataIn("signal_in_" + std::to_string(i), stream_type_raw));
+        ASSERT_FEP3_NOERROR(
+            data_registry.registerDataOut("signal_out_" + std::to_string(i), stream_type_raw));
+    }
+    ASSERT_EQ(data_registry.getSignalInNames().size(), signal_count);
+    ASSERT_EQ(data_registry.getSignalOutNames().size(), signal_count);
+
+    ASSERT_FEP3_NOERROR(data_registry.unregisterDataIn("signal_in_7"));
+    ASSERT_FEP3_NOERROR(data_registry.unregisterDataOut("signal_out_7"));
+    EXPECT_EQ(data_registry.getStreamType("signal_in_7").getMetaTypeName(), "hook");
+    EXPECT_EQ(data_registry.getStreamType("signal_out_7").getMetaTypeName(), "hook");
+    EXPECT_FALSE(data_registry.getReader("signal_in_7"));
+    EXPECT_FALSE(data_registry.getWriter("signal_out_7"));
+
+    // The unregistered signals free their alias names for new signals
+    ASSERT_FEP3_NOERROR(data_registry.registerDataIn("signal_in_7", stream_type_int32));
+    ASSERT_FEP3_NOERROR(data_registry.registerDataOut("signal_new", stream_type_int32));
+    EXPECT_EQ(data_registry.getStreamType("signal_in_7").getMetaTypeName(),
+              stream_type_int32.getMetaTypeName());
+    EXPECT_EQ(data_registry.getStreamType("signal_new").getMetaTypeName(),
+              stream_type_int32.getMetaTypeName());
+    EXPECT_TRUE(data_registry.getReader("signal_in_7"));
+    EXPECT_TRUE(data_registry.getWriter("signal_new"));
+
+    // The remaining signals are not affected
+    EXPECT_EQ(data_registry.getStreamType("signal_in_8").getMetaTypeName(),
+              stream_type_raw.getMetaTypeName());
+    EXPECT_EQ(data_registry.getStreamType("signal_out_2499").getMetaTypeName(),
+              stream_type_raw.getMetaTypeName());
+    EXPECT_EQ(data_registry.getSignalInNames().size(), signal_count);
+    EXPECT_EQ(data_registry.getSignalOutNames().size(), signal_count);
+}
+
+/**
+ * @detail Test that the layouts and codec factories of ddl struct types are cached until further
+ * ddl descriptions are merged
+ */
+TEST(DataRegistry, testResolveSignalTypeLayout)
+{
+    fep3::native::DataRegistry data_registry;
+    const auto ddl_description = R"(<?xml version="1.0" encoding="utf-8" standalone="no"?>
+<adtf:ddl xmlns:adtf="adtf">
+ <header>
+  <language_version>4.00</language_version>
+  <author>fep_team</author>
+  <date_creation>20.02.2020</date_creation>
+  <date_change>20.02.2020</date_change>
+  <description>Simplistic DDL for testing purposes</description>
+ </header>
+ <units />
+ <datatypes>
+  <datatype description="predefined ADTF tUInt8 datatype" name="tUInt8" size="8" />
+  <datatype description="predefined ADTF tUInt32 datatype" name="tUInt32" size="32" />
+ </datatypes>
+ <enums>
+ </enums>
+ <structs>
+  <struct alignment="1" name="tInnerStruct" version="1">
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="0" name="ui8Value" type="tUInt8"/>
+  </struct>
+  <struct alignment="1" name="tTestStruct" version="1">
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="0" name="ui32First" type="tUInt32"/>
+   <element alignment="1" arraysize="2" byteorder="LE" bytepos="4" name="sInner" type="tInnerStruct"/>
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="6" name="sLast" type="tInnerStruct"/>
+  </struct>
+ </structs>
+ <streams />
+</adtf:ddl>)";
+    ASSERT_FEP3_NOERROR(data_registry.registerDataIn(
+        "signal_in", fep3::base::StreamTypeDDL("tTestStruct", ddl_description)));
+
+    std::shared_ptr<const fep3::DDLTypeLayout> layout;
+    ASSERT_FEP3_NOERROR(data_registry.resolveSignalTypeLayout("tTestStruct", layout));
+    ASSERT_TRUE(layout);
+    EXPECT_EQ(layout->_size, 7u);
+    EXPECT_FALSE(layout->_dynamic);
+    ASSERT_EQ(layout->_elements.count("ui32First"), 1u);
+    EXPECT_EQ(layout->_elements.at("ui32First")._byte_pos, 0u);
+    EXPECT_EQ(layout->_elements.at("ui32First")._type_name, "tUInt32");
+    ASSERT_EQ(layout->_elements.count("sInner"), 1u);
+    EXPECT_EQ(layout->_elements.at("sInner")._array_size, 2u);
+    // Elements of struct arrays are not flattened, elements of single structs are
+    EXPECT_EQ(layout->_elements.count("sInner.ui8Value"), 0u);
+    ASSERT_EQ(layout->_elements.count("sLast.ui8Value"), 1u);
+    EXPECT_EQ(layout->_elements.at("sLast.ui8Value")._byte_pos, 6u);
+
+    std::shared_ptr<const fep3::DDLTypeLayout> cached_layout;
+    ASSERT_FEP3_NOERROR(data_registry.resolveSignalTypeLayout("tTestStruct", cached_layout));
+    EXPECT_EQ(cached_layout, layout);
+    ASSERT_FEP3_RESULT(data_registry.resolveSignalTypeLayout("tUnknownStruct", cached_layout),
+                       fep3::ERR_NOT_FOUND);
+
+    std::shared_ptr<const ddl::CodecFactory> codec_factory;
+    ASSERT_FEP3_NOERROR(data_registry.resolveSignalCodecFactory("tTestStruct", codec_factory));
+    ASSERT_TRUE(codec_factory);
+    std::shared_ptr<const ddl::CodecFactory> cached_codec_factory;
+    ASSERT_FEP3_NOERROR(
+        data_registry.resolveSignalCodecFactory("tTestStruct", cached_codec_factory));
+    EXPECT_EQ(cached_codec_factory, codec_factory);
+    ASSERT_FEP3_RESULT(
+        data_registry.resolveSignalCodecFactory("tUnknownStruct", cached_codec_factory),
+        fep3::ERR_NOT_FOUND);
+
+    // Merging another description invalidates the cached layouts
+    ASSERT_FEP3_NOERROR(data_registry.registerDataIn(
+        "signal_in_inner", fep3::base::StreamTypeDDL("tInnerStruct", ddl_description)));
+    ASSERT_FEP3_NOERROR(data_registry.resolveSignalTypeLayout("tTestStruct", cached_layout));
+    EXPECT_NE(cached_layout, layout);
+    EXPECT_EQ(cached_layout->_size, layout->_size);
+    ASSERT_FEP3_NOERROR(
+        data_registry.resolveSignalCodecFactory("tTestStruct", cached_codec_factory));
+    EXPECT_NE(cached_codec_factory, codec_factory);
+}
+
 TEST_F(NativeDataRegistryWithMocks, testGetStreamTypeNotFound)
 {
     ASSERT_FEP3_NOERROR(_data_registry->initialize());
@@ -600,6 +731,48 @@ TEST_F(NativeDataCommunication, sendAndReceiveData)
     EXPECT_EQ(value_read_from_listener, value_written);
 }
 
+/**
+ * @detail Test whether samples loaned from a data registry writer are written in place and
+ * received by the readers of the signal
+ */
+TEST_F(NativeDataCommunication, sendAndReceiveLoanedData)
+{
+    auto& data_reg_sender = _sender._registry;
+    auto& data_reg_receiver = _receiver._registry;
+
+    ASSERT_FEP3_NOERROR(
+        data_reg_sender->registerDataOut("plain_data", fep3::base::StreamTypePlain<uint64_t>()));
+    ASSERT_FEP3_NOERROR(
+        data_reg_receiver->registerDataIn("plain_data", fep3::base::StreamTypePlain<uint64_t>()));
+
+    auto listener = std::make_shared<TestDataReceiver>();
+    ASSERT_FEP3_NOERROR(data_reg_receiver->registerDataReceiveListener("plain_data", listener));
+    auto writer = data_reg_sender->getWriter("plain_data");
+    auto loaning_writer = dynamic_cast<fep3::IDataRegistryLoaningWriter*>(writer.get());
+    ASSERT_TRUE(loaning_writer);
+
+    init_run();
+
+    const auto loaned_sample = loaning_writer->loanSample(sizeof(uint64_t));
+    ASSERT_TRUE(loaned_sample);
+    ASSERT_GE(loaned_sample->getCapacity(), sizeof(uint64_t));
+    const uint64_t value_written = 0x0123456789abcdef;
+    std::memcpy(loaned_sample->data(), &value_written, sizeof(value_written));
+    loaned_sample->setTime(fep3::Timestamp{42});
+    ASSERT_FEP3_NOERROR(loaning_writer->commit(loaned_sample));
+    ASSERT_FEP3_RESULT(loaning_writer->commit(nullptr), fep3::ERR_POINTER);
+
+    listener->reset();
+    ASSERT_FEP3_NOERROR(writer->flush());
+    ASSERT_TRUE(listener->waitForSampleUpdate(20));
+
+    EXPECT_EQ(listener->_last_sample->getTime(), fep3::Timestamp{42});
+    uint64_t value_read{};
+    fep3::base::RawMemoryStandardType<uint64_t> value_ref(value_read);
+    EXPECT_EQ(listener->_last_sample->read(value_ref), sizeof(uint64_t));
+    EXPECT_EQ(value_read, value_written);
+}
+
 MATCHER_P(ArrayEqual, arrayToCompare, "")
 {
     for (const std::string& elem: arrayToCompare) {
@@ -1151,3 +1324,147 @@ TEST_F(NativeDataRegistryWithMocks, testGetReaderWriterOrder)
     ASSERT_FEP3_NOERROR(_data_registry->relax());
     ASSERT_FEP3_NOERROR(_data_registry->deinitialize());
 }
+
+/**
+ * @detail Test that received samples are passed to all readers and listeners which are alive and
+ * that destroyed readers and unregistered listeners are not served anymore
+ */
+TEST_F(NativeDataRegistryWithMocks, testReceiveAfterReaderRelease)
+{
+    const std::string signal_in_name = "signal_in";
+    auto mock_data_reader =
+        std::make_unique<::testing::NiceMock<::fep3::mock::SimulationBus::DataReader>>();
+    std::shared_ptr<fep3::ISimulationBus::IDataReceiver> sim_bus_receiver;
+    EXPECT_CALL(*mock_data_reader, reset_(_)).WillOnce(SaveArg<0>(&sim_bus_receiver));
+
+    ASSERT_FEP3_NOERROR(
+        _data_registry->registerDataIn(signal_in_name, fep3::base::StreamTypeRaw{}));
+    auto reader = _data_registry->getReader(signal_in_name, 2);
+    auto released_reader = _data_registry->getReader(signal_in_name, 10);
+    auto listener = std::make_shared<TestDataReceiver>();
+    ASSERT_FEP3_NOERROR(_data_registry->registerDataReceiveListener(signal_in_name, listener));
+    released_reader.reset();
+
+    ASSERT_FEP3_NOERROR(_data_registry->initialize());
+
+    // the queue capacity requested from the simulation bus does not consider the released reader
+    EXPECT_CALL(*_simulation_bus, getReader(signal_in_name, _, 2))
+        .WillOnce(Return(ByMove(std::move(mock_data_reader))));
+    EXPECT_CALL(*_component_registry, findComponent(_simulation_bus->getComponentIID()))
+        .Times(1)
+        .WillOnce(::testing::Return(_simulation_bus.get()));
+    ASSERT_FEP3_NOERROR(_data_registry->tense());
+    ASSERT_TRUE(sim_bus_receiver);
+
+    const fep3::data_read_ptr<const fep3::IDataSample> sample =
+        std::make_shared<fep3::base::DataSample>();
+    (*sim_bus_receiver)(sample);
+    EXPECT_EQ(reader->size(), 1);
+    EXPECT_EQ(listener->_last_sample, sample);
+
+    ASSERT_FEP3_NOERROR(_data_registry->unregisterDataReceiveListener(signal_in_name, listener));
+    listener->reset();
+    (*sim_bus_receiver)(sample);
+    EXPECT_EQ(reader->size(), 2);
+    EXPECT_FALSE(listener->_last_sample);
+
+    // a reader released while the signal is still receiving does not break the reception
+    reader.reset();
+    ASSERT_NO_THROW((*sim_bus_receiver)(sample));
+    sim_bus_receiver.reset();
+
+    EXPECT_CALL(*_component_registry, findComponent(_simulation_bus->getComponentIID()))
+        .Times(1)
+        .WillOnce(::testing::Return(_simulation_bus.get()));
+
+    ASSERT_FEP3_NOERROR(_data_registry->relax());
+    ASSERT_FEP3_NOERROR(_data_registry->deinitialize());
+}
+
+/**
+ * @detail Test that the reader queue pops all items in front of the first sample which is not due
+ * at once and keeps a stream type behind the last due sample
+ */
+TEST(DataReaderQueue, testPopUntil)
+{
+    struct CountingReceiver : public fep3::IDataRegistry::IDataReceiver {
+        void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+        {
+            ++_stream_type_count;
+        }
+        void operator()(const fep3::data_read_ptr<const fep3::IDataSample>& sample) override
+        {
+            _sample_times.push_back(sample->getTime());
+        }
+        size_t _stream_type_count{0};
+        std::vector<fep3::Timestamp> _sample_times;
+    };
+    const auto createSample = [](int64_t time) {
+        auto sample = std::make_shared<fep3::base::DataSample>();
+        sample->setTime(fep3::Timestamp(time));
+        return sample;
+    };
+    const auto stream_type = std::make_shared<fep3::base::StreamTypeRaw>();
+
+    fep3::native::DataReaderQueue queue(10);
+    queue(stream_type);
+    queue(createSample(1));
+    queue(createSample(2));
+    queue(stream_type);
+    queue(createSample(3));
+
+    CountingReceiver receiver;
+    fep3::IDataRegistryBatchReader& batch_reader = queue;
+    EXPECT_EQ(batch_reader.popUntil(fep3::Timestamp(0), std::less<fep3::Timestamp>{}, receiver),
+              0u);
+    EXPECT_EQ(batch_reader.popUntil(fep3::Timestamp(3), std::less<fep3::Timestamp>{}, receiver),
+              3u);
+    EXPECT_EQ(receiver._stream_type_count, 1u);
+    EXPECT_EQ(receiver._sample_times,
+              std::vector<fep3::Timestamp>({fep3::Timestamp(1), fep3::Timestamp(2)}));
+    EXPECT_EQ(queue.size(), 2u);
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), fep3::Timestamp(3));
+
+    EXPECT_EQ(
+        batch_reader.popUntil(fep3::Timestamp(3), std::less_equal<fep3::Timestamp>{}, receiver),
+        2u);
+    EXPECT_EQ(receiver._stream_type_count, 2u);
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.getFrontTime());
+}
+
+/**
+ * @detail Test that the reader queue calls the receiver of popUntil after unlocking, so samples
+ * are received by the queue while the popped ones are processed
+ */
+TEST(DataReaderQueue, testPopUntilReceivesWhileProcessing)
+{
+    struct ReceivingReceiver : public fep3::IDataRegistry::IDataReceiver {
+        explicit ReceivingReceiver(fep3::native::DataReaderQueue& queue) : _queue(queue)
+        {
+        }
+        void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+        {
+        }
+        void operator()(const fep3::data_read_ptr<const fep3::IDataSample>& sample) override
+        {
+            // the sample is received by another thread, as the data triggered reception does
+            auto receiving = std::async(std::launch::async, [this, sample]() { _queue(sample); });
+            _received_meanwhile = receiving.wait_for(std::chrono::seconds(5)) ==
+                                  std::future_status::ready;
+        }
+        fep3::native::DataReaderQueue& _queue;
+        bool _received_meanwhile{false};
+    };
+    auto sample = std::make_shared<fep3::base::DataSample>();
+    sample->setTime(fep3::Timestamp(1));
+
+    fep3::native::DataReaderQueue queue(10);
+    queue(sample);
+
+    ReceivingReceiver receiver(queue);
+    EXPECT_EQ(queue.popUntil(fep3::Timestamp(2), std::less<fep3::Timestamp>{}, receiver), 1u);
+    EXPECT_TRUE(receiver._received_meanwhile);
+    EXPECT_EQ(queue.size(), 1u);
+}
@@ -17,6 +17,8 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <boost/filesystem.hpp>
 
+#include <chrono>
+
 using namespace testing;
 
 // DDL Struct defined in the test description
@@ -159,6 +161,82 @@ struct MappingTester : public NativeDataRegistry {
         receiver_b.verify(expected_value_b);
     }
 
+    /**
+     * Maps @p sample_count samples of source signal c to the target signals a and b with the
+     * compiled mapping programs or the ddl mapping engine and checks the mapped values
+     */
+    void mapSamples(bool mapping_compilation,
+                    size_t sample_count,
+                    std::chrono::microseconds& duration)
+    {
+        constexpr auto source_signal_name = "source_signal_c",
+                       target_signal_a_name = "target_signal_a",
+                       target_signal_b_name = "target_signal_b";
+
+        std::vector<std::string> ddl_files;
+        ddl_files.emplace_back(TEST_FILE_DIR "test_signal_a.description");
+        ddl_files.emplace_back(TEST_FILE_DIR "test_signal_b.description");
+        ddl_files.emplace_back(TEST_FILE_DIR "test_signal_c.description");
+
+        ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+            *_configuration_service,
+            FEP3_DATA_REGISTRY_MAPPING_CONFIGURATION_FILE_PATH,
+            TEST_FILE_DIR "test_c_to_a_b.map"));
+        ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::vector<std::string>>(
+            *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_DDL_FILE_PATHS, ddl_files));
+        ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<bool>(
+            *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_COMPILATION, mapping_compilation));
+
+        SetUpSimulationBusMock({source_signal_name});
+
+        ASSERT_FEP3_NOERROR(_registry->registerDataIn(
+            target_signal_a_name,
+            fep3::base::StreamTypeDDLFileRef{"tTestStructA",
+                                             TEST_FILE_DIR "test_signal_a.description"}));
+        ASSERT_FEP3_NOERROR(_registry->registerDataIn(
+            target_signal_b_name,
+            fep3::base::StreamTypeDDLFileRef{"tTestStructB",
+                                             TEST_FILE_DIR "test_signal_b.description"}));
+        _target_readers.insert(
+            {target_signal_a_name, std::move(_registry->getReader(target_signal_a_name))});
+        _target_readers.insert(
+            {target_signal_b_name, std::move(_registry->getReader(target_signal_b_name))});
+
+        ASSERT_FEP3_NOERROR(_component_registry->initialize());
+        ASSERT_FEP3_NOERROR(_component_registry->tense());
+        ASSERT_FEP3_NOERROR(_component_registry->start());
+
+        sendAndReceiveSignal(TestStructC{5, 4, 3, 2, 1},
+                             source_signal_name,
+                             TestStructA{2, 1},
+                             target_signal_a_name,
+                             TestStructB{5, 3},
+                             target_signal_b_name);
+
+        auto data_sample = std::make_shared<fep3::base::DataSample>(
+            fep3::base::DataSampleType<TestStructC>{TestStructC{5, 4, 3, 2, 1}});
+        auto& source_receiver = *_data_receivers.find(source_signal_name)->second;
+        MyDataReceiver<TestStructA> receiver_a{};
+        MyDataReceiver<TestStructB> receiver_b{};
+        const auto begin = std::chrono::steady_clock::now();
+        for (size_t sample = 0; sample < sample_count; ++sample) {
+            source_receiver(data_sample);
+            _target_readers.find(target_signal_a_name)->second->pop(receiver_a);
+            _target_readers.find(target_signal_b_name)->second->pop(receiver_b);
+        }
+        duration = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin);
+        receiver_a.verify(TestStructA{2, 1});
+        receiver_b.verify(TestStructB{5, 3});
+
+        ASSERT_FEP3_NOERROR(_component_registry->stop());
+        ASSERT_FEP3_NOERROR(_component_registry->relax());
+        ASSERT_FEP3_NOERROR(_component_registry->deinitialize());
+        _target_readers.clear();
+        ASSERT_FEP3_NOERROR(_registry->unregisterDataIn(target_signal_a_name));
+        ASSERT_FEP3_NOERROR(_registry->unregisterDataIn(target_signal_b_name));
+    }
+
     std::map<std::string, std::shared_ptr<fep3::ISimulationBus::IDataReceiver>> _data_receivers;
     std::map<std::string, fep3::mock::SimulationBus::DataReader*> _source_readers;
     std::map<std::string, std::unique_ptr<fep3::IDataRegistry::IDataReader>> _target_readers;
@@ -456,6 +534,145 @@ TEST_F(MappingTester, testSignalMappingUnknownDDLFadeOut)
     ASSERT_FEP3_NOERROR(_component_registry->deinitialize());
 }
 
+/**
+ * @detail Check whether target signals of the same source signal, which are evaluated in parallel,
+ * are delivered in the order of the received source samples.
+ */
+TEST_F(MappingTester, testSignalMappingParallelEvaluation)
+{
+    constexpr auto source_signal_name = "source_signal_c", target_signal_a_name = "target_signal_a",
+                   target_signal_b_name = "target_signal_b";
+    constexpr size_t sample_count = 10;
+
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+        *_configuration_service,
+        FEP3_DATA_REGISTRY_MAPPING_CONFIGURATION_FILE_PATH,
+        TEST_FILE_DIR "test_c_to_a_b.map"));
+    std::vector<std::string> ddl_files;
+    ddl_files.emplace_back(TEST_FILE_DIR "test_signal_a.description");
+    ddl_files.emplace_back(TEST_FILE_DIR "test_signal_b.description");
+    ddl_files.emplace_back(TEST_FILE_DIR "test_signal_c.description");
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::vector<std::string>>(
+        *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_DDL_FILE_PATHS, ddl_files));
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<int32_t>(
+        *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_PARALLEL_EVALUATION_THRESHOLD, 2));
+
+    SetUpSimulationBusMock({source_signal_name});
+
+    ASSERT_FEP3_NOERROR(
+        _registry->registerDataIn(target_signal_a_name,
+                                  fep3::base::StreamTypeDDLFileRef{
+                                      "tTestStructA", TEST_FILE_DIR "test_signal_a.description"}));
+    ASSERT_FEP3_NOERROR(
+        _registry->registerDataIn(target_signal_b_name,
+                                  fep3::base::StreamTypeDDLFileRef{
+                                      "tTestStructB", TEST_FILE_DIR "test_signal_b.description"}));
+    _target_readers.insert(
+        {target_signal_a_name, _registry->getReader(target_signal_a_name, sample_count)});
+    _target_readers.insert(
+        {target_signal_b_name, _registry->getReader(target_signal_b_name, sample_count)});
+
+    ASSERT_FEP3_NOERROR(_component_registry->initialize());
+    ASSERT_FEP3_NOERROR(_component_registry->tense());
+    ASSERT_FEP3_NOERROR(_component_registry->start());
+
+    auto& source_receiver = *_data_receivers.find(source_signal_name)->second;
+    for (uint16_t value = 1; value <= sample_count; ++value) {
+        source_receiver(std::make_shared<fep3::base::DataSample>(
+            fep3::base::DataSampleType<TestStructC>{TestStructC{value, 0, value, value, 0}}));
+    }
+
+    for (uint16_t value = 1; value <= sample_count; ++value) {
+        MyDataReceiver<TestStructA> receiver_a{};
+        ASSERT_FEP3_NOERROR(_target_readers.find(target_signal_a_name)->second->pop(receiver_a));
+        receiver_a.verify(TestStructA{value, 0});
+
+        MyDataReceiver<TestStructB> receiver_b{};
+        ASSERT_FEP3_NOERROR(_target_readers.find(target_signal_b_name)->second->pop(receiver_b));
+        receiver_b.verify(TestStructB{value, value});
+    }
+
+    ASSERT_FEP3_NOERROR(_component_registry->stop());
+    ASSERT_FEP3_NOERROR(_component_registry->relax());
+    ASSERT_FEP3_NOERROR(_component_registry->deinitialize());
+}
+
+/**
+ * @detail Check whether the compiled mapping programs and the ddl mapping engine map the source
+ * signal to the same target signals.
+ */
+TEST_F(MappingTester, testSignalMappingCompilation)
+{
+    std::chrono::microseconds duration{};
+    ASSERT_NO_FATAL_FAILURE(mapSamples(false, 100, duration));
+    ASSERT_NO_FATAL_FAILURE(mapSamples(true, 100, duration));
+}
+
+/**
+ * @detail Check whether the compiled mapping programs and the ddl mapping engine apply the default
+ * values of target elements which are not assigned.
+ */
+TEST_F(MappingTester, testSignalMappingDefaultValues)
+{
+    constexpr auto source_signal_name = "source_signal_c",
+                   target_signal_name = "target_signal_default";
+
+    std::vector<std::string> ddl_files;
+    ddl_files.emplace_back(TEST_FILE_DIR "test_signal_c.description");
+    ddl_files.emplace_back(TEST_FILE_DIR "test_signal_default.description");
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+        *_configuration_service,
+        FEP3_DATA_REGISTRY_MAPPING_CONFIGURATION_FILE_PATH,
+        TEST_FILE_DIR "test_c_to_default.map"));
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::vector<std::string>>(
+        *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_DDL_FILE_PATHS, ddl_files));
+
+    for (const bool mapping_compilation: {false, true}) {
+        ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<bool>(
+            *_configuration_service, FEP3_DATA_REGISTRY_MAPPING_COMPILATION, mapping_compilation));
+        SetUpSimulationBusMock({source_signal_name});
+
+        ASSERT_FEP3_NOERROR(_registry->registerDataIn(
+            target_signal_name,
+            fep3::base::StreamTypeDDLFileRef{"tTestStructDefault",
+                                             TEST_FILE_DIR "test_signal_default.description"}));
+        _target_readers.insert(
+            {target_signal_name, std::move(_registry->getReader(target_signal_name))});
+
+        ASSERT_FEP3_NOERROR(_component_registry->initialize());
+        ASSERT_FEP3_NOERROR(_component_registry->tense());
+        ASSERT_FEP3_NOERROR(_component_registry->start());
+
+        // tInt8Second is not assigned and keeps its default value
+        sendAndReceiveSignal(TestStructC{5, 4, 3, 2, 1},
+                             TestStructA{2, -7},
+                             source_signal_name,
+                             target_signal_name);
+
+        ASSERT_FEP3_NOERROR(_component_registry->stop());
+        ASSERT_FEP3_NOERROR(_component_registry->relax());
+        ASSERT_FEP3_NOERROR(_component_registry->deinitialize());
+        _target_readers.clear();
+        ASSERT_FEP3_NOERROR(_registry->unregisterDataIn(target_signal_name));
+    }
+}
+
+/**
+ * @detail Benchmark of the compiled mapping programs against the ddl mapping engine.
+ * The durations of both variants are recorded as test properties but not asserted.
+ * The benchmark is disabled by default, run it with --gtest_also_run_disabled_tests.
+ */
+TEST_F(MappingTester, DISABLED_benchmarkSignalMappingCompilation)
+{
+    constexpr size_t sample_count = 100000;
+    for (const bool mapping_compilation: {false, true}) {
+        std::chrono::microseconds duration{};
+        ASSERT_NO_FATAL_FAILURE(mapSamples(mapping_compilation, sample_count, duration));
+        const auto variant = mapping_compilation ? "compiled" : "engine";
+        RecordProperty(std::string(variant) + "_duration_us", static_cast<int>(duration.count()));
+    }
+}
+
 // Check whether source signals of different update rates result in target signal reception
 // according to the mapping configuration.
 TEST_F(MappingTester, testSignalMappingNonMatchingUpdateRates)
@@ -0,0 +1,123 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/native_components/data_registry/mapping_program.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+using fep3::native::MappingElementType;
+using fep3::native::MappingProgram;
+
+struct Source {
+    uint64_t first;
+    int64_t second;
+    uint32_t third;
+    uint16_t fourth;
+    int8_t fifth;
+};
+
+struct Target {
+    uint64_t first;
+    uint32_t second;
+    uint16_t third;
+    int8_t fourth;
+    double fifth;
+};
+
+/**
+ * @detail Check whether the element types of the predefined ddl data types are resolved
+ */
+TEST(MappingProgram, testElementTypes)
+{
+    MappingElementType type{};
+    ASSERT_TRUE(fep3::native::arya::getMappingElementType("tUInt16", type));
+    EXPECT_EQ(type, MappingElementType::UInt16);
+    EXPECT_EQ(fep3::native::arya::getMappingElementSize(type), 2u);
+    ASSERT_TRUE(fep3::native::arya::getMappingElementType("tFloat64", type));
+    EXPECT_EQ(type, MappingElementType::Float64);
+    EXPECT_EQ(fep3::native::arya::getMappingElementSize(type), 8u);
+
+    EXPECT_FALSE(fep3::native::arya::getMappingElementType("tTestStruct", type));
+}
+
+/**
+ * @detail Check whether copies of adjacent source and target memory are merged into a single
+ * memcpy while conversions and non adjacent copies are kept
+ */
+TEST(MappingProgram, testMergeAdjacentCopies)
+{
+    MappingProgram program;
+    // added in reverse order, finalize sorts them by source position
+    program.addAssignment(offsetof(Source, fifth),
+                          MappingElementType::Int8,
+                          offsetof(Target, fifth),
+                          MappingElementType::Float64);
+    program.addAssignment(offsetof(Source, fourth),
+                          MappingElementType::UInt16,
+                          offsetof(Target, third),
+                          MappingElementType::UInt16);
+    program.addAssignment(offsetof(Source, third),
+                          MappingElementType::UInt32,
+                          offsetof(Target, second),
+                          MappingElementType::UInt32);
+    program.addAssignment(offsetof(Source, first),
+                          MappingElementType::UInt64,
+                          offsetof(Target, first),
+                          MappingElementType::UInt64);
+    program.finalize();
+
+    // first, third + fourth merged, conversion of fifth
+    EXPECT_EQ(program.getOperationCount(), 3u);
+    EXPECT_EQ(program.getSourceSize(), offsetof(Source, fifth) + sizeof(int8_t));
+    EXPECT_EQ(program.getTargetSize(), sizeof(Target));
+
+    const Source source{1, 2, 3, 4, -5};
+    Target target{};
+    program.run(&source, &target);
+    EXPECT_EQ(target.first, 1u);
+    EXPECT_EQ(target.second, 3u);
+    EXPECT_EQ(target.third, 4u);
+    EXPECT_EQ(target.fourth, 0);
+    EXPECT_EQ(target.fifth, -5.0);
+}
+
+/**
+ * @detail Check whether conversions between element types behave like a static_cast
+ */
+TEST(MappingProgram, testConversions)
+{
+    MappingProgram program;
+    program.addAssignment(offsetof(Source, second),
+                          MappingElementType::Int64,
+                          offsetof(Target, second),
+                          MappingElementType::UInt32);
+    program.addAssignment(offsetof(Source, first),
+                          MappingElementType::UInt64,
+                          offsetof(Target, fourth),
+                          MappingElementType::Int8);
+    program.finalize();
+    EXPECT_EQ(program.getOperationCount(), 2u);
+
+    const Source source{0x1FF, -1, 0, 0, 0};
+    Target target{};
+    program.run(&source, &target);
+    EXPECT_EQ(target.second, static_cast<uint32_t>(int64_t{-1}));
+    EXPECT_EQ(target.fourth, static_cast<int8_t>(uint64_t{0x1FF}));
+
+    const double constant = 42.9;
+    uint16_t converted_constant{};
+    fep3::native::arya::convertMappingElement(
+        &constant, MappingElementType::Float64, &converted_constant, MappingElementType::UInt16);
+    EXPECT_EQ(converted_constant, 42);
+}
@@ -0,0 +1,455 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/native_components/simulation_bus/data_item_queue.h>
+#include <fep3/native_components/simulation_bus/lock_free_data_item_queue.h>
+#include <fep3/native_components/simulation_bus/mailbox_data_item_queue.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace fep3;
+
+namespace {
+
+data_read_ptr<const IDataSample> createSample(int64_t time)
+{
+    auto sample = std::make_shared<base::DataSample>();
+    sample->setTime(Timestamp(time));
+    return sample;
+}
+
+Timestamp popTime(native::DataItemQueueBase<>& queue)
+{
+    const auto item = queue.pop();
+    const auto& sample = std::get<0>(item);
+    return sample ? sample->getTime() : Timestamp(-1);
+}
+
+struct ProducerConsumerResult {
+    int64_t received_items{0};
+    int64_t last_time{-1};
+    bool order_kept{true};
+};
+
+/**
+ * Pushes @p item_count samples from a producer thread while popping them on the calling thread
+ */
+ProducerConsumerResult runProducerConsumer(native::DataItemQueueBase<>& queue, int64_t item_count)
+{
+    std::vector<data_read_ptr<const IDataSample>> samples;
+    samples.reserve(item_count);
+    for (int64_t time = 0; time < item_count; ++time) {
+        samples.push_back(createSample(time));
+    }
+
+    ProducerConsumerResult result;
+    std::atomic<bool> producer_done{false};
+    std::thread producer([&]() {
+        for (const auto& sample: samples) {
+            queue.push(sample);
+        }
+        producer_done = true;
+    });
+
+    for (;;) {
+        const bool done = producer_done;
+        const auto time = popTime(queue).count();
+        if (time >= 0) {
+            result.order_kept = result.order_kept && (time > result.last_time);
+            result.last_time = time;
+            ++result.received_items;
+        }
+        else if (done && 0 == queue.size()) {
+            break;
+        }
+    }
+    producer.join();
+    return result;
+}
+
+} // namespace
+
+template <typename QUEUE_TYPE>
+class DataItemQueueTest : public ::testing::Test {
+};
+
+using QueueTypes =
+    ::testing::Types<native::DataItemQueue<>, native::LockFreeDataItemQueue<>>;
+TYPED_TEST_SUITE(DataItemQueueTest, QueueTypes);
+
+/**
+ * @detail Test that the queue keeps the order of the items and drops the oldest item if the
+ * capacity is reached
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testDropOldest)
+{
+    TypeParam queue(3);
+    EXPECT_EQ(queue.capacity(), 3u);
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.getFrontTime());
+
+    for (int64_t time = 0; time < 5; ++time) {
+        queue.push(createSample(time));
+    }
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue.getDropCount(), 2u);
+
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(2));
+    EXPECT_EQ(popTime(queue), Timestamp(2));
+    EXPECT_EQ(popTime(queue), Timestamp(3));
+
+    queue.push(createSample(5));
+    EXPECT_EQ(popTime(queue), Timestamp(4));
+    EXPECT_EQ(popTime(queue), Timestamp(5));
+    EXPECT_EQ(queue.size(), 0u);
+
+    const auto empty_item = queue.pop();
+    EXPECT_FALSE(std::get<0>(empty_item));
+    EXPECT_FALSE(std::get<1>(empty_item));
+}
+
+/**
+ * @detail Test that tryPush does not drop the oldest item if the capacity is reached
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testTryPushKeepsOldest)
+{
+    TypeParam queue(2);
+
+    EXPECT_TRUE(queue.tryPush(createSample(0)));
+    EXPECT_TRUE(queue.tryPush(createSample(1)));
+    EXPECT_FALSE(queue.tryPush(createSample(2)));
+    EXPECT_FALSE(
+        queue.tryPush(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>())));
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.getDropCount(), 0u);
+
+    EXPECT_EQ(popTime(queue), Timestamp(0));
+    EXPECT_TRUE(queue.tryPush(createSample(2)));
+    EXPECT_EQ(popTime(queue), Timestamp(1));
+    EXPECT_EQ(popTime(queue), Timestamp(2));
+}
+
+/**
+ * @detail Test that a writer waiting for free space in a full queue is woken up by a pop and that
+ * the wait times out if nothing is popped
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testWaitForPop)
+{
+    TypeParam queue(1);
+    EXPECT_TRUE(queue.tryPush(createSample(0)));
+
+    auto pop_count = queue.getPopCount();
+    EXPECT_FALSE(queue.tryPush(createSample(1)));
+    EXPECT_FALSE(queue.waitForPop(
+        pop_count, std::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        popTime(queue);
+    });
+    EXPECT_TRUE(
+        queue.waitForPop(pop_count, std::chrono::steady_clock::now() + std::chrono::seconds(5)));
+    consumer.join();
+    EXPECT_TRUE(queue.tryPush(createSample(1)));
+
+    // a pop before the wait is not missed
+    pop_count = queue.getPopCount();
+    popTime(queue);
+    EXPECT_TRUE(queue.waitForPop(pop_count, std::chrono::steady_clock::now()));
+}
+
+/**
+ * @detail Test that stream types and samples are popped in the order they have been pushed
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testMixedItems)
+{
+    TypeParam queue(3);
+
+    queue.push(createSample(1));
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(2));
+
+    EXPECT_EQ(popTime(queue), Timestamp(1));
+    EXPECT_FALSE(queue.getFrontTime());
+    const auto stream_type_item = queue.pop();
+    EXPECT_FALSE(std::get<0>(stream_type_item));
+    EXPECT_TRUE(std::get<1>(stream_type_item));
+    EXPECT_EQ(popTime(queue), Timestamp(2));
+}
+
+/**
+ * @detail Test that the front time follows the front item if it is pushed, popped, dropped or
+ * cleared, so it can be read without locking the queue
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testFrontTimeFollowsFront)
+{
+    TypeParam queue(2);
+
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(1));
+    // drops the stream type, so the sample becomes the front
+    queue.push(createSample(2));
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(1));
+
+    EXPECT_EQ(popTime(queue), Timestamp(1));
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(2));
+
+    queue.clear();
+    EXPECT_FALSE(queue.getFrontTime());
+}
+
+/**
+ * @detail Test that popUntil pops the samples at the front as long as they are due, together with
+ * the stream types in front of and between them
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testPopUntil)
+{
+    TypeParam queue(6);
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(1));
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(2));
+    queue.push(createSample(3));
+
+    std::vector<Timestamp> popped_times;
+    const auto callback = [&popped_times](const data_read_ptr<const IDataSample>& sample,
+                                          const data_read_ptr<const IStreamType>&) {
+        popped_times.push_back(sample ? sample->getTime() : Timestamp(-1));
+    };
+    // the stream type in front of the due samples does not stop the popping
+    EXPECT_EQ(queue.popUntil(Timestamp(3), std::less<Timestamp>{}, callback), 4u);
+    EXPECT_EQ(popped_times,
+              std::vector<Timestamp>({Timestamp(-1), Timestamp(1), Timestamp(-1), Timestamp(2)}));
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(3));
+
+    EXPECT_EQ(queue.popUntil(Timestamp(3), std::less<Timestamp>{}, callback), 0u);
+    EXPECT_EQ(queue.popUntil(Timestamp(10), std::less<Timestamp>{}, callback), 1u);
+    EXPECT_EQ(popped_times.back(), Timestamp(3));
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_EQ(queue.popUntil(Timestamp(10), std::less<Timestamp>{}, callback), 0u);
+}
+
+/**
+ * @detail Test that popUntil of the locked queue keeps the stream types behind the last due
+ * sample, as it pops all items within one lock
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(LockedDataItemQueueTest, testPopUntilKeepsTrailingStreamTypes)
+{
+    native::DataItemQueue<> queue(5);
+    queue.push(createSample(1));
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(4));
+
+    size_t popped_samples = 0;
+    const auto callback = [&popped_samples](const data_read_ptr<const IDataSample>& sample,
+                                            const data_read_ptr<const IStreamType>&) {
+        popped_samples += sample ? 1 : 0;
+    };
+    EXPECT_EQ(queue.popUntil(Timestamp(3), std::less<Timestamp>{}, callback), 1u);
+    EXPECT_EQ(popped_samples, 1u);
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_FALSE(queue.getFrontTime());
+}
+
+/**
+ * @detail Test that the consumer receives the items in order and receives the last item while one
+ * producer and one consumer thread contend for the queue.
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, testProducerConsumerContention)
+{
+    constexpr int64_t item_count = 10000;
+    TypeParam queue(16);
+
+    const auto result = runProducerConsumer(queue, item_count);
+
+    EXPECT_TRUE(result.order_kept);
+    EXPECT_EQ(result.last_time, item_count - 1);
+}
+
+/**
+ * @detail Benchmark one producer and one consumer thread contending for the queue.
+ * The measured throughput is recorded as test property but not asserted. The benchmark is
+ * disabled by default, run it with --gtest_also_run_disabled_tests.
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, DISABLED_benchmarkProducerConsumerContention)
+{
+    constexpr int64_t item_count = 200000;
+    TypeParam queue(16);
+
+    const auto begin = std::chrono::steady_clock::now();
+    const auto result = runProducerConsumer(queue, item_count);
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin);
+
+    EXPECT_TRUE(result.order_kept);
+    EXPECT_EQ(result.last_time, item_count - 1);
+    this->RecordProperty("duration_us", static_cast<int>(duration.count()));
+    this->RecordProperty("received_items", static_cast<int>(result.received_items));
+}
+
+/**
+ * @detail Test that the mailbox only keeps the newest sample and the newest stream type and that
+ * a sample does not drop a preceding stream type
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(MailboxDataItemQueueTest, testKeepNewest)
+{
+    native::MailboxDataItemQueue<> queue;
+    EXPECT_EQ(queue.capacity(), 1u);
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.getFrontTime());
+
+    queue.push(createSample(0));
+    queue.push(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>()));
+    queue.push(createSample(1));
+    queue.push(createSample(2));
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.getDropCount(), 2u);
+
+    EXPECT_FALSE(queue.getFrontTime());
+    const auto stream_type_item = queue.pop();
+    EXPECT_FALSE(std::get<0>(stream_type_item));
+    EXPECT_TRUE(std::get<1>(stream_type_item));
+
+    EXPECT_EQ(popTime(queue), Timestamp(2));
+    EXPECT_EQ(queue.size(), 0u);
+
+    queue.push(createSample(4));
+    queue.clear();
+    EXPECT_EQ(queue.size(), 0u);
+    const auto empty_item = queue.pop();
+    EXPECT_FALSE(std::get<0>(empty_item));
+    EXPECT_FALSE(std::get<1>(empty_item));
+}
+
+/**
+ * @detail Test that pop returns the sample whose time has been returned by getFrontTime even if a
+ * newer sample has been pushed meanwhile, and that the newer sample replaces it on the next
+ * getFrontTime only
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(MailboxDataItemQueueTest, testPeekedSampleIsPopped)
+{
+    native::MailboxDataItemQueue<> queue;
+
+    queue.push(createSample(0));
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(0));
+    EXPECT_FALSE(queue.tryPush(createSample(1)));
+
+    queue.push(createSample(2));
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_EQ(popTime(queue), Timestamp(0));
+    EXPECT_EQ(queue.size(), 1u);
+    EXPECT_FALSE(queue.tryPush(createSample(3)));
+
+    queue.push(createSample(4));
+    ASSERT_TRUE(queue.getFrontTime());
+    queue.push(createSample(5));
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(5));
+    EXPECT_EQ(popTime(queue), Timestamp(5));
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.getFrontTime());
+    EXPECT_EQ(queue.getDropCount(), 2u);
+}
+
+/**
+ * @detail Test that tryPush does not replace an item of the mailbox which has not been popped yet
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(MailboxDataItemQueueTest, testTryPushKeepsOldest)
+{
+    native::MailboxDataItemQueue<> queue;
+
+    EXPECT_TRUE(queue.tryPush(createSample(0)));
+    EXPECT_FALSE(queue.tryPush(createSample(1)));
+    EXPECT_TRUE(
+        queue.tryPush(data_read_ptr<const IStreamType>(std::make_shared<base::StreamTypeRaw>())));
+    EXPECT_EQ(queue.getDropCount(), 0u);
+
+    EXPECT_EQ(popTime(queue), Timestamp(0));
+    EXPECT_TRUE(queue.tryPush(createSample(1)));
+    EXPECT_TRUE(std::get<1>(queue.pop()));
+    EXPECT_EQ(popTime(queue), Timestamp(1));
+}
+
+/**
+ * @detail Test that the popped samples of several producers contending for the mailbox are
+ * newer than the previously popped sample of the same producer and that the consumer finally
+ * receives the last sample of every producer.
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(MailboxDataItemQueueTest, testProducersConsumerContention)
+{
+    constexpr int64_t producer_count = 3;
+    constexpr int64_t item_count = 100000;
+
+    native::MailboxDataItemQueue<> queue;
+    std::atomic<int64_t> producers_done{0};
+    std::vector<std::thread> producers;
+    for (int64_t producer = 0; producer < producer_count; ++producer) {
+        producers.emplace_back([&queue, &producers_done, producer]() {
+            // the time tells the producer (time % producer_count) and the order of its samples
+            for (int64_t index = 0; index < item_count; ++index) {
+                queue.push(createSample(index * producer_count + producer));
+            }
+            ++producers_done;
+        });
+    }
+
+    std::vector<int64_t> last_times(producer_count, -1);
+    bool order_kept = true;
+    for (;;) {
+        const bool done = producers_done == producer_count;
+        const auto time = popTime(queue).count();
+        if (time >= 0) {
+            auto& last_time = last_times[time % producer_count];
+            order_kept = order_kept && (time > last_time);
+            last_time = time;
+        }
+        else if (done && 0 == queue.size()) {
+            break;
+        }
+    }
+    for (auto& producer: producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(order_kept);
+    // all producers pushed their last sample, only the sample pushed last is guaranteed to be
+    // received
+    EXPECT_TRUE(std::any_of(last_times.cbegin(), last_times.cend(), [](int64_t time) {
+        return time >= (item_count - 1) * producer_count;
+    }));
+}
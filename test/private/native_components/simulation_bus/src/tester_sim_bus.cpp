@@ -15,11 +15,17 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #include <fep3/base/stream_type/default_stream_type.h>
 #include <fep3/base/stream_type/mock/mock_stream_type.h>
 #include <fep3/components/simulation_bus/mock_simulation_bus.h>
+#include <fep3/components/simulation_bus/simulation_bus_batch_intf.h>
+#include <fep3/components/simulation_bus/simulation_bus_loan_intf.h>
+#include <fep3/native_components/simulation_bus/lock_free_data_item_queue.h>
 #include <fep3/native_components/simulation_bus/simbus_datareader.h>
+#include <fep3/native_components/simulation_bus/simbus_datawriter.h>
 
+#include <cstring>
 #include <future>
 #include <gtest_asserts.h>
 #include <helper/gmock_async_helper.h>
+#include <thread>
 
 using namespace fep3;
 
@@ -173,6 +179,79 @@ TEST(NativeSimulationBus, testTransmission)
         ;
 }
 
+/**
+ * @detail Test that receivers added to a transmitter while another thread transmits neither make
+ * the existing receivers lose samples nor receive samples twice
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testAddReceiversWhileTransmitting)
+{
+    const int64_t sample_count = 10000;
+    const size_t added_receiver_count = 100;
+
+    native::SimulationBus::Transmitter transmitter;
+    auto existing_queue = std::make_shared<native::DataItemQueue<>>(sample_count);
+    transmitter.add(existing_queue);
+
+    std::thread transmit_thread([&transmitter]() {
+        for (int64_t time = 0; time < sample_count; ++time) {
+            auto sample = std::make_shared<base::DataSample>();
+            sample->setTime(Timestamp{time});
+            transmitter.transmit(data_read_ptr<const IDataSample>(sample));
+        }
+    });
+
+    std::vector<std::shared_ptr<native::DataItemQueue<>>> added_queues;
+    for (size_t index = 0; index < added_receiver_count; ++index) {
+        added_queues.push_back(std::make_shared<native::DataItemQueue<>>(sample_count));
+        transmitter.add(added_queues.back());
+    }
+    transmit_thread.join();
+
+    // the existing receiver got every sample exactly once and the added receivers got every
+    // sample transmitted after their registration exactly once
+    const auto check_received_in_order = [sample_count](native::DataItemQueue<>& queue,
+                                                        int64_t first_time) {
+        int64_t expected_time = first_time;
+        while (queue.size() > 0) {
+            const auto sample = std::get<0>(queue.pop());
+            ASSERT_TRUE(sample);
+            ASSERT_EQ(sample->getTime(), Timestamp{expected_time});
+            ++expected_time;
+        }
+        EXPECT_EQ(expected_time, sample_count);
+    };
+    EXPECT_EQ(existing_queue->size(), static_cast<size_t>(sample_count));
+    check_received_in_order(*existing_queue, 0);
+    for (const auto& added_queue : added_queues) {
+        check_received_in_order(*added_queue,
+                                sample_count - static_cast<int64_t>(added_queue->size()));
+    }
+}
+
+/**
+ * @detail Test that a transmitter with a receiver queue supporting a single producer only refuses
+ * a second writer, and refuses such a queue if there are several writers already
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testSingleProducerReceiverRefusesSecondWriter)
+{
+    native::SimulationBus::Transmitter transmitter;
+    ASSERT_TRUE(transmitter.addWriter());
+    ASSERT_TRUE(
+        transmitter.addSingleProducer(std::make_shared<native::LockFreeDataItemQueue<>>(2)));
+    EXPECT_FALSE(transmitter.addWriter());
+
+    transmitter.removeWriter();
+    EXPECT_TRUE(transmitter.addWriter());
+
+    native::SimulationBus::Transmitter shared_transmitter;
+    ASSERT_TRUE(shared_transmitter.addWriter());
+    ASSERT_TRUE(shared_transmitter.addWriter());
+    EXPECT_FALSE(
+        shared_transmitter.addSingleProducer(std::make_shared<native::LockFreeDataItemQueue<>>(2)));
+}
+
 /**
  * @detail Test overflow of reader queue. Test sample loss.
  * @req_id FEPSDK-SimulationBus
@@ -325,3 +404,485 @@ TEST_F(SimpleDataSample, testOverflowWriterQueue)
     while (reader->pop(receiver))
         ;
 }
+
+/**
+ * @detail Test that the data triggered reception delivers every sample of a burst which has been
+ * transmitted at once and samples which have been transmitted before the reception was started
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testDataTriggeredReceptionOfBurst)
+{
+    const std::string signal_name = "signal_burst";
+    const size_t queue_size = 10;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, queue_size);
+
+    const auto& receiver =
+        std::make_shared<::testing::StrictMock<fep3::mock::SimulationBus::DataReceiver>>();
+    reader->reset(receiver);
+
+    test::helper::Notification done;
+    {
+        ::testing::InSequence sequence;
+        for (uint32_t order = 0; order < queue_size - 1; ++order) {
+            EXPECT_CALL(*receiver.get(),
+                        call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                            mock::DataSampleSmartPtrMatcher(
+                                std::make_shared<DataSampleNumber>(order)))))
+                .WillOnce(::testing::Return());
+        }
+        EXPECT_CALL(*receiver.get(),
+                    call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                        mock::DataSampleSmartPtrMatcher(
+                            std::make_shared<DataSampleNumber>(queue_size - 1)))))
+            .WillOnce(Notify(&done));
+    }
+
+    // the first sample is transmitted before the reception has been started
+    writer->write(DataSampleNumber(0));
+    writer->transmit();
+
+    std::promise<void> blocking_reception_prepared;
+    auto blocking_reception_prepared_result = blocking_reception_prepared.get_future();
+    std::thread t1([sim_bus, &blocking_reception_prepared]() {
+        sim_bus->startBlockingReception(
+            [&blocking_reception_prepared]() { blocking_reception_prepared.set_value(); });
+    });
+    blocking_reception_prepared_result.get();
+
+    for (uint32_t order = 1; order < queue_size; ++order) {
+        writer->write(DataSampleNumber(order));
+    }
+    writer->transmit();
+
+    EXPECT_TRUE(done.waitForNotificationWithTimeout(std::chrono::seconds(3)));
+    sim_bus->stopBlockingReception();
+    t1.join();
+
+    reader->reset();
+}
+
+/**
+ * @detail Test that a loaned sample is transmitted to all readers without being copied
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLoanedSampleTransmission)
+{
+    const std::string signal_name = "signal_loan";
+    const uint32_t value = 42;
+
+    // a simulation bus instance provides only one reader per signal
+    auto sim_bus_1 = std::make_shared<fep3::native::SimulationBus>();
+    auto sim_bus_2 = std::make_shared<fep3::native::SimulationBus>();
+    auto reader_1 = sim_bus_1->getReader(signal_name);
+    auto reader_2 = sim_bus_2->getReader(signal_name);
+    auto writer = sim_bus_1->getWriter(signal_name);
+    ASSERT_TRUE(reader_1);
+    ASSERT_TRUE(reader_2);
+    auto loaning_writer = dynamic_cast<ILoaningDataWriter*>(writer.get());
+    ASSERT_NE(loaning_writer, nullptr);
+
+    auto loaned_sample = loaning_writer->loanSample(sizeof(value));
+    ASSERT_TRUE(loaned_sample);
+    ASSERT_GE(loaned_sample->getCapacity(), sizeof(value));
+    ASSERT_EQ(loaned_sample->getSize(), sizeof(value));
+    std::memcpy(loaned_sample->data(), &value, sizeof(value));
+    loaned_sample->setTime(Timestamp(1));
+    loaned_sample->setCounter(2);
+
+    ASSERT_FEP3_NOERROR(loaning_writer->commit(loaned_sample));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+
+    const IDataSample* const expected_sample = loaned_sample.get();
+    for (const auto& reader: {reader_1.get(), reader_2.get()}) {
+        ::testing::StrictMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+        EXPECT_CALL(receiver,
+                    call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                        mock::DataSampleSmartPtrValueMatcher(
+                            std::make_shared<DataSampleNumber>(value)))))
+            .WillOnce(::testing::Invoke([expected_sample](const data_read_ptr<const IDataSample>&
+                                                              sample) {
+                // the readers share the loaned memory
+                EXPECT_EQ(sample.get(), expected_sample);
+                EXPECT_EQ(sample->getTime(), Timestamp(1));
+                EXPECT_EQ(sample->getCounter(), 2u);
+            }));
+        EXPECT_TRUE(reader->pop(receiver));
+    }
+}
+
+/**
+ * @detail Test that the batched popUntil of a reader pops the due samples behind a stream type
+ * and keeps the samples which are not due yet
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testBatchedPopUntil)
+{
+    const std::string signal_name = "signal_batch";
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, 10);
+    auto writer = sim_bus->getWriter(signal_name, 10);
+    ASSERT_TRUE(reader);
+    auto batch_reader = dynamic_cast<ISimulationBusBatchReader*>(reader.get());
+    ASSERT_NE(batch_reader, nullptr);
+
+    ASSERT_FEP3_NOERROR(writer->write(base::StreamTypeRaw()));
+    for (int64_t time = 1; time <= 3; ++time) {
+        base::DataSample sample;
+        sample.setTime(Timestamp(time));
+        ASSERT_FEP3_NOERROR(writer->write(sample));
+    }
+    ASSERT_FEP3_NOERROR(writer->transmit());
+
+    ::testing::StrictMock<DataReceiver> receiver;
+    {
+        ::testing::InSequence sequence;
+        EXPECT_CALL(receiver, onStreamTypeReceived(::testing::_));
+        EXPECT_CALL(receiver, onSampleReceived(::testing::_)).Times(2);
+    }
+    EXPECT_EQ(batch_reader->popUntil(Timestamp(3), std::less<Timestamp>{}, receiver), 3u);
+    ASSERT_TRUE(reader->getFrontTime());
+    EXPECT_EQ(reader->getFrontTime().value(), Timestamp(3));
+}
+
+/**
+ * @detail Test that only samples loaned from the writer itself can be committed
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testCommitOfForeignLoanedSample)
+{
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto writer_1 = sim_bus->getWriter("signal_loan_1");
+    auto writer_2 = sim_bus->getWriter("signal_loan_2");
+    auto loaning_writer_1 = dynamic_cast<ILoaningDataWriter*>(writer_1.get());
+    auto loaning_writer_2 = dynamic_cast<ILoaningDataWriter*>(writer_2.get());
+    ASSERT_NE(loaning_writer_1, nullptr);
+    ASSERT_NE(loaning_writer_2, nullptr);
+
+    EXPECT_FEP3_RESULT(loaning_writer_1->commit(nullptr), ERR_POINTER);
+    EXPECT_FEP3_RESULT(loaning_writer_1->commit(loaning_writer_2->loanSample(4)), ERR_INVALID_ARG);
+    EXPECT_FEP3_NOERROR(loaning_writer_1->commit(loaning_writer_1->loanSample(4)));
+}
+
+/**
+ * @detail Test that written samples are recycled by the writer once all readers released them,
+ * so the number of allocations does not increase anymore in steady state
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testSamplePoolReachesSteadyState)
+{
+    const std::string signal_name = "signal_pool";
+    const size_t queue_size = 3;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, base::StreamTypeRaw(), queue_size);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    auto loaning_writer = dynamic_cast<ILoaningDataWriter*>(writer.get());
+    ASSERT_NE(loaning_writer, nullptr);
+
+    ::testing::NiceMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+    const auto writeAndReceive = [&](uint32_t order) {
+        for (size_t sample_index = 0; sample_index < queue_size; ++sample_index) {
+            ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(order)));
+        }
+        ASSERT_FEP3_NOERROR(loaning_writer->commit(loaning_writer->loanSample(sizeof(order))));
+        ASSERT_FEP3_NOERROR(writer->transmit());
+        while (reader->pop(receiver)) {
+        }
+    };
+
+    writeAndReceive(0);
+    const auto warm_statistics = native_writer->getSamplePoolStatistics();
+    EXPECT_GT(warm_statistics._allocations, 0u);
+
+    for (uint32_t order = 1; order < 10; ++order) {
+        writeAndReceive(order);
+    }
+    const auto steady_statistics = native_writer->getSamplePoolStatistics();
+    EXPECT_EQ(steady_statistics._allocations, warm_statistics._allocations);
+    EXPECT_GT(steady_statistics._recycles, warm_statistics._recycles);
+}
+
+/**
+ * @detail Test that a lossless writer does not drop items if the reader queue is full but fails
+ * the transmission, and transmits the remaining items once the reader made room
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLosslessWriterRejectsTransmissionToFullQueue)
+{
+    const std::string signal_name = "signal_lossless";
+    const size_t queue_size = 2;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, queue_size);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    native_writer->setLossless(std::chrono::nanoseconds(0));
+
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(0)));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(2)));
+    EXPECT_FEP3_RESULT(writer->transmit(), ERR_RESOURCE_IN_USE);
+    EXPECT_EQ(reader->size(), queue_size);
+
+    ::testing::StrictMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+    {
+        ::testing::InSequence sequence;
+        for (uint32_t order = 0; order < 3; ++order) {
+            EXPECT_CALL(receiver,
+                        call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                            mock::DataSampleSmartPtrMatcher(
+                                std::make_shared<DataSampleNumber>(order)))))
+                .Times(1);
+        }
+    }
+    EXPECT_TRUE(reader->pop(receiver));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    EXPECT_TRUE(reader->pop(receiver));
+    EXPECT_TRUE(reader->pop(receiver));
+    EXPECT_FALSE(reader->pop(receiver));
+
+    const auto statistics = native_writer->getCounters()->getStatistics(signal_name, queue_size);
+    EXPECT_EQ(statistics._rejections, 1u);
+}
+
+/**
+ * @detail Test that a lossless writer with a timeout blocks the transmission until the reader made
+ * room and that the stall is counted
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLosslessWriterBlocksUntilQueueHasRoom)
+{
+    const std::string signal_name = "signal_lossless_blocking";
+    const size_t queue_size = 1;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, queue_size);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    native_writer->setLossless(std::chrono::seconds(5));
+
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(0)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+
+    ::testing::NiceMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+    std::thread reader_thread([&reader, &receiver]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        reader->pop(receiver);
+    });
+
+    // the transmit buffer is full as well, so the write transmits the first sample
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(2)));
+    reader_thread.join();
+
+    const auto statistics = native_writer->getCounters()->getStatistics(signal_name, queue_size);
+    EXPECT_EQ(statistics._stalls, 1u);
+    EXPECT_EQ(statistics._rejections, 0u);
+}
+
+/**
+ * @detail Test that a lossless writer does not wait for the full queue of a reader which has been
+ * destroyed meanwhile
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLosslessWriterIgnoresDestroyedReader)
+{
+    const std::string signal_name = "signal_lossless_destroyed_reader";
+    const size_t queue_size = 2;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, queue_size);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    native_writer->setLossless(std::chrono::nanoseconds(0));
+
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(0)));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    ASSERT_EQ(reader->size(), queue_size);
+
+    reader.reset();
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(2)));
+    EXPECT_FEP3_NOERROR(writer->transmit());
+}
+
+/**
+ * @detail Test that a lossless writer does not wait for the full queue of a reader which has been
+ * destroyed after a transmission to it timed out
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLosslessWriterIgnoresReaderDestroyedAfterTimeout)
+{
+    const std::string signal_name = "signal_lossless_destroyed_pending_reader";
+    const size_t queue_size = 2;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, queue_size);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    native_writer->setLossless(std::chrono::milliseconds(10));
+
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(0)));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(2)));
+    EXPECT_FEP3_RESULT(writer->transmit(), ERR_TIMEOUT);
+
+    // the queue of the reader is still pending for the item which has not been transmitted
+    reader.reset();
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(3)));
+    EXPECT_FEP3_NOERROR(writer->transmit());
+}
+
+/**
+ * @detail Test that the simulation bus counts the samples, bytes and drops per reader and writer
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testSignalStatistics)
+{
+    const std::string signal_name = "signal_statistics";
+    const size_t queue_size = 2;
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name, queue_size);
+    auto writer = sim_bus->getWriter(signal_name, 3);
+
+    for (uint32_t order = 0; order < 3; ++order) {
+        ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(order)));
+    }
+    ASSERT_FEP3_NOERROR(writer->transmit());
+
+    const auto reader_statistics = sim_bus->getReaderStatistics();
+    ASSERT_EQ(reader_statistics.size(), 1u);
+    EXPECT_EQ(reader_statistics[0]._signal_name, signal_name);
+    EXPECT_EQ(reader_statistics[0]._queue_capacity, queue_size);
+    EXPECT_EQ(reader_statistics[0]._samples, 3u);
+    EXPECT_EQ(reader_statistics[0]._bytes, 3 * sizeof(uint32_t));
+    EXPECT_EQ(reader_statistics[0]._drops, 1u);
+    EXPECT_EQ(reader_statistics[0]._high_water_mark, queue_size);
+
+    const auto writer_statistics = sim_bus->getWriterStatistics();
+    ASSERT_EQ(writer_statistics.size(), 1u);
+    EXPECT_EQ(writer_statistics[0]._signal_name, signal_name);
+    EXPECT_EQ(writer_statistics[0]._queue_capacity, 3u);
+    EXPECT_EQ(writer_statistics[0]._samples, 3u);
+    EXPECT_EQ(writer_statistics[0]._drops, 0u);
+}
+
+/**
+ * @detail Test that a reader of capacity 1 receives the newest sample and keeps the stream type
+ * which has been transmitted before it
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLatestValueReader)
+{
+    const std::string signal_name = "signal_latest_value";
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    auto reader = sim_bus->getReader(signal_name);
+    auto writer = sim_bus->getWriter(signal_name, 3);
+    ASSERT_EQ(reader->capacity(), 1u);
+
+    ASSERT_FEP3_NOERROR(writer->write(base::StreamTypeRaw()));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(0)));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+
+    ::testing::StrictMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+    {
+        ::testing::InSequence sequence;
+        EXPECT_CALL(receiver,
+                    call(::testing::Matcher<const data_read_ptr<const IStreamType>&>(::testing::_)))
+            .Times(1);
+        EXPECT_CALL(receiver,
+                    call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                        mock::DataSampleSmartPtrMatcher(std::make_shared<DataSampleNumber>(1)))))
+            .Times(1);
+    }
+    EXPECT_TRUE(reader->pop(receiver));
+    EXPECT_TRUE(reader->pop(receiver));
+    EXPECT_FALSE(reader->pop(receiver));
+}
+
+/**
+ * @detail Test that the samples of a filtered reader are decimated, limited to a min interval and
+ * selected by a predicate on transmission, while stream types always pass
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testFilteredReader)
+{
+    const std::string signal_name = "signal_filtered";
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    IFilteringSimulationBus& filtering_sim_bus = *sim_bus;
+    SampleFilter filter;
+    filter._decimation_factor = 2;
+    filter._min_interval = Duration(30);
+    filter._predicate = [](const IDataSample& sample) { return sample.getTime() < Timestamp(200); };
+    auto reader = filtering_sim_bus.getReader(signal_name, 20, filter);
+    auto writer = sim_bus->getWriter(signal_name, 40);
+    ASSERT_TRUE(reader && writer);
+
+    ASSERT_FEP3_NOERROR(writer->write(base::StreamTypeRaw()));
+    // samples every 10 ns, every 2nd one passes the decimation, i.e. every 20 ns, of which only
+    // every 40 ns pass the min interval, up to 200 ns
+    for (uint32_t order = 0; order < 30; ++order) {
+        DataSampleNumber sample(order);
+        sample.setTime(Timestamp(order * 10));
+        ASSERT_FEP3_NOERROR(writer->write(sample));
+    }
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    EXPECT_EQ(reader->size(), 6u);
+
+    ::testing::StrictMock<fep3::mock::SimulationBus::DataReceiver> receiver;
+    {
+        ::testing::InSequence sequence;
+        EXPECT_CALL(receiver,
+                    call(::testing::Matcher<const data_read_ptr<const IStreamType>&>(::testing::_)))
+            .Times(1);
+        for (uint32_t order = 0; order < 20; order += 4) {
+            auto sample = std::make_shared<DataSampleNumber>(order);
+            sample->setTime(Timestamp(order * 10));
+            EXPECT_CALL(receiver,
+                        call(::testing::Matcher<const data_read_ptr<const IDataSample>&>(
+                            mock::DataSampleSmartPtrMatcher(sample))))
+                .Times(1);
+        }
+    }
+    while (reader->pop(receiver))
+        ;
+}
+
+/**
+ * @detail Test that a lossless writer does not wait for a full reader queue if the reader filters
+ * the sample anyway
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBus, testLosslessWriterSkipsFilteredReader)
+{
+    const std::string signal_name = "signal_lossless_filtered";
+
+    auto sim_bus = std::make_shared<fep3::native::SimulationBus>();
+    SampleFilter filter;
+    filter._predicate = [](const IDataSample& sample) { return sample.getSize() == 0; };
+    auto reader = sim_bus->getReader(signal_name, 1, filter);
+    auto writer = sim_bus->getWriter(signal_name, 2);
+    auto native_writer = dynamic_cast<native::SimulationBus::DataWriter*>(writer.get());
+    ASSERT_NE(native_writer, nullptr);
+    native_writer->setLossless(std::chrono::nanoseconds(0));
+
+    ASSERT_FEP3_NOERROR(writer->write(base::DataSample()));
+    ASSERT_FEP3_NOERROR(writer->write(DataSampleNumber(1)));
+    ASSERT_FEP3_NOERROR(writer->transmit());
+    EXPECT_EQ(reader->size(), 1u);
+}
@@ -0,0 +1,303 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/properties/propertynode_helper.h>
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/components/base/mock_components.h>
+#include <fep3/components/clock/mock_clock_service.h>
+#include <fep3/components/configuration/mock_configuration_service.h>
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/native_components/simulation_bus/data_item_queue.h>
+#include <fep3/native_components/simulation_bus/simulation_bus_player.h>
+
+#include <cstdio>
+#include <gtest_asserts.h>
+
+using namespace fep3;
+using namespace ::testing;
+
+using ComponentsMock = NiceMock<fep3::mock::Components>;
+using ConfigurationServiceComponentMock = NiceMock<fep3::mock::ConfigurationService>;
+using ClockServiceComponentMock = NiceMock<fep3::mock::arya::ClockService>;
+
+namespace {
+
+const std::string capture_file_path = "test_sim_bus_player.fep3cap";
+
+/**
+ * Records two signals, a stream type of signal_a and samples of both signals every 10 ns from 0
+ * to 90 ns, the value of a sample is its time (+ 1000 for signal_b)
+ */
+void recordCaptureFile()
+{
+    auto capture_file = native::CaptureFileWriter::create(capture_file_path, 1024 * 1024, 64);
+    ASSERT_TRUE(capture_file);
+    ASSERT_TRUE(capture_file->appendSignal(0, "signal_a"));
+    ASSERT_TRUE(capture_file->append(0, base::StreamTypePlain<uint32_t>()));
+    ASSERT_TRUE(capture_file->appendSignal(1, "signal_b"));
+    for (uint32_t time = 0; time < 100; time += 10) {
+        uint32_t value = time;
+        ASSERT_TRUE(capture_file->append(
+            0,
+            base::DataSample(
+                Timestamp(time), time / 10, base::RawMemoryStandardType<uint32_t>(value))));
+        value += 1000;
+        ASSERT_TRUE(capture_file->append(
+            1,
+            base::DataSample(
+                Timestamp(time), time / 10, base::RawMemoryStandardType<uint32_t>(value))));
+    }
+}
+
+uint32_t getValue(const IDataSample& sample)
+{
+    uint32_t value = 0;
+    base::RawMemoryStandardType<uint32_t> memory(value);
+    sample.read(memory);
+    return value;
+}
+
+/// Pops all samples of the queue and returns their values, stream types are counted only
+std::vector<uint32_t> popValues(native::DataItemQueue<>& queue,
+                                size_t* stream_type_count = nullptr)
+{
+    std::vector<uint32_t> values;
+    while (queue.size() > 0) {
+        const auto [sample, stream_type] = queue.pop();
+        if (sample) {
+            values.push_back(getValue(*sample));
+        }
+        else if (stream_type && stream_type_count) {
+            ++(*stream_type_count);
+        }
+    }
+    return values;
+}
+
+struct SimulationBusPlayerTest : public ::testing::Test {
+    void SetUp() override
+    {
+        ASSERT_NO_FATAL_FAILURE(recordCaptureFile());
+        _file = native::CaptureFileReader::open(capture_file_path);
+        ASSERT_TRUE(_file);
+        _transmitter_a->add(_queue_a);
+        _transmitter_b->add(_queue_b);
+    }
+
+    void TearDown() override
+    {
+        std::remove(capture_file_path.c_str());
+    }
+
+    std::unique_ptr<native::SimulationBusPlayer> createPlayer()
+    {
+        return std::make_unique<native::SimulationBusPlayer>(
+            _file, [&](const std::string& name) {
+                return name == "signal_a" ? _transmitter_a : _transmitter_b;
+            });
+    }
+
+    std::shared_ptr<const native::CaptureFileReader> _file;
+    std::shared_ptr<native::SimulationBus::Transmitter> _transmitter_a{
+        std::make_shared<native::SimulationBus::Transmitter>()};
+    std::shared_ptr<native::SimulationBus::Transmitter> _transmitter_b{
+        std::make_shared<native::SimulationBus::Transmitter>()};
+    std::shared_ptr<native::DataItemQueue<>> _queue_a{
+        std::make_shared<native::DataItemQueue<>>(100)};
+    std::shared_ptr<native::DataItemQueue<>> _queue_b{
+        std::make_shared<native::DataItemQueue<>>(100)};
+};
+
+} // namespace
+
+/**
+ * @detail Test that the player transmits the recorded stream types and samples up to the given
+ * time to the transmitters of the recorded signals
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusPlayerTest, testReplayUntil)
+{
+    auto player = createPlayer();
+
+    EXPECT_EQ(player->replayUntil(Timestamp(25)), 6u);
+    size_t stream_type_count = 0;
+    EXPECT_EQ(popValues(*_queue_a, &stream_type_count), std::vector<uint32_t>({0, 10, 20}));
+    EXPECT_EQ(stream_type_count, 1u);
+    EXPECT_EQ(popValues(*_queue_b), std::vector<uint32_t>({1000, 1010, 1020}));
+
+    EXPECT_EQ(player->replayUntil(Timestamp(30)), 2u);
+    EXPECT_EQ(popValues(*_queue_a), std::vector<uint32_t>({30}));
+
+    EXPECT_EQ(player->replayUntil(Timestamp(1000)), 12u);
+    EXPECT_EQ(popValues(*_queue_a).size(), 6u);
+    EXPECT_EQ(player->replayUntil(Timestamp(2000)), 0u);
+}
+
+/**
+ * @detail Test that the player seeks to any time forward and backward and transmits the stream
+ * types valid at that time again
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusPlayerTest, testSeek)
+{
+    auto player = createPlayer();
+
+    player->seek(Timestamp(45));
+    size_t stream_type_count = 0;
+    EXPECT_TRUE(popValues(*_queue_a, &stream_type_count).empty());
+    EXPECT_EQ(stream_type_count, 1u);
+    EXPECT_EQ(player->replayUntil(Timestamp(60)), 4u);
+    EXPECT_EQ(popValues(*_queue_a), std::vector<uint32_t>({50, 60}));
+    EXPECT_EQ(popValues(*_queue_b), std::vector<uint32_t>({1050, 1060}));
+
+    player->seek(Timestamp(10));
+    EXPECT_EQ(player->replayUntil(Timestamp(10)), 2u);
+    EXPECT_EQ(popValues(*_queue_a), std::vector<uint32_t>({10}));
+
+    player->seek(Timestamp(500));
+    EXPECT_EQ(player->replayUntil(Timestamp(1000)), 0u);
+}
+
+/**
+ * @detail Test that the replayed samples stay valid after the player has been destroyed
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusPlayerTest, testSamplesOutlivePlayer)
+{
+    auto player = createPlayer();
+    player->replayUntil(Timestamp(0));
+    player.reset();
+    _file.reset();
+
+    EXPECT_EQ(popValues(*_queue_a), std::vector<uint32_t>({0}));
+}
+
+/**
+ * @detail Test that the player ignores signal ids beyond the number of signal records of a corrupt
+ * capture file instead of allocating a transmitter for each possible id
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusPlayerTest, testIgnoreCorruptSignalId)
+{
+    constexpr uint32_t corrupt_signal_id = 0xFFFFFFF0;
+    // the file recorded by the fixture is replaced
+    _file.reset();
+    {
+        auto capture_file = native::CaptureFileWriter::create(capture_file_path, 64 * 1024, 64);
+        ASSERT_TRUE(capture_file);
+        ASSERT_TRUE(capture_file->appendSignal(0, "signal_a"));
+        ASSERT_TRUE(capture_file->appendSignal(corrupt_signal_id, "signal_b"));
+        uint32_t value = 0;
+        ASSERT_TRUE(capture_file->append(
+            0, base::DataSample(Timestamp(0), 0, base::RawMemoryStandardType<uint32_t>(value))));
+        ASSERT_TRUE(capture_file->append(
+            corrupt_signal_id,
+            base::DataSample(Timestamp(0), 0, base::RawMemoryStandardType<uint32_t>(value))));
+    }
+    _file = native::CaptureFileReader::open(capture_file_path);
+    ASSERT_TRUE(_file);
+
+    auto player = createPlayer();
+    EXPECT_EQ(player->replayUntil(Timestamp(0)), 2u);
+    EXPECT_EQ(popValues(*_queue_a), std::vector<uint32_t>({0}));
+    EXPECT_TRUE(popValues(*_queue_b).empty());
+}
+
+/**
+ * @detail Test that the native simulation bus replays the configured replay file following the
+ * time resets and updates of the clock
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBusReplay, testReplayFollowingClock)
+{
+    ASSERT_NO_FATAL_FAILURE(recordCaptureFile());
+
+    auto components = std::make_shared<ComponentsMock>();
+    auto configuration_service = std::make_shared<ConfigurationServiceComponentMock>();
+    auto clock_service = std::make_shared<ClockServiceComponentMock>();
+    auto simulation_bus = std::make_shared<fep3::native::SimulationBus>();
+    std::shared_ptr<fep3::IPropertyNode> property_node;
+    std::weak_ptr<fep3::arya::IClock::IEventSink> event_sink;
+
+    EXPECT_CALL(*components, findComponent(configuration_service->getComponentIID()))
+        .WillRepeatedly(Return(configuration_service.get()));
+    EXPECT_CALL(*components, findComponent(fep3::getComponentIID<fep3::IServiceBus>()))
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*components, findComponent(fep3::getComponentIID<fep3::arya::IClockService>()))
+        .WillRepeatedly(Return(clock_service.get()));
+    EXPECT_CALL(*configuration_service, registerNode(_))
+        .WillOnce(DoAll(SaveArg<0>(&property_node), Return(fep3::Result())));
+    EXPECT_CALL(*clock_service, registerEventSink(_))
+        .WillOnce(DoAll(SaveArg<0>(&event_sink), Return(fep3::Result())));
+    EXPECT_CALL(*clock_service, unregisterEventSink(_)).WillOnce(Return(fep3::Result()));
+
+    ASSERT_FEP3_NOERROR(simulation_bus->createComponent(components));
+    ASSERT_TRUE(property_node);
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+        *property_node->getChild(FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY), capture_file_path));
+    ASSERT_FEP3_NOERROR(simulation_bus->initialize());
+    auto reader = simulation_bus->getReader("signal_b", 100);
+    ASSERT_TRUE(reader);
+
+    const auto sink = event_sink.lock();
+    ASSERT_TRUE(sink);
+    sink->timeResetBegin(Timestamp(0), Timestamp(20));
+    sink->timeResetEnd(Timestamp(20));
+    EXPECT_EQ(reader->size(), 1u);
+    sink->timeUpdateBegin(Timestamp(20), Timestamp(50));
+    sink->timeUpdating(Timestamp(50));
+    sink->timeUpdateEnd(Timestamp(50));
+    EXPECT_EQ(reader->size(), 4u);
+
+    ASSERT_FEP3_NOERROR(simulation_bus->deinitialize());
+    ASSERT_FEP3_NOERROR(simulation_bus->destroyComponent());
+    std::remove(capture_file_path.c_str());
+}
+
+/**
+ * @detail Test that the native simulation bus rejects replaying a file in combination with
+ * lock-free readers, which do not support the player as additional writer
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(NativeSimulationBusReplay, testReplayRejectsLockFreeReaders)
+{
+    ASSERT_NO_FATAL_FAILURE(recordCaptureFile());
+
+    auto components = std::make_shared<ComponentsMock>();
+    auto configuration_service = std::make_shared<ConfigurationServiceComponentMock>();
+    auto clock_service = std::make_shared<ClockServiceComponentMock>();
+    auto simulation_bus = std::make_shared<fep3::native::SimulationBus>();
+    std::shared_ptr<fep3::IPropertyNode> property_node;
+
+    EXPECT_CALL(*components, findComponent(configuration_service->getComponentIID()))
+        .WillRepeatedly(Return(configuration_service.get()));
+    EXPECT_CALL(*components, findComponent(fep3::getComponentIID<fep3::IServiceBus>()))
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*components, findComponent(fep3::getComponentIID<fep3::arya::IClockService>()))
+        .WillRepeatedly(Return(clock_service.get()));
+    EXPECT_CALL(*configuration_service, registerNode(_))
+        .WillOnce(DoAll(SaveArg<0>(&property_node), Return(fep3::Result())));
+    EXPECT_CALL(*clock_service, registerEventSink(_)).Times(0);
+
+    ASSERT_FEP3_NOERROR(simulation_bus->createComponent(components));
+    ASSERT_TRUE(property_node);
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+        *property_node->getChild(FEP3_NATIVE_SIMBUS_REPLAY_FILE_PROPERTY), capture_file_path));
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::vector<std::string>>(
+        *property_node->getChild(FEP3_NATIVE_SIMBUS_LOCK_FREE_READER_SIGNALS_PROPERTY),
+        {"signal_b"}));
+    EXPECT_FEP3_RESULT(simulation_bus->initialize(), ERR_NOT_SUPPORTED);
+
+    ASSERT_FEP3_NOERROR(simulation_bus->destroyComponent());
+    std::remove(capture_file_path.c_str());
+}
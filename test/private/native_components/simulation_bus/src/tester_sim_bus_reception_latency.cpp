@@ -0,0 +1,412 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/properties/propertynode_helper.h>
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/components/base/mock_components.h>
+#include <fep3/components/configuration/mock_configuration_service.h>
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/native_components/simulation_bus/simulation_bus.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <gtest_asserts.h>
+#include <numeric>
+#include <stdexcept>
+
+using namespace ::testing;
+using namespace std::chrono;
+
+using ComponentsMock = NiceMock<fep3::mock::Components>;
+using ConfigurationServiceComponentMock = NiceMock<fep3::mock::ConfigurationService>;
+
+namespace {
+
+/**
+ * Receiver which hands the reception time of the last sample over to the writing thread
+ */
+class LatencyReceiver : public fep3::ISimulationBus::IDataReceiver {
+public:
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+    {
+    }
+
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>&) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _reception_time = steady_clock::now();
+            ++_received_samples;
+        }
+        _condition.notify_one();
+    }
+
+    bool waitForSample(size_t sample_count, steady_clock::time_point& reception_time)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        const auto received = _condition.wait_for(
+            lock, seconds(1), [&]() { return _received_samples >= sample_count; });
+        reception_time = _reception_time;
+        return received;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    steady_clock::time_point _reception_time;
+    size_t _received_samples{0};
+};
+
+/**
+ * Receiver which records the times of the received samples
+ */
+class OrderReceiver : public fep3::ISimulationBus::IDataReceiver {
+public:
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+    {
+    }
+
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>& sample) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _times.push_back(sample->getTime());
+        }
+        _condition.notify_one();
+    }
+
+    std::vector<fep3::Timestamp> waitForSamples(size_t sample_count)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait_for(lock, seconds(1), [&]() { return _times.size() >= sample_count; });
+        return _times;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<fep3::Timestamp> _times;
+};
+
+/**
+ * Receiver which blocks the reception of a sample until it is released
+ */
+class BlockingReceiver : public fep3::ISimulationBus::IDataReceiver {
+public:
+    BlockingReceiver()
+        : _entered_result(_entered.get_future()), _released(_release.get_future().share())
+    {
+    }
+
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+    {
+    }
+
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>&) override
+    {
+        _entered.set_value();
+        _released.wait();
+    }
+
+    bool waitUntilEntered(std::chrono::milliseconds timeout)
+    {
+        return _entered_result.wait_for(timeout) == std::future_status::ready;
+    }
+
+    void release()
+    {
+        _release.set_value();
+    }
+
+private:
+    std::promise<void> _entered;
+    std::future<void> _entered_result;
+    std::promise<void> _release;
+    std::shared_future<void> _released;
+};
+
+/**
+ * Receiver which throws on the reception of a sample
+ */
+class ThrowingReceiver : public fep3::ISimulationBus::IDataReceiver {
+public:
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+    {
+    }
+
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>&) override
+    {
+        throw std::runtime_error("receiver failed");
+    }
+};
+
+struct NativeSimulationBusReceptionLatency : public ::testing::TestWithParam<bool> {
+    NativeSimulationBusReceptionLatency()
+        : _components(std::make_shared<ComponentsMock>()),
+          _configuration_service(std::make_shared<ConfigurationServiceComponentMock>()),
+          _simulation_bus(std::make_shared<fep3::native::SimulationBus>())
+    {
+    }
+
+    void SetUp() override
+    {
+        EXPECT_CALL(*_components, findComponent(_configuration_service->getComponentIID()))
+            .WillRepeatedly(Return(_configuration_service.get()));
+        EXPECT_CALL(*_components, findComponent(fep3::getComponentIID<fep3::IServiceBus>()))
+            .WillRepeatedly(Return(nullptr));
+        EXPECT_CALL(*_configuration_service, registerNode(_))
+            .WillOnce(DoAll(WithArg<0>(Invoke([&](const std::shared_ptr<fep3::IPropertyNode>& node) {
+                                _simulation_bus_property_node = node;
+                            })),
+                            Return(fep3::Result())));
+
+        ASSERT_FEP3_NOERROR(_simulation_bus->createComponent(_components));
+        ASSERT_TRUE(_simulation_bus_property_node);
+        ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<bool>(
+            *_simulation_bus_property_node->getChild(
+                FEP3_NATIVE_SIMBUS_USE_POLLING_RECEPTION_PROPERTY),
+            GetParam()));
+    }
+
+    void TearDown() override
+    {
+        ASSERT_FEP3_NOERROR(_simulation_bus->destroyComponent());
+    }
+
+    std::shared_ptr<ComponentsMock> _components;
+    std::shared_ptr<ConfigurationServiceComponentMock> _configuration_service;
+    std::shared_ptr<fep3::native::SimulationBus> _simulation_bus;
+    std::shared_ptr<fep3::IPropertyNode> _simulation_bus_property_node;
+};
+
+} // namespace
+
+/**
+ * @detail Measure the latency between transmitting a sample and its reception within the data
+ * triggered reception for both the polling and the event driven reception mode.
+ * This is a benchmark only, the measured latencies are recorded as test properties but not
+ * asserted. It is disabled by default, run it with --gtest_also_run_disabled_tests.
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_P(NativeSimulationBusReceptionLatency, DISABLED_measureWriteToReceiveLatency)
+{
+    constexpr size_t sample_count = 500;
+    const std::string signal_name = "latency_signal";
+    const fep3::base::DataSample sample(0, true);
+
+    auto reader = _simulation_bus->getReader(signal_name, sample_count);
+    auto writer = _simulation_bus->getWriter(signal_name, sample_count);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    const auto receiver = std::make_shared<LatencyReceiver>();
+    reader->reset(receiver);
+
+    std::promise<void> blocking_reception_prepared;
+    auto blocking_reception_prepared_result = blocking_reception_prepared.get_future();
+    std::thread reception_thread([this, &blocking_reception_prepared]() {
+        _simulation_bus->startBlockingReception(
+            [&blocking_reception_prepared]() { blocking_reception_prepared.set_value(); });
+    });
+    blocking_reception_prepared_result.get();
+
+    std::vector<microseconds> latencies;
+    latencies.reserve(sample_count);
+    for (size_t sample_index = 1; sample_index <= sample_count; ++sample_index) {
+        const auto transmission_time = steady_clock::now();
+        writer->write(sample);
+        writer->transmit();
+
+        steady_clock::time_point reception_time;
+        if (!receiver->waitForSample(sample_index, reception_time)) {
+            break;
+        }
+        latencies.push_back(duration_cast<microseconds>(reception_time - transmission_time));
+    }
+
+    _simulation_bus->stopBlockingReception();
+    reception_thread.join();
+    reader->reset();
+
+    ASSERT_EQ(latencies.size(), sample_count);
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto mean =
+        std::accumulate(latencies.begin(), latencies.end(), microseconds{0}) / latencies.size();
+    const auto median = latencies[latencies.size() / 2];
+    const auto max = latencies.back();
+
+    RecordProperty("mean_latency_us", static_cast<int>(mean.count()));
+    RecordProperty("median_latency_us", static_cast<int>(median.count()));
+    RecordProperty("max_latency_us", static_cast<int>(max.count()));
+}
+
+INSTANTIATE_TEST_SUITE_P(ReceptionMode,
+                         NativeSimulationBusReceptionLatency,
+                         ::testing::Values(true, false),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                             return info.param ? "Polling" : "EventDriven";
+                         });
+
+struct NativeSimulationBusDispatchThreads : public NativeSimulationBusReceptionLatency {
+};
+
+/**
+ * @detail Test that the event driven reception dispatches the readers on several threads if
+ * configured by property, so a blocking receiver of one signal does not delay the reception of
+ * another signal, and that the samples of a signal are still received in order.
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_P(NativeSimulationBusDispatchThreads, blockingReceiverDoesNotDelayOtherSignals)
+{
+    constexpr size_t sample_count = 20;
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<int32_t>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY),
+        2));
+
+    auto blocked_reader = _simulation_bus->getReader("blocked_signal", sample_count);
+    auto blocked_writer = _simulation_bus->getWriter("blocked_signal", sample_count);
+    auto ordered_reader = _simulation_bus->getReader("ordered_signal", sample_count);
+    auto ordered_writer = _simulation_bus->getWriter("ordered_signal", sample_count);
+    ASSERT_TRUE(blocked_reader && blocked_writer && ordered_reader && ordered_writer);
+
+    const auto blocking_receiver = std::make_shared<BlockingReceiver>();
+    const auto order_receiver = std::make_shared<OrderReceiver>();
+    blocked_reader->reset(blocking_receiver);
+    ordered_reader->reset(order_receiver);
+
+    std::promise<void> blocking_reception_prepared;
+    auto blocking_reception_prepared_result = blocking_reception_prepared.get_future();
+    std::thread reception_thread([this, &blocking_reception_prepared]() {
+        _simulation_bus->startBlockingReception(
+            [&blocking_reception_prepared]() { blocking_reception_prepared.set_value(); });
+    });
+    blocking_reception_prepared_result.get();
+
+    fep3::base::DataSample sample(0, true);
+    blocked_writer->write(sample);
+    blocked_writer->transmit();
+    const bool blocking_receiver_entered =
+        blocking_receiver->waitUntilEntered(std::chrono::seconds(5));
+    for (size_t sample_index = 0; sample_index < sample_count; ++sample_index) {
+        sample.setTime(fep3::Timestamp(sample_index));
+        ordered_writer->write(sample);
+        ordered_writer->transmit();
+    }
+
+    const auto received_times = order_receiver->waitForSamples(sample_count);
+    blocking_receiver->release();
+
+    _simulation_bus->stopBlockingReception();
+    reception_thread.join();
+    blocked_reader->reset();
+    ordered_reader->reset();
+
+    EXPECT_TRUE(blocking_receiver_entered);
+    ASSERT_EQ(received_times.size(), sample_count);
+    for (size_t sample_index = 0; sample_index < sample_count; ++sample_index) {
+        EXPECT_EQ(received_times[sample_index], fep3::Timestamp(sample_index));
+    }
+}
+
+/**
+ * @detail Test that an exception thrown by a receiver dispatched by another thread than the one
+ * calling startBlockingReception stops the reception and is rethrown by startBlockingReception
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_P(NativeSimulationBusDispatchThreads, exceptionOfDispatchThreadIsRethrown)
+{
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<int32_t>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY),
+        2));
+
+    // the readers are distributed round robin, so the second one is dispatched by another thread
+    auto calling_thread_reader = _simulation_bus->getReader("calling_thread_signal");
+    auto dispatch_thread_reader = _simulation_bus->getReader("dispatch_thread_signal");
+    auto dispatch_thread_writer = _simulation_bus->getWriter("dispatch_thread_signal");
+    ASSERT_TRUE(calling_thread_reader && dispatch_thread_reader && dispatch_thread_writer);
+    calling_thread_reader->reset(std::make_shared<OrderReceiver>());
+    dispatch_thread_reader->reset(std::make_shared<ThrowingReceiver>());
+
+    std::promise<void> blocking_reception_prepared;
+    auto blocking_reception_prepared_result = blocking_reception_prepared.get_future();
+    auto reception_result = std::async(std::launch::async, [this, &blocking_reception_prepared]() {
+        _simulation_bus->startBlockingReception(
+            [&blocking_reception_prepared]() { blocking_reception_prepared.set_value(); });
+    });
+    blocking_reception_prepared_result.get();
+
+    dispatch_thread_writer->write(fep3::base::DataSample(0, true));
+    dispatch_thread_writer->transmit();
+
+    const auto reception_status = reception_result.wait_for(std::chrono::seconds(5));
+    _simulation_bus->stopBlockingReception();
+    ASSERT_EQ(reception_status, std::future_status::ready);
+    EXPECT_THROW(reception_result.get(), std::runtime_error);
+    calling_thread_reader->reset();
+    dispatch_thread_reader->reset();
+}
+
+/**
+ * @detail Test that the reception may be started again after an exception of a dispatch thread has
+ * been rethrown without stopping the reception explicitly
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_P(NativeSimulationBusDispatchThreads, receptionRestartsAfterException)
+{
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<int32_t>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_DISPATCH_THREADS_PROPERTY),
+        2));
+
+    auto calling_thread_reader = _simulation_bus->getReader("calling_thread_signal");
+    auto dispatch_thread_reader = _simulation_bus->getReader("dispatch_thread_signal");
+    auto dispatch_thread_writer = _simulation_bus->getWriter("dispatch_thread_signal");
+    ASSERT_TRUE(calling_thread_reader && dispatch_thread_reader && dispatch_thread_writer);
+    calling_thread_reader->reset(std::make_shared<OrderReceiver>());
+    dispatch_thread_reader->reset(std::make_shared<ThrowingReceiver>());
+
+    const auto start_reception = [this]() {
+        std::promise<void> blocking_reception_prepared;
+        auto blocking_reception_prepared_result = blocking_reception_prepared.get_future();
+        auto reception_result =
+            std::async(std::launch::async, [this, &blocking_reception_prepared]() {
+                _simulation_bus->startBlockingReception(
+                    [&blocking_reception_prepared]() { blocking_reception_prepared.set_value(); });
+            });
+        blocking_reception_prepared_result.get();
+        return reception_result;
+    };
+
+    auto reception_result = start_reception();
+    dispatch_thread_writer->write(fep3::base::DataSample(0, true));
+    dispatch_thread_writer->transmit();
+    ASSERT_EQ(reception_result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_THROW(reception_result.get(), std::runtime_error);
+
+    // the reception keeps running until it is stopped
+    auto restarted_reception_result = start_reception();
+    EXPECT_EQ(restarted_reception_result.wait_for(std::chrono::milliseconds(100)),
+              std::future_status::timeout);
+    _simulation_bus->stopBlockingReception();
+    ASSERT_EQ(restarted_reception_result.wait_for(std::chrono::seconds(5)),
+              std::future_status::ready);
+    EXPECT_NO_THROW(restarted_reception_result.get());
+    calling_thread_reader->reset();
+    dispatch_thread_reader->reset();
+}
+
+INSTANTIATE_TEST_SUITE_P(ReceptionMode,
+                         NativeSimulationBusDispatchThreads,
+                         ::testing::Values(false),
+                         [](const ::testing::TestParamInfo<bool>&) { return "EventDriven"; });
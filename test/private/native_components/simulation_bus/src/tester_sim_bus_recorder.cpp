@@ -0,0 +1,310 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/properties/propertynode_helper.h>
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/default_stream_type.h>
+#include <fep3/components/base/mock_components.h>
+#include <fep3/components/configuration/mock_configuration_service.h>
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/native_components/simulation_bus/simulation_bus.h>
+#include <fep3/native_components/simulation_bus/simulation_bus_recorder.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <gtest_asserts.h>
+
+using namespace fep3;
+using namespace ::testing;
+
+using ComponentsMock = NiceMock<fep3::mock::Components>;
+using ConfigurationServiceComponentMock = NiceMock<fep3::mock::ConfigurationService>;
+
+namespace {
+
+const std::string capture_file_path = "test_sim_bus_recorder.fep3cap";
+
+data_read_ptr<const IDataSample> createSample(int64_t time, uint32_t counter, uint32_t value)
+{
+    auto sample = std::make_shared<base::DataSample>();
+    sample->setTime(Timestamp(time));
+    sample->setCounter(counter);
+    sample->write(base::RawMemoryStandardType<uint32_t>(value));
+    return sample;
+}
+
+uint32_t getValue(const native::CaptureRecord& record)
+{
+    uint32_t value = 0;
+    std::memcpy(&value, record._data, std::min(record._size, sizeof(value)));
+    return value;
+}
+
+void overwriteHeaderField(size_t field_offset, uint64_t value)
+{
+    std::fstream file(capture_file_path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(field_offset));
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+struct SimulationBusRecorderTest : public ::testing::Test {
+    void TearDown() override
+    {
+        std::remove(capture_file_path.c_str());
+    }
+};
+
+struct NativeSimulationBusRecording : public SimulationBusRecorderTest {
+    NativeSimulationBusRecording()
+        : _components(std::make_shared<ComponentsMock>()),
+          _configuration_service(std::make_shared<ConfigurationServiceComponentMock>()),
+          _simulation_bus(std::make_shared<fep3::native::SimulationBus>())
+    {
+    }
+
+    void SetUp() override
+    {
+        EXPECT_CALL(*_components, findComponent(_configuration_service->getComponentIID()))
+            .WillRepeatedly(Return(_configuration_service.get()));
+        EXPECT_CALL(*_components, findComponent(fep3::getComponentIID<fep3::IServiceBus>()))
+            .WillRepeatedly(Return(nullptr));
+        EXPECT_CALL(*_configuration_service, registerNode(_))
+            .WillOnce(DoAll(WithArg<0>(Invoke([&](const std::shared_ptr<fep3::IPropertyNode>& node) {
+                                _simulation_bus_property_node = node;
+                            })),
+                            Return(fep3::Result())));
+
+        ASSERT_FEP3_NOERROR(_simulation_bus->createComponent(_components));
+        ASSERT_TRUE(_simulation_bus_property_node);
+    }
+
+    void TearDown() override
+    {
+        ASSERT_FEP3_NOERROR(_simulation_bus->destroyComponent());
+        SimulationBusRecorderTest::TearDown();
+    }
+
+    std::shared_ptr<ComponentsMock> _components;
+    std::shared_ptr<ConfigurationServiceComponentMock> _configuration_service;
+    std::shared_ptr<fep3::native::SimulationBus> _simulation_bus;
+    std::shared_ptr<fep3::IPropertyNode> _simulation_bus_property_node;
+};
+
+} // namespace
+
+/**
+ * @detail Test that the recorder writes the signal names, stream types and samples of several
+ * signals to the capture file in the order they have been pushed and indexes the samples
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusRecorderTest, testRecordSignals)
+{
+    {
+        auto capture_file = native::CaptureFileWriter::create(capture_file_path, 1024 * 1024, 64);
+        ASSERT_TRUE(capture_file);
+        native::SimulationBusRecorder recorder(std::move(capture_file));
+        auto signal_a = recorder.createSignalQueue("signal_a");
+        auto signal_b = recorder.createSignalQueue("signal_b");
+
+        signal_a->push(data_read_ptr<const IStreamType>(
+            std::make_shared<base::StreamTypePlain<uint32_t>>()));
+        for (uint32_t index = 0; index < 10; ++index) {
+            signal_a->push(createSample(index * 10, index, index));
+            signal_b->push(createSample(index * 10 + 5, index, index + 100));
+        }
+        recorder.sync();
+        EXPECT_EQ(recorder.getOverflowCount(), 0u);
+    }
+
+    const auto reader = native::CaptureFileReader::open(capture_file_path);
+    ASSERT_TRUE(reader);
+    // 2 signal records, 1 stream type record, 20 sample records
+    EXPECT_EQ(reader->getRecordCount(), 23u);
+    EXPECT_EQ(reader->getOverflowCount(), 0u);
+    EXPECT_GT(reader->getHeader()._index_count.load(), 1u);
+
+    uint64_t offset = 0;
+    native::CaptureRecord record;
+    ASSERT_TRUE(reader->read(offset, record));
+    EXPECT_EQ(record._type, native::CaptureRecordType::signal);
+    EXPECT_EQ(record._signal_id, 0u);
+    EXPECT_STREQ(reinterpret_cast<const char*>(record._data), "signal_a");
+
+    ASSERT_TRUE(reader->read(offset, record));
+    EXPECT_EQ(record._type, native::CaptureRecordType::stream_type);
+    const auto stream_type = native::toStreamType(record);
+    ASSERT_TRUE(stream_type);
+    EXPECT_TRUE(*stream_type == base::StreamTypePlain<uint32_t>());
+
+    for (uint32_t index = 0; index < 10; ++index) {
+        ASSERT_TRUE(reader->read(offset, record));
+        EXPECT_EQ(record._type, native::CaptureRecordType::sample);
+        EXPECT_EQ(record._signal_id, 0u);
+        EXPECT_EQ(record._time, Timestamp(index * 10));
+        EXPECT_EQ(record._counter, index);
+        EXPECT_EQ(getValue(record), index);
+
+        if (index == 0) {
+            ASSERT_TRUE(reader->read(offset, record));
+            EXPECT_EQ(record._type, native::CaptureRecordType::signal);
+            EXPECT_EQ(record._signal_id, 1u);
+            EXPECT_STREQ(reinterpret_cast<const char*>(record._data), "signal_b");
+        }
+
+        ASSERT_TRUE(reader->read(offset, record));
+        EXPECT_EQ(record._type, native::CaptureRecordType::sample);
+        EXPECT_EQ(record._signal_id, 1u);
+        EXPECT_EQ(record._time, Timestamp(index * 10 + 5));
+        EXPECT_EQ(getValue(record), index + 100);
+    }
+    EXPECT_FALSE(reader->read(offset, record));
+}
+
+/**
+ * @detail Test that items which do not fit into the capture file are counted as overflow
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusRecorderTest, testFileOverflow)
+{
+    constexpr uint32_t item_count = 100;
+    {
+        auto capture_file = native::CaptureFileWriter::create(capture_file_path, 1024, 64);
+        ASSERT_TRUE(capture_file);
+        native::SimulationBusRecorder recorder(std::move(capture_file));
+        auto signal = recorder.createSignalQueue("signal");
+        for (uint32_t index = 0; index < item_count; ++index) {
+            signal->push(createSample(index, index, index));
+        }
+        recorder.sync();
+        EXPECT_GT(recorder.getOverflowCount(), 0u);
+    }
+
+    const auto reader = native::CaptureFileReader::open(capture_file_path);
+    ASSERT_TRUE(reader);
+    // the signal record is recorded in addition to the samples
+    EXPECT_EQ(reader->getRecordCount() - 1 + reader->getOverflowCount(), item_count);
+
+    uint64_t offset = 0;
+    native::CaptureRecord record;
+    uint64_t record_count = 0;
+    while (reader->read(offset, record)) {
+        ++record_count;
+    }
+    EXPECT_EQ(record_count, reader->getRecordCount());
+}
+
+/**
+ * @detail Test that pushing to a full ring does not block but counts the dropped items
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusRecorderTest, testRingOverflow)
+{
+    constexpr uint32_t item_count = 10000;
+    uint64_t overflow_count = 0;
+    {
+        auto capture_file = native::CaptureFileWriter::create(capture_file_path, 4 * 1024 * 1024);
+        ASSERT_TRUE(capture_file);
+        native::SimulationBusRecorder recorder(std::move(capture_file), 2);
+        auto signal = recorder.createSignalQueue("signal");
+        for (uint32_t index = 0; index < item_count; ++index) {
+            EXPECT_TRUE(signal->tryPush(createSample(index, index, index)));
+        }
+        recorder.sync();
+        overflow_count = recorder.getOverflowCount();
+    }
+
+    const auto reader = native::CaptureFileReader::open(capture_file_path);
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(reader->getOverflowCount(), overflow_count);
+    EXPECT_EQ(reader->getRecordCount() - 1 + overflow_count, item_count);
+}
+
+/**
+ * @detail Test that a capture file whose header refers to memory outside of its areas is rejected
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SimulationBusRecorderTest, testRejectCorruptFile)
+{
+    uint64_t index_capacity = 0;
+    {
+        auto capture_file = native::CaptureFileWriter::create(capture_file_path, 64 * 1024, 64);
+        ASSERT_TRUE(capture_file);
+    }
+    {
+        const auto reader = native::CaptureFileReader::open(capture_file_path);
+        ASSERT_TRUE(reader);
+        index_capacity = reader->getHeader()._index_capacity;
+    }
+
+    overwriteHeaderField(offsetof(native::CaptureFileHeader, _index_count), index_capacity + 1);
+    EXPECT_FALSE(native::CaptureFileReader::open(capture_file_path));
+    overwriteHeaderField(offsetof(native::CaptureFileHeader, _index_count), 0);
+    ASSERT_TRUE(native::CaptureFileReader::open(capture_file_path));
+
+    // sums of offset and capacity wrapping around must not pass the checks
+    overwriteHeaderField(offsetof(native::CaptureFileHeader, _index_capacity),
+                         std::numeric_limits<uint64_t>::max() / sizeof(native::CaptureIndexEntry));
+    EXPECT_FALSE(native::CaptureFileReader::open(capture_file_path));
+    overwriteHeaderField(offsetof(native::CaptureFileHeader, _index_capacity), index_capacity);
+    overwriteHeaderField(offsetof(native::CaptureFileHeader, _records_capacity),
+                         std::numeric_limits<uint64_t>::max());
+    EXPECT_FALSE(native::CaptureFileReader::open(capture_file_path));
+}
+
+/**
+ * @detail Test that the native simulation bus records the listed signals to the configured
+ * recording file between initialization and deinitialization
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(NativeSimulationBusRecording, testRecordListedSignals)
+{
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::string>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_RECORDING_FILE_PROPERTY),
+        capture_file_path));
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<int64_t>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_RECORDING_FILE_SIZE_PROPERTY),
+        1024 * 1024));
+    ASSERT_FEP3_NOERROR(fep3::base::setPropertyValue<std::vector<std::string>>(
+        *_simulation_bus_property_node->getChild(FEP3_NATIVE_SIMBUS_RECORDING_SIGNALS_PROPERTY),
+        {"recorded_signal"}));
+    ASSERT_FEP3_NOERROR(_simulation_bus->initialize());
+
+    auto recorded_writer = _simulation_bus->getWriter("recorded_signal", 10);
+    auto other_writer = _simulation_bus->getWriter("other_signal", 10);
+    ASSERT_TRUE(recorded_writer && other_writer);
+    for (uint32_t index = 0; index < 5; ++index) {
+        ASSERT_FEP3_NOERROR(recorded_writer->write(*createSample(index, index, index)));
+        ASSERT_FEP3_NOERROR(other_writer->write(*createSample(index, index, index)));
+    }
+    ASSERT_FEP3_NOERROR(recorded_writer->transmit());
+    ASSERT_FEP3_NOERROR(other_writer->transmit());
+    ASSERT_FEP3_NOERROR(_simulation_bus->deinitialize());
+
+    const auto reader = native::CaptureFileReader::open(capture_file_path);
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(reader->getRecordCount(), 6u);
+    EXPECT_EQ(reader->getOverflowCount(), 0u);
+
+    uint64_t offset = 0;
+    native::CaptureRecord record;
+    ASSERT_TRUE(reader->read(offset, record));
+    EXPECT_STREQ(reinterpret_cast<const char*>(record._data), "recorded_signal");
+    for (uint32_t index = 0; index < 5; ++index) {
+        ASSERT_TRUE(reader->read(offset, record));
+        EXPECT_EQ(record._type, native::CaptureRecordType::sample);
+        EXPECT_EQ(getValue(record), index);
+    }
+}
@@ -103,15 +103,9 @@ TEST(TestDataReader, receive)
     EXPECT_CALL(*mock_data_registry_data_reader_ptr, getFrontTime())
         .WillOnce(::testing::Return(
             arya::Optional<arya::Timestamp>{})) // no samples / stream types in the queue
-        .WillOnce(
-            ::testing::Return(arya::Optional<arya::Timestamp>{1ns})) // one sample in the queue
-        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{1ns})) // sample has value
-        .WillOnce(
-            ::testing::Return(arya::Optional<arya::Timestamp>{2ns})) // one sample in the queue
-        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{2ns})) // sample has value
-        .WillOnce(
-            ::testing::Return(arya::Optional<arya::Timestamp>{3ns})) // one sample in the queue
-        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{3ns})) // sample has value
+        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{1ns})) // front sample
+        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{2ns})) // front sample
+        .WillOnce(::testing::Return(arya::Optional<arya::Timestamp>{3ns})) // front sample
         ;
 
     const auto& mock_data_sample = std::make_shared<::testing::NiceMock<mock::DataSample>>();
@@ -315,6 +315,121 @@ TEST_F(TestDataReaderBacklogSetup, readDataSampleBeforeTimestampUnavailable)
     ASSERT_EQ(_data_reader_backlog.readSampleBefore(Timestamp{0}), data_read_ptr<IDataSample>{});
 }
 
+/**
+ * Test whether the data sample valid at a given timestamp may be read from a backlog.
+ * @req_id TODO
+ */
+TEST_F(TestDataReaderBacklogSetup, readDataSampleAtTimestamp)
+{
+    SetUp(10, 12);
+    for (int i = 2, j = 11; i <= j; i++) {
+        ASSERT_EQ(_data_reader_backlog.readSampleAt(Timestamp{i})->getTime().count(), i);
+    }
+    ASSERT_EQ(_data_reader_backlog.readSampleAt(Timestamp{20})->getTime().count(), 11);
+    ASSERT_EQ(_data_reader_backlog.readSampleAt(Timestamp{1}), data_read_ptr<IDataSample>{});
+}
+
+/**
+ * Test whether all data samples within a time range may be read from a backlog.
+ * @req_id TODO
+ */
+TEST_F(TestDataReaderBacklogSetup, readDataSamplesBetweenTimestamps)
+{
+    SetUp(10, 12);
+
+    const auto samples = _data_reader_backlog.readSamplesBetween(Timestamp{4}, Timestamp{8});
+    ASSERT_EQ(samples.size(), 4);
+    for (int i = 0, j = 4; i < j; i++) {
+        EXPECT_EQ(samples[i]->getTime().count(), i + 4);
+    }
+
+    // bounds exceeding the backlog are clamped to the available samples
+    EXPECT_EQ(_data_reader_backlog.readSamplesBetween(Timestamp{0}, Timestamp{100}).size(), 10);
+    EXPECT_TRUE(_data_reader_backlog.readSamplesBetween(Timestamp{12}, Timestamp{100}).empty());
+    EXPECT_TRUE(_data_reader_backlog.readSamplesBetween(Timestamp{5}, Timestamp{5}).empty());
+}
+
+/**
+ * Test whether the latest data samples are read from oldest to latest.
+ * @req_id TODO
+ */
+TEST_F(TestDataReaderBacklogSetup, readLatestDataSamples)
+{
+    SetUp(10, 12);
+
+    const auto samples = _data_reader_backlog.readSamplesLatest(3);
+    ASSERT_EQ(samples.size(), 3);
+    for (int i = 0, j = 3; i < j; i++) {
+        EXPECT_EQ(samples[i]->getTime().count(), i + 9);
+    }
+
+    // counts exceeding the backlog are clamped to the available samples
+    EXPECT_EQ(_data_reader_backlog.readSamplesLatest(100).size(), 10);
+    EXPECT_TRUE(_data_reader_backlog.readSamplesLatest(0).empty());
+    EXPECT_EQ(_data_reader_backlog.getSampleQueueSize(), 10);
+}
+
+/**
+ * Test whether data samples are read into caller provided storage whose memory is reused.
+ * @req_id TODO
+ */
+TEST_F(TestDataReaderBacklogSetup, readDataSamplesIntoReusedStorage)
+{
+    SetUp(10, 12);
+
+    std::vector<data_read_ptr<const IDataSample>> samples;
+    _data_reader_backlog.readSamplesBetween(samples, Timestamp{4}, Timestamp{8});
+    ASSERT_EQ(samples.size(), 4);
+    EXPECT_EQ(samples.front()->getTime().count(), 4);
+    EXPECT_EQ(samples.back()->getTime().count(), 7);
+    const auto storage = samples.data();
+
+    _data_reader_backlog.readSamplesLatest(samples, 3);
+    ASSERT_EQ(samples.size(), 3);
+    for (int i = 0, j = 3; i < j; i++) {
+        EXPECT_EQ(samples[i]->getTime().count(), i + 9);
+    }
+    EXPECT_EQ(samples.data(), storage);
+
+    // the snapshot stays valid while the backlog receives new samples
+    pushDataSampleToBacklog(_data_reader_backlog, Timestamp{12});
+    EXPECT_EQ(samples.front()->getTime().count(), 9);
+
+    _data_reader_backlog.readSamplesBetween(samples, Timestamp{20}, Timestamp{30});
+    EXPECT_TRUE(samples.empty());
+}
+
+/**
+ * Test whether time based reads still find the right data samples if the samples were not
+ * received in time order.
+ * @req_id TODO
+ */
+TEST_F(TestDataReaderBacklogSetup, readDataSamplesUnordered)
+{
+    SetUp(5, 0);
+    for (const int time: {3, 1, 4, 0, 2}) {
+        pushDataSampleToBacklog(_data_reader_backlog, Timestamp{time});
+    }
+
+    // the latest received sample below the upper bound is read
+    ASSERT_EQ(_data_reader_backlog.readSampleBefore(Timestamp{4})->getTime().count(), 2);
+    ASSERT_EQ(_data_reader_backlog.readSampleAt(Timestamp{4})->getTime().count(), 2);
+    ASSERT_EQ(_data_reader_backlog.readSampleBefore(Timestamp{2})->getTime().count(), 0);
+
+    const auto samples = _data_reader_backlog.readSamplesBetween(Timestamp{1}, Timestamp{4});
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_EQ(samples[0]->getTime().count(), 3);
+    EXPECT_EQ(samples[1]->getTime().count(), 1);
+    EXPECT_EQ(samples[2]->getTime().count(), 2);
+
+    // the backlog is ordered again once the unordered samples are dropped
+    for (int i = 10, j = 15; i < j; i++) {
+        pushDataSampleToBacklog(_data_reader_backlog, Timestamp{i});
+    }
+    ASSERT_EQ(_data_reader_backlog.readSampleBefore(Timestamp{13})->getTime().count(), 12);
+    ASSERT_EQ(_data_reader_backlog.readSamplesBetween(Timestamp{11}, Timestamp{13}).size(), 2);
+}
+
 /**
  * Test whether an empty data sample is returned if read from an empty backlog.
  * @req_id TODO
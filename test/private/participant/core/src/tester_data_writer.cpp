@@ -19,8 +19,82 @@ with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include <gtest_asserts.h>
 
+#include <cstring>
+
 using namespace fep3;
 
+namespace {
+
+class TestLoanedDataSample : public ILoanedDataSample {
+public:
+    explicit TestLoanedDataSample(size_t size) : _memory(size)
+    {
+    }
+
+    Timestamp getTime() const override
+    {
+        return _time;
+    }
+
+    size_t getSize() const override
+    {
+        return _memory.size();
+    }
+
+    uint32_t getCounter() const override
+    {
+        return _counter;
+    }
+
+    size_t read(IRawMemory& writeable_memory) const override
+    {
+        return writeable_memory.set(_memory.data(), _memory.size());
+    }
+
+    void setTime(const Timestamp& time) override
+    {
+        _time = time;
+    }
+
+    void setCounter(uint32_t counter) override
+    {
+        _counter = counter;
+    }
+
+    size_t write(const IRawMemory&) override
+    {
+        return 0;
+    }
+
+    void* data() override
+    {
+        return _memory.data();
+    }
+
+    size_t getCapacity() const override
+    {
+        return _memory.size();
+    }
+
+    size_t setSize(size_t /*size*/) override
+    {
+        return _memory.size();
+    }
+
+private:
+    std::vector<uint8_t> _memory;
+    Timestamp _time{0};
+    uint32_t _counter{0};
+};
+
+struct LoaningDataWriter : public mock::DataRegistry::DataWriter,
+                           public IDataRegistryLoaningWriter {
+    MOCK_METHOD(std::shared_ptr<ILoanedDataSample>, loanSample, (size_t), (override));
+    MOCK_METHOD(fep3::Result, commit, (const std::shared_ptr<ILoanedDataSample>&), (override));
+};
+
+} // namespace
+
 /**
  * Test the data writer backlog constructors
  * @req_id TODO
@@ -155,3 +229,95 @@ TEST(TestDataWriter, writeAndFlush)
 
     ASSERT_FEP3_RESULT(data_writer.write(test_data_sample_1), Result{});
 }
+
+/**
+ * Test writing in place to a writer which does not loan samples
+ * @req_id TODO
+ */
+TEST(TestDataWriter, writeInPlace)
+{
+    const std::string& test_signal_name{"foo"};
+    const size_t& test_queue_size{3};
+
+    core::DataWriter data_writer{
+        test_signal_name, base::StreamTypePlain<uint32_t>(), test_queue_size};
+    EXPECT_FALSE(data_writer.beginWrite(sizeof(uint32_t)).data);
+    ASSERT_FEP3_RESULT(data_writer.endWrite(), ERR_INVALID_STATE);
+
+    ::testing::StrictMock<mock::DataRegistry> mock_data_registry;
+    auto mock_data_registry_data_writer =
+        std::make_unique<::testing::StrictMock<mock::DataRegistry::DataWriter>>();
+    auto* mock_data_registry_data_writer_ptr = mock_data_registry_data_writer.get();
+    EXPECT_CALL(mock_data_registry,
+                registerDataOut(::testing::StrEq(test_signal_name), ::testing::_, false))
+        .WillOnce(::testing::Return(Result{}));
+    EXPECT_CALL(mock_data_registry, getWriter(::testing::StrEq(test_signal_name), test_queue_size))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(mock_data_registry_data_writer))));
+    ASSERT_FEP3_RESULT(data_writer.addToDataRegistry(mock_data_registry), Result{});
+
+    uint32_t value{42};
+    base::arya::DataSampleType<uint32_t> expected_sample(value);
+    expected_sample.setTime(fep3::Timestamp{10});
+    EXPECT_CALL(*mock_data_registry_data_writer_ptr,
+                write(::testing::Matcher<const IDataSample&>(
+                    mock::DataSampleMatcher(::testing::ByRef(expected_sample)))))
+        .WillOnce(::testing::Return(Result{}));
+
+    const auto memory = data_writer.beginWrite(sizeof(value));
+    ASSERT_TRUE(memory.data);
+    ASSERT_EQ(memory.size, sizeof(value));
+    std::memcpy(memory.data, &value, sizeof(value));
+    ASSERT_FEP3_RESULT(data_writer.endWrite(fep3::Timestamp{10}), Result{});
+    ASSERT_FEP3_RESULT(data_writer.endWrite(), ERR_INVALID_STATE);
+}
+
+/**
+ * Test writing in place to a writer which loans samples
+ * @req_id TODO
+ */
+TEST(TestDataWriter, writeInPlaceLoaned)
+{
+    const std::string& test_signal_name{"foo"};
+    const size_t& test_queue_size{3};
+
+    core::DataWriter data_writer{
+        test_signal_name, base::StreamTypePlain<uint32_t>(), test_queue_size};
+
+    ::testing::StrictMock<mock::DataRegistry> mock_data_registry;
+    auto mock_data_registry_data_writer =
+        std::make_unique<::testing::StrictMock<LoaningDataWriter>>();
+    auto* mock_data_registry_data_writer_ptr = mock_data_registry_data_writer.get();
+    EXPECT_CALL(mock_data_registry,
+                registerDataOut(::testing::StrEq(test_signal_name), ::testing::_, false))
+        .WillOnce(::testing::Return(Result{}));
+    EXPECT_CALL(mock_data_registry, getWriter(::testing::StrEq(test_signal_name), test_queue_size))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(mock_data_registry_data_writer))));
+    ASSERT_FEP3_RESULT(data_writer.addToDataRegistry(mock_data_registry), Result{});
+    ASSERT_FEP3_RESULT(data_writer.addClockTimeGetter([&]() { return fep3::Timestamp{20}; }),
+                       Result{});
+
+    const auto loaned_sample = std::make_shared<TestLoanedDataSample>(sizeof(uint32_t));
+    EXPECT_CALL(*mock_data_registry_data_writer_ptr, loanSample(sizeof(uint32_t)))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(loaned_sample));
+    EXPECT_CALL(*mock_data_registry_data_writer_ptr,
+                commit(::testing::Eq(std::shared_ptr<ILoanedDataSample>(loaned_sample))))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(Result{}));
+
+    // the sample is written to the loaned memory and committed without the write call
+    const uint32_t value{42};
+    const auto memory = data_writer.beginWrite(sizeof(value));
+    ASSERT_EQ(memory.data, loaned_sample->data());
+    std::memcpy(memory.data, &value, sizeof(value));
+    ASSERT_FEP3_RESULT(data_writer.endWrite(fep3::Timestamp{10}), Result{});
+    EXPECT_EQ(loaned_sample->getTime(), fep3::Timestamp{10});
+    EXPECT_EQ(loaned_sample->getCounter(), 0u);
+    EXPECT_EQ(*static_cast<const uint32_t*>(loaned_sample->data()), value);
+
+    // without a time, the time is retrieved from the time getter
+    ASSERT_TRUE(data_writer.beginWrite(sizeof(value)).data);
+    ASSERT_FEP3_RESULT(data_writer.endWrite(), Result{});
+    EXPECT_EQ(loaned_sample->getTime(), fep3::Timestamp{20});
+    EXPECT_EQ(loaned_sample->getCounter(), 1u);
+}
@@ -0,0 +1,216 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/sample/raw_memory.h>
+#include <fep3/core/data/interpolating_data_reader.h>
+
+#include <gtest_asserts.h>
+
+#include <limits>
+
+using namespace fep3;
+
+namespace {
+
+const auto ddl_description = R"(<?xml version="1.0" encoding="utf-8" standalone="no"?>
+<adtf:ddl xmlns:adtf="adtf">
+ <header>
+  <language_version>4.00</language_version>
+  <author>fep_team</author>
+  <date_creation>20.02.2020</date_creation>
+  <date_change>20.02.2020</date_change>
+  <description>Simplistic DDL for testing purposes</description>
+ </header>
+ <units />
+ <datatypes>
+  <datatype description="predefined ADTF tBool datatype" name="tBool" size="8" />
+  <datatype description="predefined ADTF tInt32 datatype" name="tInt32" size="32" />
+  <datatype description="predefined ADTF tFloat32 datatype" name="tFloat32" size="32" />
+  <datatype description="predefined ADTF tFloat64 datatype" name="tFloat64" size="64" />
+ </datatypes>
+ <enums>
+ </enums>
+ <structs>
+  <struct alignment="1" name="tTestStruct" version="1">
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="0" name="f64Value" type="tFloat64"/>
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="8" name="i32Value" type="tInt32"/>
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="12" name="bFlag" type="tBool"/>
+   <element alignment="1" arraysize="4" byteorder="LE" bytepos="13" name="f32Array" type="tFloat32"/>
+  </struct>
+ </structs>
+ <streams />
+</adtf:ddl>)";
+
+#pragma pack(push, 1)
+struct TestStruct {
+    double f64Value;
+    int32_t i32Value;
+    bool bFlag;
+    float f32Array[4];
+};
+#pragma pack(pop)
+
+void pushSample(core::DataReader& reader, Timestamp time, const TestStruct& value)
+{
+    reader(std::make_shared<base::DataSample>(
+        time, 0, base::RawMemoryRef(&value, sizeof(value))));
+}
+
+TestStruct readValue(const data_read_ptr<const IDataSample>& sample)
+{
+    TestStruct value{};
+    base::RawMemoryStandardType<TestStruct> memory(value);
+    EXPECT_EQ(sample->read(memory), sizeof(TestStruct));
+    return value;
+}
+
+} // namespace
+
+/**
+ * @detail Test whether the numeric elements of a ddl struct are interpolated linearly between the
+ * samples around the requested time while non numeric elements are held
+ */
+TEST(InterpolatingDataReader, testLinearInterpolation)
+{
+    core::InterpolatingDataReader reader(
+        "reader", base::StreamTypeDDL("tTestStruct", ddl_description), 10);
+    pushSample(reader, Timestamp{10}, {1.0, 10, true, {0.0f, 1.0f, 2.0f, 3.0f}});
+    pushSample(reader, Timestamp{20}, {2.0, 15, false, {4.0f, 5.0f, 6.0f, 7.0f}});
+
+    const auto sample = reader.readSampleInterpolated(Timestamp{15});
+    ASSERT_TRUE(sample);
+    EXPECT_EQ(sample->getTime(), Timestamp{15});
+    const auto value = readValue(sample);
+    EXPECT_DOUBLE_EQ(value.f64Value, 1.5);
+    EXPECT_EQ(value.i32Value, 13);
+    EXPECT_TRUE(value.bFlag);
+    for (int index = 0; index < 4; ++index) {
+        EXPECT_FLOAT_EQ(value.f32Array[index], static_cast<float>(index) + 2.0f);
+    }
+
+    // samples at the requested time are not interpolated
+    EXPECT_EQ(readValue(reader.readSampleInterpolated(Timestamp{20})).f64Value, 2.0);
+    // requested times outside of the backlog are clamped to the oldest and latest sample
+    EXPECT_EQ(readValue(reader.readSampleInterpolated(Timestamp{5})).f64Value, 1.0);
+    EXPECT_EQ(readValue(reader.readSampleInterpolated(Timestamp{25})).f64Value, 2.0);
+}
+
+/**
+ * @detail Test whether 64 bit integers are interpolated without loss of precision and without
+ * overflow near the limits of their range
+ */
+TEST(InterpolatingDataReader, testLinearInterpolationOf64BitIntegers)
+{
+    const auto ddl_description_64 = R"(<?xml version="1.0" encoding="utf-8" standalone="no"?>
+<adtf:ddl xmlns:adtf="adtf">
+ <header>
+  <language_version>4.00</language_version>
+  <author>fep_team</author>
+  <date_creation>20.02.2020</date_creation>
+  <date_change>20.02.2020</date_change>
+  <description>Simplistic DDL for testing purposes</description>
+ </header>
+ <units />
+ <datatypes>
+  <datatype description="predefined ADTF tInt64 datatype" name="tInt64" size="64" />
+  <datatype description="predefined ADTF tUInt64 datatype" name="tUInt64" size="64" />
+ </datatypes>
+ <enums>
+ </enums>
+ <structs>
+  <struct alignment="1" name="tTestStruct64" version="1">
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="0" name="i64Value" type="tInt64"/>
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="8" name="i64Range" type="tInt64"/>
+   <element alignment="1" arraysize="1" byteorder="LE" bytepos="16" name="ui64Value" type="tUInt64"/>
+  </struct>
+ </structs>
+ <streams />
+</adtf:ddl>)";
+#pragma pack(push, 1)
+    struct TestStruct64 {
+        int64_t i64Value;
+        int64_t i64Range;
+        uint64_t ui64Value;
+    };
+#pragma pack(pop)
+    constexpr auto int64_max = std::numeric_limits<int64_t>::max();
+    constexpr auto int64_min = std::numeric_limits<int64_t>::min();
+    constexpr auto uint64_max = std::numeric_limits<uint64_t>::max();
+
+    core::InterpolatingDataReader reader(
+        "reader", base::StreamTypeDDL("tTestStruct64", ddl_description_64), 10);
+    const TestStruct64 first{int64_max - 10, int64_max, uint64_max - 4};
+    const TestStruct64 second{int64_max, int64_min, uint64_max};
+    reader(std::make_shared<base::DataSample>(
+        Timestamp{0}, 0, base::RawMemoryRef(&first, sizeof(first))));
+    reader(std::make_shared<base::DataSample>(
+        Timestamp{10}, 0, base::RawMemoryRef(&second, sizeof(second))));
+
+    const auto sample = reader.readSampleInterpolated(Timestamp{5});
+    ASSERT_TRUE(sample);
+    TestStruct64 value{};
+    base::RawMemoryStandardType<TestStruct64> memory(value);
+    ASSERT_EQ(sample->read(memory), sizeof(TestStruct64));
+    EXPECT_EQ(value.i64Value, int64_max - 5);
+    // the distance of the values exceeds the range of int64_t
+    EXPECT_GE(value.i64Range, -1);
+    EXPECT_LE(value.i64Range, 0);
+    EXPECT_EQ(value.ui64Value, uint64_max - 2);
+}
+
+/**
+ * @detail Test whether the interpolation of single elements may be configured
+ */
+TEST(InterpolatingDataReader, testSetInterpolation)
+{
+    core::InterpolatingDataReader reader("reader",
+                                         base::StreamTypeDDL("tTestStruct", ddl_description),
+                                         10,
+                                         core::Interpolation::zero_order_hold);
+    ASSERT_FEP3_NOERROR(reader.setInterpolation("f32Array", core::Interpolation::linear));
+    ASSERT_FEP3_RESULT(reader.setInterpolation("bFlag", core::Interpolation::linear),
+                       ERR_INVALID_ARG);
+    ASSERT_FEP3_RESULT(reader.setInterpolation("unknown", core::Interpolation::linear),
+                       ERR_NOT_FOUND);
+
+    pushSample(reader, Timestamp{0}, {1.0, 10, true, {0.0f, 1.0f, 2.0f, 3.0f}});
+    pushSample(reader, Timestamp{4}, {2.0, 14, false, {4.0f, 5.0f, 6.0f, 7.0f}});
+
+    const auto value = readValue(reader.readSampleInterpolated(Timestamp{1}));
+    EXPECT_DOUBLE_EQ(value.f64Value, 1.0);
+    EXPECT_EQ(value.i32Value, 10);
+    EXPECT_FLOAT_EQ(value.f32Array[0], 1.0f);
+    EXPECT_FLOAT_EQ(value.f32Array[3], 4.0f);
+}
+
+/**
+ * @detail Test whether samples of stream types without ddl layout are held
+ */
+TEST(InterpolatingDataReader, testNoDDLStreamType)
+{
+    core::InterpolatingDataReader reader("reader", base::StreamTypePlain<double>(), 10);
+    ASSERT_FEP3_RESULT(reader.setInterpolation("value", core::Interpolation::linear),
+                       ERR_INVALID_TYPE);
+    EXPECT_FALSE(reader.readSampleInterpolated(Timestamp{0}));
+
+    const double first_value = 1.0;
+    const double second_value = 2.0;
+    reader(std::make_shared<base::DataSample>(
+        Timestamp{0}, 0, base::RawMemoryRef(&first_value, sizeof(first_value))));
+    reader(std::make_shared<base::DataSample>(
+        Timestamp{10}, 0, base::RawMemoryRef(&second_value, sizeof(second_value))));
+
+    const auto sample = reader.readSampleInterpolated(Timestamp{5});
+    ASSERT_TRUE(sample);
+    EXPECT_EQ(sample->getTime(), Timestamp{0});
+}
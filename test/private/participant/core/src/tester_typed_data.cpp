@@ -0,0 +1,130 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/raw_memory.h>
+#include <fep3/components/data_registry/mock_data_registry.h>
+#include <fep3/core/data/typed_data_reader.h>
+#include <fep3/core/data/typed_data_writer.h>
+
+#include <gtest_asserts.h>
+
+using namespace fep3;
+
+namespace {
+
+struct TestStruct {
+    static constexpr const char* ddl_struct = "tTestStruct";
+    static constexpr const char* ddl_description = "<ddl/>";
+
+    uint32_t first;
+    double second;
+};
+
+void pushSample(core::DataReader& reader, Timestamp time, const void* data, size_t data_size)
+{
+    reader(std::make_shared<base::DataSample>(time, 0, base::RawMemoryRef(data, data_size)));
+}
+
+} // namespace
+
+/**
+ * @detail Test whether the stream types of plain c types and of types providing a ddl
+ * description are provided at compile time
+ */
+TEST(TypedData, testStreamTypeTraits)
+{
+    const auto plain_stream_type = core::StreamTypeTraits<int32_t>::getStreamType();
+    EXPECT_EQ(plain_stream_type.getMetaTypeName(),
+              base::StreamTypePlain<int32_t>().getMetaTypeName());
+    EXPECT_EQ(plain_stream_type.getProperty("datatype"), "int32_t");
+
+    const auto ddl_stream_type = core::StreamTypeTraits<TestStruct>::getStreamType();
+    EXPECT_EQ(ddl_stream_type.getMetaTypeName(), base::arya::meta_type_ddl.getName());
+    EXPECT_EQ(ddl_stream_type.getProperty(base::arya::meta_type_prop_name_ddlstruct),
+              "tTestStruct");
+    EXPECT_EQ(ddl_stream_type.getProperty(base::arya::meta_type_prop_name_ddldescription),
+              "<ddl/>");
+}
+
+/**
+ * @detail Test whether received samples are read as values of the reader's type and samples of
+ * another size are dropped
+ */
+TEST(TypedData, testTypedDataReader)
+{
+    core::TypedDataReader<TestStruct> reader("reader", 3);
+    EXPECT_EQ(reader.readType()->getProperty(base::arya::meta_type_prop_name_ddlstruct),
+              "tTestStruct");
+    EXPECT_FALSE(reader.readLatest());
+
+    const TestStruct first_value{1, 1.5};
+    const TestStruct second_value{2, 2.5};
+    const uint32_t wrong_size_value{3};
+    pushSample(reader, Timestamp{10}, &first_value, sizeof(first_value));
+    pushSample(reader, Timestamp{20}, &second_value, sizeof(second_value));
+    pushSample(reader, Timestamp{30}, &wrong_size_value, sizeof(wrong_size_value));
+    ASSERT_EQ(reader.getSampleQueueSize(), 2);
+
+    const auto latest = reader.readLatest();
+    ASSERT_TRUE(latest);
+    EXPECT_EQ(latest->getTime(), Timestamp{20});
+    EXPECT_EQ(latest->getValue().first, 2u);
+    EXPECT_EQ(latest->getValue().second, 2.5);
+    EXPECT_EQ(reader.readAt(Timestamp{15})->getValue().first, 1u);
+
+    const core::TypedDataSample<TestStruct>* released_sample = nullptr;
+    {
+        const auto oldest = reader.popOldest();
+        ASSERT_TRUE(oldest);
+        EXPECT_EQ(oldest->getValue().first, 1u);
+        EXPECT_EQ(reader.getSampleQueueSize(), 1);
+        released_sample = oldest.get();
+    }
+
+    // released samples are reused for subsequently received samples
+    pushSample(reader, Timestamp{40}, &first_value, sizeof(first_value));
+    EXPECT_EQ(reader.readLatest().get(), released_sample);
+}
+
+/**
+ * @detail Test whether values are written as samples of the writer's type
+ */
+TEST(TypedData, testTypedDataWriter)
+{
+    const size_t test_queue_size{5};
+    core::TypedDataWriter<double> writer("writer", test_queue_size);
+    EXPECT_FEP3_RESULT(writer.write(1.0), ERR_NOT_CONNECTED);
+
+    ::testing::StrictMock<mock::DataRegistry> mock_data_registry;
+    auto mock_data_registry_data_writer =
+        std::make_unique<::testing::StrictMock<mock::DataRegistry::DataWriter>>();
+    auto* mock_data_registry_data_writer_ptr = mock_data_registry_data_writer.get();
+    EXPECT_CALL(mock_data_registry,
+                registerDataOut(::testing::StrEq("writer"), ::testing::_, false))
+        .WillOnce(::testing::Return(Result{}));
+    EXPECT_CALL(mock_data_registry, getWriter(::testing::StrEq("writer"), test_queue_size))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(mock_data_registry_data_writer))));
+    ASSERT_FEP3_NOERROR(writer.addToDataRegistry(mock_data_registry));
+
+    double written_value{};
+    EXPECT_CALL(*mock_data_registry_data_writer_ptr,
+                write(::testing::Matcher<const IDataSample&>(::testing::_)))
+        .WillOnce(::testing::Invoke([&written_value](const IDataSample& sample) {
+            EXPECT_EQ(sample.getTime(), Timestamp{5});
+            EXPECT_EQ(sample.getSize(), sizeof(double));
+            base::RawMemoryStandardType<double> memory(written_value);
+            sample.read(memory);
+            return Result{};
+        }));
+    ASSERT_FEP3_NOERROR(writer.write(4.5, Timestamp{5}));
+    EXPECT_EQ(written_value, 4.5);
+}
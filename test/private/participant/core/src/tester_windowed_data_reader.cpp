@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/sample/raw_memory.h>
+#include <fep3/core/data/windowed_data_reader.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace fep3;
+
+namespace {
+
+void pushValue(core::DataReader& reader, Timestamp time, double value)
+{
+    reader(std::make_shared<base::DataSample>(time, 0, base::RawMemoryRef(&value, sizeof(value))));
+}
+
+} // namespace
+
+/**
+ * @detail Test whether the latest values are read as contiguous window, also after the ring
+ * buffer of the window wrapped
+ */
+TEST(WindowedDataReader, testReadWindow)
+{
+    core::WindowedDataReader<double> reader("reader", 4);
+    EXPECT_EQ(reader.getWindowSize(), 4);
+    EXPECT_TRUE(reader.readWindow().empty());
+
+    for (int index = 0; index < 3; ++index) {
+        pushValue(reader, Timestamp{index}, static_cast<double>(index));
+    }
+    {
+        const auto window = reader.readWindow();
+        ASSERT_EQ(window.size(), 3);
+        EXPECT_EQ(window[0], 0.0);
+        EXPECT_EQ(window[2], 2.0);
+    }
+
+    for (int index = 3; index < 10; ++index) {
+        pushValue(reader, Timestamp{index}, static_cast<double>(index));
+    }
+    {
+        const auto window = reader.readWindow();
+        ASSERT_EQ(window.size(), 4);
+        for (size_t index = 0; index < window.size(); ++index) {
+            EXPECT_EQ(window.values()[index], static_cast<double>(index + 6));
+            EXPECT_EQ(window.times()[index], Timestamp{index + 6});
+        }
+        EXPECT_EQ(std::accumulate(window.begin(), window.end(), 0.0), 30.0);
+    }
+    {
+        const auto window = reader.readWindow(2);
+        ASSERT_EQ(window.size(), 2);
+        EXPECT_EQ(window[0], 8.0);
+        EXPECT_EQ(window[1], 9.0);
+    }
+    EXPECT_EQ(reader.readWindow(100).size(), 4);
+
+    // the backlog of the reader is filled as well
+    ASSERT_TRUE(reader.readLatest());
+    EXPECT_EQ(reader.readLatest()->getValue(), 9.0);
+}
+
+/**
+ * @detail Test whether samples are received while a window is held and the held window keeps the
+ * values read
+ */
+TEST(WindowedDataReader, testReceiveWhileWindowIsHeld)
+{
+    core::WindowedDataReader<double> reader("reader", 2);
+    pushValue(reader, Timestamp{0}, 0.0);
+    pushValue(reader, Timestamp{1}, 1.0);
+
+    const auto window = reader.readWindow();
+    pushValue(reader, Timestamp{2}, 2.0);
+    pushValue(reader, Timestamp{3}, 3.0);
+
+    ASSERT_EQ(window.size(), 2);
+    EXPECT_EQ(window[0], 0.0);
+    EXPECT_EQ(window[1], 1.0);
+    EXPECT_EQ(window.times()[1], Timestamp{1});
+
+    const auto latest_window = reader.readWindow();
+    ASSERT_EQ(latest_window.size(), 2);
+    EXPECT_EQ(latest_window[0], 2.0);
+    EXPECT_EQ(latest_window[1], 3.0);
+}
+
+/**
+ * @detail Test whether a window passed to subsequent reads is refilled with the latest values
+ * without reallocating its memory
+ */
+TEST(WindowedDataReader, testReadIntoReusedWindow)
+{
+    core::WindowedDataReader<double> reader("reader", 3);
+    core::SampleWindow<double> window;
+    reader.readWindow(window);
+    EXPECT_TRUE(window.empty());
+
+    for (int index = 0; index < 3; ++index) {
+        pushValue(reader, Timestamp{index}, static_cast<double>(index));
+    }
+    reader.readWindow(window);
+    ASSERT_EQ(window.size(), 3);
+    const auto values = window.values();
+    const auto times = window.times();
+
+    for (int index = 3; index < 5; ++index) {
+        pushValue(reader, Timestamp{index}, static_cast<double>(index));
+    }
+    reader.readWindow(window);
+    ASSERT_EQ(window.size(), 3);
+    EXPECT_EQ(window.values(), values);
+    EXPECT_EQ(window.times(), times);
+    EXPECT_EQ(window[0], 2.0);
+    EXPECT_EQ(window[2], 4.0);
+    EXPECT_EQ(window.times()[2], Timestamp{4});
+
+    reader.readWindowOf(window, Timestamp{1});
+    ASSERT_EQ(window.size(), 2);
+    EXPECT_EQ(window.values(), values);
+    EXPECT_EQ(window[0], 3.0);
+}
+
+/**
+ * @detail Test whether the values within a duration before the latest value are read as window
+ */
+TEST(WindowedDataReader, testReadWindowOfDuration)
+{
+    core::WindowedDataReader<double> reader("reader", 8);
+    EXPECT_TRUE(reader.readWindowOf(Timestamp{10}).empty());
+
+    for (int index = 0; index < 10; ++index) {
+        pushValue(reader, Timestamp{index * 10}, static_cast<double>(index));
+    }
+
+    const auto window = reader.readWindowOf(Timestamp{25});
+    ASSERT_EQ(window.size(), 3);
+    EXPECT_EQ(window[0], 7.0);
+    EXPECT_EQ(window.times()[0], Timestamp{70});
+    EXPECT_EQ(window[2], 9.0);
+}
+
+/**
+ * @detail Test whether the window is limited to the window size when reading a duration
+ */
+TEST(WindowedDataReader, testReadWindowOfDurationExceedingWindow)
+{
+    core::WindowedDataReader<double> reader("reader", 3);
+    for (int index = 0; index < 5; ++index) {
+        pushValue(reader, Timestamp{index}, static_cast<double>(index));
+    }
+    EXPECT_EQ(reader.readWindowOf(Timestamp{100}).size(), 3);
+    EXPECT_EQ(reader.readWindowOf(Timestamp{0}).size(), 1);
+}
@@ -597,11 +597,8 @@ TEST_F(DataJobWithMocks, executeDataIn)
     ASSERT_FEP3_NOERROR(data_in->addToDataRegistry(*_data_registry_mock));
 
     EXPECT_CALL(*dataregistry_reader_ptr, getFrontTime())
-        .Times(7)
+        .Times(4)
         .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
-        .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
-        .WillOnce(Return(fep3::Optional<fep3::Timestamp>(30ms)))
-        .WillOnce(Return(fep3::Optional<fep3::Timestamp>(30ms)))
         .WillOnce(Return(fep3::Optional<fep3::Timestamp>(30ms)))
         .WillOnce(Return(fep3::Optional<fep3::Timestamp>(30ms)))
         .WillRepeatedly(Return(fep3::Optional<fep3::Timestamp>()));
@@ -615,10 +612,10 @@ TEST_F(DataJobWithMocks, executeDataIn)
 
     IJob& job_intf = job;
 
-    // pops 20ms sample (2 calls) and skips 30ms sample (2 calls)
+    // pops 20ms sample (1 call) and skips 30ms sample (1 call)
     ASSERT_FEP3_NOERROR(job_intf.executeDataIn(25ms));
 
-    // pops 30ms sample (2 calls) and exits on "no value" case
+    // pops 30ms sample (1 call) and exits on "no value" case
     ASSERT_FEP3_NOERROR(job_intf.executeDataIn(35ms));
 }
 
@@ -700,9 +697,7 @@ TEST_F(DataJobWithMocks, dataReaderAddToDataRegistryRemoveFromDataRegistry)
     ASSERT_FEP3_NOERROR(reader.addToDataRegistry(*_data_registry_mock));
 
     EXPECT_CALL(*dataregistry_reader_ptr, getFrontTime())
-        .Times(5)
-        .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
-        .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
+        .Times(3)
         .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
         .WillOnce(Return(fep3::Optional<fep3::Timestamp>(20ms)))
         .WillRepeatedly(Return(fep3::Optional<fep3::Timestamp>()));
@@ -0,0 +1,356 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/stream_type/default_stream_type.h>
+
+#include <gtest/gtest.h>
+#include <simulation_bus/shared_memory_ring.h>
+#include <simulation_bus/shared_memory_simulation_bus.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <thread>
+
+using namespace fep3;
+using namespace std::chrono;
+
+namespace {
+
+/// Gets a signal name unique to this process, so parallel test runs do not share segments
+std::string getSignalName(const std::string& name)
+{
+    return name + "_" + std::to_string(::getpid());
+}
+
+class DataReceiver : public ISimulationBus::IDataReceiver {
+public:
+    void operator()(const data_read_ptr<const IStreamType>& stream_type) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stream_types.push_back(stream_type);
+        _condition.notify_all();
+    }
+
+    void operator()(const data_read_ptr<const IDataSample>& sample) override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _samples.push_back(sample);
+        _condition.notify_all();
+    }
+
+    bool waitForSamples(size_t sample_count)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _condition.wait_for(
+            lock, seconds(5), [&]() { return _samples.size() >= sample_count; });
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<data_read_ptr<const IStreamType>> _stream_types;
+    std::vector<data_read_ptr<const IDataSample>> _samples;
+};
+
+uint32_t getValue(const IDataSample& sample)
+{
+    uint32_t value = 0;
+    base::RawMemoryStandardType<uint32_t> memory(value);
+    sample.read(memory);
+    return value;
+}
+
+} // namespace
+
+struct SharedMemorySimulationBusTest : public ::testing::Test {
+    void SetUp() override
+    {
+        for (auto simulation_bus: {&_writing_bus, &_reading_bus}) {
+            ASSERT_TRUE(simulation_bus->create());
+            ASSERT_TRUE(simulation_bus->initialize());
+        }
+    }
+
+    void TearDown() override
+    {
+        for (auto simulation_bus: {&_writing_bus, &_reading_bus}) {
+            EXPECT_TRUE(simulation_bus->deinitialize());
+            EXPECT_TRUE(simulation_bus->destroy());
+        }
+    }
+
+    shared_memory::SharedMemorySimulationBus _writing_bus;
+    shared_memory::SharedMemorySimulationBus _reading_bus;
+};
+
+/**
+ * @detail Test that samples and stream types written by one simulation bus instance are received
+ * by another instance via shared memory
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SharedMemorySimulationBusTest, testTransmissionOfSamplesAndStreamTypes)
+{
+    const auto signal_name = getSignalName("transmission");
+    base::StreamTypePlain<uint32_t> stream_type;
+
+    auto reader = _reading_bus.getReader(signal_name, stream_type, 10);
+    auto writer = _writing_bus.getWriter(signal_name, stream_type, 10);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    ASSERT_TRUE(writer->write(stream_type));
+    for (uint32_t value = 0; value < 3; ++value) {
+        ASSERT_TRUE(writer->write(base::DataSampleType<uint32_t>(value)));
+    }
+    // nothing is visible to the reader until transmission
+    EXPECT_EQ(reader->size(), 0u);
+    ASSERT_TRUE(writer->transmit());
+    EXPECT_EQ(reader->size(), 4u);
+
+    DataReceiver receiver;
+    EXPECT_FALSE(reader->getFrontTime());
+    ASSERT_TRUE(reader->pop(receiver));
+    ASSERT_EQ(receiver._stream_types.size(), 1u);
+    EXPECT_EQ(receiver._stream_types.front()->getMetaTypeName(), stream_type.getMetaTypeName());
+    EXPECT_EQ(receiver._stream_types.front()->getProperty(
+                  base::arya::meta_type_prop_name_datatype),
+              stream_type.getProperty(base::arya::meta_type_prop_name_datatype));
+
+    while (reader->pop(receiver)) {
+    }
+    ASSERT_EQ(receiver._samples.size(), 3u);
+    for (uint32_t value = 0; value < 3; ++value) {
+        EXPECT_EQ(getValue(*receiver._samples[value]), value);
+    }
+}
+
+/**
+ * @detail Test that a reader lagging behind by more than its capacity loses the oldest samples
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SharedMemorySimulationBusTest, testReaderDropsOldestSamples)
+{
+    const auto signal_name = getSignalName("drop_oldest");
+
+    auto reader = _reading_bus.getReader(signal_name, 3);
+    auto writer = _writing_bus.getWriter(signal_name, 10);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    for (uint32_t value = 0; value < 10; ++value) {
+        base::DataSampleType<uint32_t> sample(value);
+        sample.setTime(Timestamp(value));
+        ASSERT_TRUE(writer->write(sample));
+    }
+    ASSERT_TRUE(writer->transmit());
+    EXPECT_EQ(reader->size(), 3u);
+
+    ASSERT_TRUE(reader->getFrontTime());
+    EXPECT_EQ(reader->getFrontTime().value(), Timestamp(7));
+
+    DataReceiver receiver;
+    while (reader->pop(receiver)) {
+    }
+    ASSERT_EQ(receiver._samples.size(), 3u);
+    EXPECT_EQ(getValue(*receiver._samples.front()), 7u);
+    EXPECT_EQ(getValue(*receiver._samples.back()), 9u);
+}
+
+/**
+ * @detail Test that samples larger than the slot size of the signal are rejected by the writer
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SharedMemorySimulationBusTest, testWriteOfOversizedSampleFails)
+{
+    const auto signal_name = getSignalName("oversized");
+    base::StreamTypeRaw stream_type;
+    stream_type.setProperty(base::arya::meta_type_prop_name_max_byte_size, "16", "uint32");
+
+    auto writer = _writing_bus.getWriter(signal_name, stream_type, 1);
+    ASSERT_TRUE(writer);
+
+    // the slot has at least the size of the serialized stream type
+    const std::vector<uint8_t> oversized_data(1024 * 1024);
+    const base::DataSample oversized_sample(
+        Timestamp(0), 0, base::RawMemoryRef(oversized_data.data(), oversized_data.size()));
+    EXPECT_EQ(writer->write(oversized_sample), ERR_OUT_OF_RANGE);
+}
+
+/**
+ * @detail Test that the slot of a signal whose stream type does not provide a max byte size has
+ * the configured slot size
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SharedMemorySimulationBusTest, testRawStreamTypeUsesConfiguredSlotSize)
+{
+    const auto signal_name = getSignalName("raw");
+    base::StreamTypeRaw stream_type;
+
+    auto reader = _reading_bus.getReader(signal_name, stream_type, 1);
+    auto writer = _writing_bus.getWriter(signal_name, stream_type, 1);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    const std::vector<uint8_t> data(1024, 0x2A);
+    ASSERT_TRUE(writer->write(base::DataSample(
+        Timestamp(0), 0, base::RawMemoryRef(data.data(), data.size()))));
+    ASSERT_TRUE(writer->transmit());
+
+    DataReceiver receiver;
+    ASSERT_TRUE(reader->pop(receiver));
+    ASSERT_EQ(receiver._samples.size(), 1u);
+    EXPECT_EQ(receiver._samples.front()->getSize(), data.size());
+}
+
+/**
+ * @detail Test the data triggered reception of samples written by another simulation bus instance
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST_F(SharedMemorySimulationBusTest, testDataTriggeredReception)
+{
+    const auto signal_name = getSignalName("data_triggered");
+
+    auto reader = _reading_bus.getReader(signal_name, 100);
+    auto writer = _writing_bus.getWriter(signal_name, 100);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    auto receiver = std::make_shared<DataReceiver>();
+    reader->reset(receiver);
+
+    std::promise<void> reception_started;
+    auto reception = std::async(std::launch::async, [&]() {
+        _reading_bus.startBlockingReception([&]() { reception_started.set_value(); });
+    });
+    ASSERT_EQ(reception_started.get_future().wait_for(seconds(5)), std::future_status::ready);
+
+    for (uint32_t value = 0; value < 50; ++value) {
+        ASSERT_TRUE(writer->write(base::DataSampleType<uint32_t>(value)));
+        ASSERT_TRUE(writer->transmit());
+    }
+    EXPECT_TRUE(receiver->waitForSamples(50));
+
+    _reading_bus.stopBlockingReception();
+    ASSERT_EQ(reception.wait_for(seconds(5)), std::future_status::ready);
+    reader->reset();
+
+    std::lock_guard<std::mutex> lock(receiver->_mutex);
+    ASSERT_EQ(receiver->_samples.size(), 50u);
+    EXPECT_EQ(getValue(*receiver->_samples.back()), 49u);
+}
+
+/**
+ * @detail Test that a read of the ring never hands out a torn item while a writer overruns the
+ * ring, neither as read item nor as left over content of the item if nothing has been read
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(SharedMemoryRingTest, testReadDoesNotReturnTornItemsWhileOverrun)
+{
+    const size_t slot_size = 4096;
+    auto segment = shared_memory::SharedMemorySegment::open(
+        getSignalName("overrun"),
+        shared_memory::SharedMemoryRing::getPayloadSize(1, slot_size),
+        [](void* payload) { shared_memory::SharedMemoryRing::initialize(payload, 1, slot_size); },
+        milliseconds(1000));
+    ASSERT_TRUE(segment);
+    shared_memory::SharedMemoryRing ring(std::move(segment));
+    ASSERT_TRUE(ring.isValid());
+
+    std::atomic<bool> stop{false};
+    auto writing = std::async(std::launch::async, [&]() {
+        std::vector<shared_memory::RingItem> items(1);
+        auto& item = items.front();
+        item._type = shared_memory::RingItem::Type::sample;
+        for (uint32_t counter = 0; !stop.load(); ++counter) {
+            // every byte of the payload and the time carry the counter
+            item._counter = counter;
+            item._time = counter;
+            item._data.assign(slot_size, static_cast<uint8_t>(counter));
+            ring.write(items, 0, 1);
+        }
+    });
+
+    uint64_t sequence = 0;
+    shared_memory::RingItem item;
+    size_t read_count = 0;
+    size_t torn_count = 0;
+    while (0 == ring.getWriteSequence()) {
+        std::this_thread::yield();
+    }
+    const auto deadline = steady_clock::now() + milliseconds(200);
+    while (steady_clock::now() < deadline) {
+        // stale content which must not survive a failed read
+        item._type = shared_memory::RingItem::Type::sample;
+        item._time = -1;
+        if (!ring.read(sequence, item)) {
+            if (item._type != shared_memory::RingItem::Type::none) {
+                ++torn_count;
+            }
+            continue;
+        }
+        ++read_count;
+        const auto expected_byte = static_cast<uint8_t>(item._counter);
+        if (item._time != static_cast<int64_t>(item._counter) ||
+            item._data.size() != slot_size ||
+            !std::all_of(item._data.begin(), item._data.end(), [&](uint8_t byte) {
+                return byte == expected_byte;
+            })) {
+            ++torn_count;
+        }
+    }
+    stop.store(true);
+    writing.wait();
+
+    EXPECT_EQ(torn_count, 0u);
+    EXPECT_GT(read_count, 0u);
+}
+
+/**
+ * @detail Test that a segment left behind by a crashed process is recreated on the next open,
+ * while a segment of a crashed process is attached to as long as another process is attached
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(SharedMemorySegmentTest, testStaleSegmentOfCrashedProcessIsRecreated)
+{
+    const auto name = getSignalName("stale");
+    const auto open_segment = [&](bool& initialized) {
+        initialized = false;
+        return shared_memory::SharedMemorySegment::open(
+            name, 64, [&](void*) { initialized = true; }, milliseconds(1000));
+    };
+    const auto open_segment_and_crash = [&]() {
+        const auto pid = ::fork();
+        if (0 == pid) {
+            bool initialized = false;
+            // the segment is not detached, as the process exits without unwinding
+            ::_exit(open_segment(initialized).release() ? 0 : 1);
+        }
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        return WIFEXITED(status) && 0 == WEXITSTATUS(status);
+    };
+
+    ASSERT_TRUE(open_segment_and_crash());
+    bool initialized = false;
+    auto segment = open_segment(initialized);
+    ASSERT_TRUE(segment);
+    EXPECT_TRUE(initialized);
+
+    ASSERT_TRUE(open_segment_and_crash());
+    auto attached_segment = open_segment(initialized);
+    ASSERT_TRUE(attached_segment);
+    EXPECT_FALSE(initialized);
+}
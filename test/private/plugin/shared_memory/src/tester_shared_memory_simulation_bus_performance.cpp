@@ -0,0 +1,216 @@
+/**
+ * @file
+ * @copyright
+ * @verbatim
+Copyright @ 2021 VW Group. All rights reserved.
+
+This Source Code Form is subject to the terms of the Mozilla
+Public License, v. 2.0. If a copy of the MPL was not distributed
+with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+@endverbatim
+ */
+
+#include <fep3/base/sample/data_sample.h>
+
+#include <gtest/gtest.h>
+#include <simulation_bus/shared_memory_simulation_bus.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <future>
+
+using namespace fep3;
+using namespace std::chrono;
+
+namespace {
+
+constexpr uint32_t stop_value = UINT32_MAX;
+
+/// Hands the values of received samples over to the waiting thread
+class ValueReceiver : public ISimulationBus::IDataReceiver {
+public:
+    void operator()(const data_read_ptr<const IStreamType>&) override
+    {
+    }
+
+    void operator()(const data_read_ptr<const IDataSample>& sample) override
+    {
+        uint32_t value = 0;
+        base::RawMemoryStandardType<uint32_t> memory(value);
+        sample->read(memory);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _last_value = value;
+            ++_received_samples;
+        }
+        _condition.notify_one();
+    }
+
+    bool waitForValue(uint32_t value)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _condition.wait_for(lock, seconds(5), [&]() { return _last_value == value; });
+    }
+
+    size_t getReceivedSamples()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _received_samples;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    uint32_t _last_value{0};
+    size_t _received_samples{0};
+};
+
+/// Writes every received sample back to the writer until the stop value is received
+class EchoReceiver : public ISimulationBus::IDataReceiver {
+public:
+    EchoReceiver(ISimulationBus::IDataWriter& writer, std::promise<void>& stopped)
+        : _writer(writer), _stopped(stopped)
+    {
+    }
+
+    void operator()(const data_read_ptr<const IStreamType>&) override
+    {
+    }
+
+    void operator()(const data_read_ptr<const IDataSample>& sample) override
+    {
+        _writer.write(*sample);
+        _writer.transmit();
+
+        uint32_t value = 0;
+        base::RawMemoryStandardType<uint32_t> memory(value);
+        sample->read(memory);
+        if (stop_value == value) {
+            _stopped.set_value();
+        }
+    }
+
+private:
+    ISimulationBus::IDataWriter& _writer;
+    std::promise<void>& _stopped;
+};
+
+/// Runs the echo participant in the forked child process
+int runEchoProcess(const std::string& ping_signal, const std::string& pong_signal)
+{
+    shared_memory::SharedMemorySimulationBus simulation_bus;
+    if (!simulation_bus.create() || !simulation_bus.initialize()) {
+        return 1;
+    }
+    auto reader = simulation_bus.getReader(ping_signal, 1000);
+    auto writer = simulation_bus.getWriter(pong_signal, 1000);
+    if (!reader || !writer) {
+        return 1;
+    }
+
+    std::promise<void> stopped;
+    reader->reset(std::make_shared<EchoReceiver>(*writer, stopped));
+    std::promise<void> reception_started;
+    auto reception = std::async(std::launch::async, [&]() {
+        simulation_bus.startBlockingReception([&]() { reception_started.set_value(); });
+    });
+    reception_started.get_future().wait();
+
+    // tell the measuring process that the echo is ready
+    uint32_t ready_value = 0;
+    writer->write(base::DataSampleType<uint32_t>(ready_value));
+    writer->transmit();
+
+    const auto result = stopped.get_future().wait_for(seconds(60));
+    simulation_bus.stopBlockingReception();
+    reception.wait();
+    reader->reset();
+    return (std::future_status::ready == result) ? 0 : 1;
+}
+
+} // namespace
+
+/**
+ * @detail Benchmark the round trip latency and the throughput of samples between two processes
+ * exchanging data via the shared memory simulation bus.
+ * The measured values are recorded as test properties but not asserted.
+ * The benchmark is disabled by default, run it with --gtest_also_run_disabled_tests.
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(SharedMemorySimulationBusPerformance, DISABLED_benchmarkCrossProcessPingPong)
+{
+    constexpr uint32_t round_trip_count = 10000;
+    constexpr uint32_t burst_sample_count = 100000;
+    const auto ping_signal = "ping_" + std::to_string(::getpid());
+    const auto pong_signal = "pong_" + std::to_string(::getpid());
+
+    // the child process is forked before any thread has been started
+    const pid_t echo_process = ::fork();
+    ASSERT_NE(echo_process, -1);
+    if (0 == echo_process) {
+        ::_exit(runEchoProcess(ping_signal, pong_signal));
+    }
+
+    shared_memory::SharedMemorySimulationBus simulation_bus;
+    ASSERT_TRUE(simulation_bus.create());
+    ASSERT_TRUE(simulation_bus.initialize());
+    auto writer = simulation_bus.getWriter(ping_signal, 1000);
+    auto reader = simulation_bus.getReader(pong_signal, 1000);
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(reader);
+
+    auto receiver = std::make_shared<ValueReceiver>();
+    reader->reset(receiver);
+    std::promise<void> reception_started;
+    auto reception = std::async(std::launch::async, [&]() {
+        simulation_bus.startBlockingReception([&]() { reception_started.set_value(); });
+    });
+    reception_started.get_future().wait();
+    ASSERT_TRUE(receiver->waitForValue(0));
+
+    // round trip latency of single samples
+    std::vector<nanoseconds> round_trip_times;
+    round_trip_times.reserve(round_trip_count);
+    for (uint32_t value = 1; value <= round_trip_count; ++value) {
+        const auto begin = steady_clock::now();
+        writer->write(base::DataSampleType<uint32_t>(value));
+        writer->transmit();
+        ASSERT_TRUE(receiver->waitForValue(value));
+        round_trip_times.push_back(steady_clock::now() - begin);
+    }
+    std::sort(round_trip_times.begin(), round_trip_times.end());
+
+    // throughput of a burst of samples, the echo of the last sample marks its reception
+    const auto samples_before_burst = receiver->getReceivedSamples();
+    const auto burst_begin = steady_clock::now();
+    for (uint32_t value = round_trip_count + 1; value <= round_trip_count + burst_sample_count;
+         ++value) {
+        writer->write(base::DataSampleType<uint32_t>(value));
+        writer->transmit();
+    }
+    uint32_t last_value = stop_value;
+    writer->write(base::DataSampleType<uint32_t>(last_value));
+    writer->transmit();
+    EXPECT_TRUE(receiver->waitForValue(stop_value));
+    const auto burst_duration =
+        duration_cast<microseconds>(steady_clock::now() - burst_begin);
+    const auto echoed_samples = receiver->getReceivedSamples() - samples_before_burst;
+
+    simulation_bus.stopBlockingReception();
+    reception.wait();
+    reader->reset();
+
+    int echo_process_status = 0;
+    ASSERT_EQ(::waitpid(echo_process, &echo_process_status, 0), echo_process);
+    EXPECT_TRUE(WIFEXITED(echo_process_status));
+    EXPECT_EQ(WEXITSTATUS(echo_process_status), 0);
+
+    const auto median_round_trip = round_trip_times[round_trip_times.size() / 2];
+    const auto p99_round_trip = round_trip_times[round_trip_times.size() * 99 / 100];
+    RecordProperty("median_round_trip_ns", static_cast<int>(median_round_trip.count()));
+    RecordProperty("p99_round_trip_ns", static_cast<int>(p99_round_trip.count()));
+    RecordProperty("burst_duration_us", static_cast<int>(burst_duration.count()));
+    RecordProperty("burst_echoed_samples", static_cast<int>(echoed_samples));
+}